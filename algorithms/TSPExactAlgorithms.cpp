@@ -1,13 +1,209 @@
 #include "TSPExactAlgorithms.h"
+#include "../structures/graphs/GraphDispatcher.h"
+#include "../utilities/MappedFile.h"
+#include "../structures/NodeAllocator.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define PEA_P1_X86_SIMD
+#endif
+
+namespace {
+
+    // Kernels of TSPExactAlgorithms::dpMinPlus(), without the cap of the result
+    // Lanes of vertices outside of the set are masked out of the loads and replaced with int max, which is
+    // higher than any sum of two costs
+
+    int dpMinPlusScalar(const int *partialPathCosts, const int *edgeCosts, unsigned int vertices, int &outParent) {
+        int bestPathCost = std::numeric_limits<int>::max(), bestParent = 0;
+        for (; vertices != 0; vertices &= vertices - 1) {
+            const int vertexIdx = __builtin_ctz(vertices);
+            const int pathCost = partialPathCosts[vertexIdx] + edgeCosts[vertexIdx];
+            if (pathCost < bestPathCost) {
+                bestPathCost = pathCost;
+                bestParent = vertexIdx;
+            }
+        }
+        outParent = bestParent;
+        return bestPathCost;
+    }
+
+#ifdef PEA_P1_X86_SIMD
+
+    // 8 vertices at a time, up to 32
+    __attribute__((target("avx2")))
+    int dpMinPlusAVX2(const int *partialPathCosts, const int *edgeCosts, unsigned int vertices, int &outParent) {
+        const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        const __m256i skipped = _mm256_set1_epi32(std::numeric_limits<int>::max());
+        __m256i pathCosts[4];
+        __m256i bestPathCosts = skipped;
+        int nChunks = 0;
+        for (; nChunks < 4 && (vertices >> (8 * nChunks)) != 0; ++nChunks) {
+            const __m256i chunkBits = _mm256_set1_epi32(static_cast<int>((vertices >> (8 * nChunks)) & 0xFF));
+            const __m256i laneMask = _mm256_cmpeq_epi32(_mm256_and_si256(chunkBits, laneBits), laneBits);
+            const __m256i sums = _mm256_add_epi32(
+                    _mm256_maskload_epi32(partialPathCosts + 8 * nChunks, laneMask),
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(edgeCosts + 8 * nChunks)));
+            pathCosts[nChunks] = _mm256_blendv_epi8(skipped, sums, laneMask);
+            bestPathCosts = _mm256_min_epi32(bestPathCosts, pathCosts[nChunks]);
+        }
+        __m128i halves = _mm_min_epi32(_mm256_castsi256_si128(bestPathCosts),
+                                       _mm256_extracti128_si256(bestPathCosts, 1));
+        halves = _mm_min_epi32(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(1, 0, 3, 2)));
+        halves = _mm_min_epi32(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        const int bestPathCost = _mm_cvtsi128_si32(halves);
+
+        const __m256i best = _mm256_set1_epi32(bestPathCost);
+        outParent = 0;
+        for (int c = 0; c < nChunks; ++c) {
+            const int isBest = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(pathCosts[c], best)));
+            if (isBest != 0) {
+                outParent = 8 * c + __builtin_ctz(isBest);
+                break;
+            }
+        }
+        return bestPathCost;
+    }
+
+    // 16 vertices at a time, set bits of vertices are the masks of the lanes
+    __attribute__((target("avx512f")))
+    int dpMinPlusAVX512(const int *partialPathCosts, const int *edgeCosts, unsigned int vertices, int &outParent) {
+        const __m512i skipped = _mm512_set1_epi32(std::numeric_limits<int>::max());
+        const auto lowMask = static_cast<__mmask16>(vertices & 0xFFFF);
+        const auto highMask = static_cast<__mmask16>(vertices >> 16);
+        const __m512i lowPathCosts = _mm512_mask_add_epi32(skipped, lowMask,
+                                                           _mm512_maskz_loadu_epi32(lowMask, partialPathCosts),
+                                                           _mm512_loadu_si512(edgeCosts));
+        __m512i highPathCosts = skipped;
+        if (highMask != 0) {
+            highPathCosts = _mm512_mask_add_epi32(skipped, highMask,
+                                                  _mm512_maskz_loadu_epi32(highMask, partialPathCosts + 16),
+                                                  _mm512_loadu_si512(edgeCosts + 16));
+        }
+        const int bestPathCost = _mm512_reduce_min_epi32(_mm512_min_epi32(lowPathCosts, highPathCosts));
+
+        const __m512i best = _mm512_set1_epi32(bestPathCost);
+        const unsigned int isBest = _mm512_cmpeq_epi32_mask(lowPathCosts, best) |
+                                    (static_cast<unsigned int>(_mm512_cmpeq_epi32_mask(highPathCosts, best)) << 16);
+        outParent = __builtin_ctz(isBest);
+        return bestPathCost;
+    }
+
+#endif
+}
+
+TSPExactAlgorithms::DPMinPlusKernel TSPExactAlgorithms::dpMinPlusKernel = TSPExactAlgorithms::dpDetectMinPlusKernel();
+
+std::atomic<std::size_t> TSPExactAlgorithms::bbUnreleasedNodes(0);
+
+std::atomic<std::size_t> TSPExactAlgorithms::bbInterruptedDives(0);
 
 int TSPExactAlgorithms::bruteForce(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return bruteForce(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::bruteForceTree(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return bruteForceTree(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::dynamicProgrammingHeldKarp(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return dynamicProgrammingHeldKarp(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return dynamicProgrammingHeldKarpParallel(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::dynamicProgrammingHeldKarpCompact(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return dynamicProgrammingHeldKarpCompact(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::dynamicProgrammingHeldKarpPruned(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return dynamicProgrammingHeldKarpPruned(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBound(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBound(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBound(const IGraph *tspInstance, std::vector<int> &outSolution,
+                                       BBSearchStrategy searchStrategy, std::size_t memoryBudget) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBound(graph, outSolution, searchStrategy, memoryBudget);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBoundParallel(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBoundParallel(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBound0Heuristics(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBound0Heuristics(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBoundNNHeuristic(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBoundNNHeuristic(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBoundGHeuristic(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBoundGHeuristic(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBound2Heuristics(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBound2Heuristics(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBoundDepthFirst(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBoundDepthFirst(graph, outSolution);
+    });
+}
+
+int TSPExactAlgorithms::branchAndBoundHybrid(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return branchAndBoundHybrid(graph, outSolution);
+    });
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::bruteForce(const TGraph &tspInstance, std::vector<int> &outSolution) {
     // Get size of the ATSP instance
     // permutationSize is the fixed start vertex (counting from 0)
-    // Working on permutation [0 1 2 .. tspInstance->getVertexCount() - 2]
-    int permutationSize = tspInstance->getVertexCount() - 1;
+    // Working on permutation [0 1 2 .. tspInstance.getVertexCount() - 2]
+    int permutationSize = tspInstance.getVertexCount() - 1;
 
     if (permutationSize == 1) {
-        outSolution.emplace_back(tspInstance->getEdgeParameter(0, 1));
+        outSolution.emplace_back(tspInstance.getEdgeParameter(0, 1));
     }
 
     // Initialize natural permutation
@@ -67,11 +263,12 @@ int TSPExactAlgorithms::bruteForce(const IGraph *tspInstance, std::vector<int> &
     return bestPathTargetFunctionValue;
 }
 
-int TSPExactAlgorithms::bruteForceTree(const IGraph *tspInstance, std::vector<int> &outSolution) {
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::bruteForceTree(const TGraph &tspInstance, std::vector<int> &outSolution) {
     // Last vertex is the starting vertex
-    const int permutationSize = tspInstance->getVertexCount() - 1;
+    const int permutationSize = tspInstance.getVertexCount() - 1;
     if (permutationSize == 1) {
-        outSolution.emplace_back(tspInstance->getEdgeParameter(0, 1));
+        outSolution.emplace_back(tspInstance.getEdgeParameter(0, 1));
     }
 
     std::vector<int> usedElements;
@@ -87,12 +284,13 @@ int TSPExactAlgorithms::bruteForceTree(const IGraph *tspInstance, std::vector<in
     return bestSolutionValue;
 }
 
+template<class TGraph>
 void TSPExactAlgorithms::bruteForceTreeRecursiveBuild(std::vector<int> &availableElements, std::vector<int> &usedElements,
-                                                      int &bestSolutionValue, const IGraph *tspInstance,
+                                                      int &bestSolutionValue, const TGraph &tspInstance,
                                                       std::vector<int> &solution) {
     if (availableElements.empty()) {
         int currentSolutionValue = TSPUtils::calculateTargetFunctionValue(tspInstance,
-                                                                          tspInstance->getVertexCount() - 1,
+                                                                          tspInstance.getVertexCount() - 1,
                                                                           usedElements);
         if (currentSolutionValue < bestSolutionValue) {
             bestSolutionValue = currentSolutionValue;
@@ -110,10 +308,11 @@ void TSPExactAlgorithms::bruteForceTreeRecursiveBuild(std::vector<int> &availabl
     }
 }
 
-int TSPExactAlgorithms::dynamicProgrammingHeldKarp(const IGraph *tspInstance, std::vector<int> &outSolution) {
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::dynamicProgrammingHeldKarp(const TGraph &tspInstance, std::vector<int> &outSolution) {
     // Get size of the ATSP instance
     // (nVertex - 1) is the fixed start vertex
-    const int nVertex = tspInstance->getVertexCount();
+    const int nVertex = tspInstance.getVertexCount();
 
     // Number of subsets of sets with size (nVertex - 1)
     const unsigned int pathSetCount = 1u << (nVertex - 1);
@@ -132,7 +331,7 @@ int TSPExactAlgorithms::dynamicProgrammingHeldKarp(const IGraph *tspInstance, st
             partialPathCosts[vertexIdx][pathSet] = -1;
         }
         // opt({q}, q) = dist(x, q)
-        partialPathCosts[vertexIdx][1u << vertexIdx] = tspInstance->getEdgeParameter(nVertex - 1, vertexIdx);
+        partialPathCosts[vertexIdx][1u << vertexIdx] = tspInstance.getEdgeParameter(nVertex - 1, vertexIdx);
     }
 
     // Find best path cost
@@ -142,7 +341,7 @@ int TSPExactAlgorithms::dynamicProgrammingHeldKarp(const IGraph *tspInstance, st
     for (int endVertexIdx = 0; endVertexIdx < nVertex - 1; ++endVertexIdx) {
         // v∗ = min(opt(N, t) + dist(t, x) : t ∈ N)
         pathCost = dpGetPartialPathCost(fullPathSet, endVertexIdx, partialPathCosts, tspInstance) +
-                   tspInstance->getEdgeParameter(endVertexIdx, nVertex - 1);
+                   tspInstance.getEdgeParameter(endVertexIdx, nVertex - 1);
         // Update best path cost
         if (pathCost < bestPathCost) {
             bestPathCost = pathCost;
@@ -162,7 +361,7 @@ int TSPExactAlgorithms::dynamicProgrammingHeldKarp(const IGraph *tspInstance, st
         for (int vertexIdx = 0; vertexIdx < nVertex - 1; ++vertexIdx) {
             if (pathSet & (1u << vertexIdx)) {
                 currentPathCost = partialPathCosts[vertexIdx][pathSet] +
-                                  tspInstance->getEdgeParameter(vertexIdx, solutionPath.front());
+                                  tspInstance.getEdgeParameter(vertexIdx, solutionPath.front());
                 // Taking minimum only if needed is crucial here (always first minimum found)
                 if (currentPathCost < currentMinPathCost) {
                     currentMinPathCost = currentPathCost;
@@ -185,10 +384,11 @@ int TSPExactAlgorithms::dynamicProgrammingHeldKarp(const IGraph *tspInstance, st
     return bestPathCost;
 }
 
+template<class TGraph>
 int TSPExactAlgorithms::dpGetPartialPathCost(unsigned int partialPathSet, int endVertexIdx,
                                              std::vector<std::vector<int>> &partialPathCostTable,
-                                             const IGraph *tspInstance) {
-    const int nVertex = tspInstance->getVertexCount();
+                                             const TGraph &tspInstance) {
+    const int nVertex = tspInstance.getVertexCount();
     int partialPathCost;
     int bestPartialPathCost = std::numeric_limits<int>::max();
 
@@ -206,7 +406,7 @@ int TSPExactAlgorithms::dpGetPartialPathCost(unsigned int partialPathSet, int en
             // opt(S, t) = min(opt(S \ {t}, q) + dist(q, t) : q ∈ S \ {t})
             partialPathCost =
                     dpGetPartialPathCost(partialPathSubset, vertexIdx, partialPathCostTable, tspInstance) +
-                    tspInstance->getEdgeParameter(vertexIdx, endVertexIdx);
+                    tspInstance.getEdgeParameter(vertexIdx, endVertexIdx);
             // Update best partial path cost
             if (partialPathCost < bestPartialPathCost) {
                 bestPartialPathCost = partialPathCost;
@@ -218,18 +418,782 @@ int TSPExactAlgorithms::dpGetPartialPathCost(unsigned int partialPathSet, int en
     return partialPathCostTable[endVertexIdx][partialPathSet];
 }
 
-int TSPExactAlgorithms::branchAndBound(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    const int instanceSize = tspInstance->getVertexCount();
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                                           unsigned int nThreads) {
+    // (nVertex - 1) is the fixed start vertex, paths go through subsets of [0, nVertex - 2]
+    const int nVertex = tspInstance.getVertexCount();
+    const int infinity = std::numeric_limits<int>::max();
+    if (nVertex > 32) {
+        throw std::invalid_argument("dynamicProgrammingHeldKarpParallel() error: sets of vertices are stored as "
+                                    "unsigned int, instance may have at most 32 vertices");
+    }
+    if (nVertex == 1) {
+        outSolution.emplace_back(0);
+        return 0;
+    }
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const int setSize = nVertex - 1;
+    const int startVertex = nVertex - 1;
+
+    // Costs are copied once, the inner loop reads a small row-major matrix
+    std::vector<int> costs(static_cast<std::size_t>(nVertex) * nVertex);
+    int minEdgeCost = 0, maxEdgeCost = 0;
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            costs[i * nVertex + j] = (i == j) ? infinity : tspInstance.getEdgeParameter(i, j);
+            if (costs[i * nVertex + j] != infinity) {
+                minEdgeCost = std::min(minEdgeCost, costs[i * nVertex + j]);
+                maxEdgeCost = std::max(maxEdgeCost, costs[i * nVertex + j]);
+            }
+        }
+    }
+    // Transitions are min-plus reductions of dpMinPlus() if no path can cost DP_MIN_PLUS_INFINITY, unreachable
+    // paths cost DP_MIN_PLUS_INFINITY then; otherwise missing edges and unreachable paths are skipped one by one
+    const bool useMinPlus = minEdgeCost >= 0 &&
+                            static_cast<std::int64_t>(maxEdgeCost) * nVertex < DP_MIN_PLUS_INFINITY;
+    const int unreachable = useMinPlus ? DP_MIN_PLUS_INFINITY : infinity;
+    // edgeCostsTo[t * DP_MIN_PLUS_ROW_SIZE + q] = dist(q, t), a row for each end vertex
+    std::vector<int> edgeCostsTo;
+    if (useMinPlus) {
+        edgeCostsTo.assign(static_cast<std::size_t>(setSize) * DP_MIN_PLUS_ROW_SIZE, DP_MIN_PLUS_INFINITY);
+        for (int endVertexIdx = 0; endVertexIdx < setSize; ++endVertexIdx) {
+            for (int vertexIdx = 0; vertexIdx < setSize; ++vertexIdx) {
+                if (costs[vertexIdx * nVertex + endVertexIdx] != infinity) {
+                    edgeCostsTo[endVertexIdx * DP_MIN_PLUS_ROW_SIZE + vertexIdx] =
+                            costs[vertexIdx * nVertex + endVertexIdx];
+                }
+            }
+        }
+    }
 
-    auto bbNodeComparator =
-            [](const BBNodeData &lhs, const BBNodeData &rhs) -> bool {
-                if (lhs.lowerBound == rhs.lowerBound) {
-                    return lhs.edgesOnPath < rhs.edgesOnPath;
+    // pathCosts[pathSet * setSize + endVertexIdx] - cost of the cheapest path leaving the start vertex, going through
+    // all vertices of pathSet and ending at endVertexIdx (from pathSet), parents - vertex before endVertexIdx on it
+    // Entries with endVertexIdx outside of pathSet are never read, so the tables are left uninitialized
+    const std::size_t tableSize = (static_cast<std::size_t>(1) << setSize) * setSize;
+    std::unique_ptr<int[]> pathCosts(new int[tableSize]);
+    std::unique_ptr<std::uint8_t[]> parents(new std::uint8_t[tableSize]);
+    for (int vertexIdx = 0; vertexIdx < setSize; ++vertexIdx) {
+        // opt({q}, q) = dist(x, q)
+        const int edgeCost = costs[startVertex * nVertex + vertexIdx];
+        pathCosts[(static_cast<std::size_t>(1) << vertexIdx) * setSize + vertexIdx] =
+                (edgeCost != infinity) ? edgeCost : unreachable;
+    }
+
+    const std::vector<std::vector<std::uint64_t>> binomials = dpCalculateBinomials(setSize);
+
+    // Subsets of a layer depend only on the previous layer, so they are computed independently
+    for (int layer = 2; layer <= setSize; ++layer) {
+        auto computeSubsets = [&, layer](std::uint64_t firstRank, std::uint64_t endRank) {
+            unsigned int pathSet = dpUnrankSubset(firstRank, layer, setSize, binomials);
+            for (std::uint64_t rank = firstRank; rank < endRank; ++rank) {
+                int *setCosts = &pathCosts[static_cast<std::size_t>(pathSet) * setSize];
+                std::uint8_t *setParents = &parents[static_cast<std::size_t>(pathSet) * setSize];
+                for (unsigned int endVertices = pathSet; endVertices != 0; endVertices &= endVertices - 1) {
+                    const int endVertexIdx = __builtin_ctz(endVertices);
+                    // opt(S, t) = min(opt(S \ {t}, q) + dist(q, t) : q ∈ S \ {t})
+                    const unsigned int partialPathSet = pathSet & ~(1u << endVertexIdx);
+                    const int *partialPathCosts = &pathCosts[static_cast<std::size_t>(partialPathSet) * setSize];
+                    int bestPathCost = infinity, bestParent = 0;
+                    if (useMinPlus) {
+                        bestPathCost = dpMinPlus(partialPathCosts, &edgeCostsTo[endVertexIdx * DP_MIN_PLUS_ROW_SIZE],
+                                                 partialPathSet, bestParent);
+                    } else {
+                        for (unsigned int vertices = partialPathSet; vertices != 0; vertices &= vertices - 1) {
+                            const int vertexIdx = __builtin_ctz(vertices);
+                            const int edgeCost = costs[vertexIdx * nVertex + endVertexIdx];
+                            // Missing edges and unreachable paths are skipped, instead of overflowing
+                            if (partialPathCosts[vertexIdx] == infinity || edgeCost == infinity) {
+                                continue;
+                            }
+                            const int pathCost = partialPathCosts[vertexIdx] + edgeCost;
+                            if (pathCost < bestPathCost) {
+                                bestPathCost = pathCost;
+                                bestParent = vertexIdx;
+                            }
+                        }
+                    }
+                    setCosts[endVertexIdx] = bestPathCost;
+                    setParents[endVertexIdx] = static_cast<std::uint8_t>(bestParent);
                 }
-                return lhs.lowerBound > rhs.lowerBound;
-            };
-    std::priority_queue<BBNodeData, std::vector<BBNodeData>, decltype(bbNodeComparator)> bbNodes(bbNodeComparator);
+                if (rank + 1 < endRank) {
+                    pathSet = dpNextSubset(pathSet);
+                }
+            }
+        };
+
+        dpSplitLayer(binomials[setSize][layer], nThreads, computeSubsets);
+    }
+
+    // v∗ = min(opt(N, t) + dist(t, x) : t ∈ N)
+    const unsigned int fullPathSet = (1u << setSize) - 1;
+    int bestPathCost = infinity, lastVertexIdx = -1;
+    for (int endVertexIdx = 0; endVertexIdx < setSize; ++endVertexIdx) {
+        const int partialPathCost = pathCosts[static_cast<std::size_t>(fullPathSet) * setSize + endVertexIdx];
+        const int edgeCost = costs[endVertexIdx * nVertex + startVertex];
+        if (partialPathCost != unreachable && edgeCost != infinity && partialPathCost + edgeCost < bestPathCost) {
+            bestPathCost = partialPathCost + edgeCost;
+            lastVertexIdx = endVertexIdx;
+        }
+    }
+    if (lastVertexIdx == -1) {
+        // No cycle goes through existing edges only, any permutation has infinite cost
+        for (int vertex = 0; vertex < nVertex; ++vertex) {
+            outSolution.emplace_back(vertex);
+        }
+        return infinity;
+    }
+
+    // Parents lead from the last vertex back to the first one
+    std::vector<int> reversedPath;
+    unsigned int pathSet = fullPathSet;
+    for (int vertexIdx = lastVertexIdx; vertexIdx != -1;) {
+        reversedPath.emplace_back(vertexIdx);
+        const unsigned int partialPathSet = pathSet & ~(1u << vertexIdx);
+        vertexIdx = (partialPathSet != 0) ? parents[static_cast<std::size_t>(pathSet) * setSize + vertexIdx] : -1;
+        pathSet = partialPathSet;
+    }
+    outSolution.assign(reversedPath.rbegin(), reversedPath.rend());
+    outSolution.emplace_back(startVertex);
+    return bestPathCost;
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::dynamicProgrammingHeldKarpCompact(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                                          unsigned int nThreads) {
+    const int nVertex = tspInstance.getVertexCount();
+    const int missingEdge = std::numeric_limits<int>::max();
+    if (nVertex > 32) {
+        throw std::invalid_argument("dynamicProgrammingHeldKarpCompact() error: sets of vertices are stored as "
+                                    "unsigned int, instance may have at most 32 vertices");
+    }
+    if (nVertex == 1) {
+        outSolution.emplace_back(0);
+        return 0;
+    }
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<int> costs(static_cast<std::size_t>(nVertex) * nVertex);
+    int minEdgeCost = 0;
+    bool isComplete = true;
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            costs[i * nVertex + j] = (i == j) ? missingEdge : tspInstance.getEdgeParameter(i, j);
+            if (i != j) {
+                minEdgeCost = std::min(minEdgeCost, costs[i * nVertex + j]);
+                isComplete = isComplete && costs[i * nVertex + j] != missingEdge;
+            }
+        }
+    }
+
+    const std::int64_t maxCost = std::numeric_limits<int>::max() - 1;
+    if (minEdgeCost < 0 || !isComplete) {
+        // Partial paths may get cheaper on the way (or nearest neighbour may not close a tour), no bound is known
+        return dpHeldKarpLayers<std::int32_t>(costs, nVertex, maxCost, nThreads, outSolution);
+    }
+    // Partial paths of the optimal tour cost at most as much as any tour, costlier ones are dropped,
+    // so cells need to store costs up to the bound only
+    std::vector<int> heuristicSolution;
+    const std::int64_t upperBound = TSPGreedyAlgorithms::nearestNeighbour(tspInstance, heuristicSolution);
+    if (upperBound < std::numeric_limits<std::uint8_t>::max()) {
+        return dpHeldKarpLayers<std::uint8_t>(costs, nVertex, upperBound, nThreads, outSolution);
+    }
+    if (upperBound < std::numeric_limits<std::uint16_t>::max()) {
+        return dpHeldKarpLayers<std::uint16_t>(costs, nVertex, upperBound, nThreads, outSolution);
+    }
+    return dpHeldKarpLayers<std::uint32_t>(costs, nVertex, std::min(upperBound, maxCost), nThreads, outSolution);
+}
+
+template<class TCost>
+int TSPExactAlgorithms::dpHeldKarpLayers(const std::vector<int> &costs, int nVertex, std::int64_t costBound,
+                                         unsigned int nThreads, std::vector<int> &outSolution) {
+    // (nVertex - 1) is the fixed start vertex, paths go through subsets of [0, nVertex - 2]
+    const int setSize = nVertex - 1;
+    const int startVertex = nVertex - 1;
+    const int missingEdge = std::numeric_limits<int>::max();
+    const TCost infinity = std::numeric_limits<TCost>::max();
+    auto toCell = [costBound, infinity](std::int64_t cost) {
+        return (cost <= costBound) ? static_cast<TCost>(cost) : infinity;
+    };
+    const std::vector<std::vector<std::uint64_t>> binomials = dpCalculateBinomials(setSize);
+
+    // Layer of subsets with k vertices keeps k cells per subset, subsets ordered by rank:
+    // cell of (pathSet, endVertexIdx) is rank(pathSet) * k + (number of pathSet's vertices lower than endVertexIdx)
+    std::uint64_t maxLayerCells = 0;
+    for (int layer = 1; layer <= setSize; ++layer) {
+        maxLayerCells = std::max(maxLayerCells, binomials[setSize][layer] * layer);
+    }
+    std::vector<TCost> previousLayer(maxLayerCells), currentLayer(maxLayerCells);
+    std::vector<std::uint8_t> layerParents(maxLayerCells);
+    for (int vertexIdx = 0; vertexIdx < setSize; ++vertexIdx) {
+        // opt({q}, q) = dist(x, q), rank of {q} is q
+        previousLayer[vertexIdx] = toCell(costs[startVertex * nVertex + vertexIdx]);
+    }
+
+    // Parents of finished layers go to a temporary file, removed when the function returns
+    struct SpillFile {
+        std::filesystem::path path;
+
+        ~SpillFile() {
+            std::error_code errorCode;
+            std::filesystem::remove(path, errorCode);
+        }
+    } spillFile{std::filesystem::temp_directory_path() /
+                ("pea_p1_held_karp_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+                 "_" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp")};
+    std::ofstream spillStream(spillFile.path, std::ios::binary | std::ios::trunc);
+    // Offsets of layers' parents in the file
+    std::vector<std::uint64_t> layerOffsets(setSize + 1, 0);
+    std::uint64_t spilledSize = 0;
+
+    for (int layer = 2; layer <= setSize; ++layer) {
+        auto computeSubsets = [&, layer](std::uint64_t firstRank, std::uint64_t endRank) {
+            unsigned int pathSet = dpUnrankSubset(firstRank, layer, setSize, binomials);
+            int vertices[32];
+            std::uint64_t partialPathRanks[32];
+            for (std::uint64_t rank = firstRank; rank < endRank; ++rank) {
+                int nSetVertices = 0;
+                for (unsigned int setVertices = pathSet; setVertices != 0; setVertices &= setVertices - 1) {
+                    vertices[nSetVertices++] = __builtin_ctz(setVertices);
+                }
+                // Without vertices[j], vertices before it keep their ranks' terms and the following ones move
+                // one position down: rank(S \ {v_j}) = sum(C(v_i, i + 1) : i < j) + sum(C(v_i, i) : i > j)
+                std::uint64_t rankTerms = 0;
+                for (int j = 0; j < layer; ++j) {
+                    partialPathRanks[j] = rankTerms;
+                    rankTerms += binomials[vertices[j]][j + 1];
+                }
+                rankTerms = 0;
+                for (int j = layer - 1; j >= 0; --j) {
+                    partialPathRanks[j] += rankTerms;
+                    rankTerms += binomials[vertices[j]][j];
+                }
+
+                TCost *setCells = &currentLayer[rank * layer];
+                std::uint8_t *setParents = &layerParents[rank * layer];
+                for (int j = 0; j < layer; ++j) {
+                    const int endVertexIdx = vertices[j];
+                    const TCost *partialPathCells = &previousLayer[partialPathRanks[j] * (layer - 1)];
+                    // opt(S, t) = min(opt(S \ {t}, q) + dist(q, t) : q ∈ S \ {t})
+                    std::int64_t bestPathCost = std::numeric_limits<std::int64_t>::max();
+                    int bestParent = 0;
+                    for (int l = 0; l < layer; ++l) {
+                        if (l == j) {
+                            continue;
+                        }
+                        // Vertices following the end vertex are one cell lower in the partial path set
+                        const TCost partialPathCost = partialPathCells[(l < j) ? l : l - 1];
+                        const int edgeCost = costs[vertices[l] * nVertex + endVertexIdx];
+                        if (partialPathCost == infinity || edgeCost == missingEdge) {
+                            continue;
+                        }
+                        const std::int64_t pathCost = static_cast<std::int64_t>(partialPathCost) + edgeCost;
+                        if (pathCost < bestPathCost) {
+                            bestPathCost = pathCost;
+                            bestParent = vertices[l];
+                        }
+                    }
+                    setCells[j] = toCell(bestPathCost);
+                    setParents[j] = static_cast<std::uint8_t>(bestParent);
+                }
+                if (rank + 1 < endRank) {
+                    pathSet = dpNextSubset(pathSet);
+                }
+            }
+        };
+        const std::uint64_t layerSize = binomials[setSize][layer];
+        dpSplitLayer(layerSize, nThreads, computeSubsets);
+
+        layerOffsets[layer] = spilledSize;
+        spillStream.write(reinterpret_cast<const char *>(layerParents.data()),
+                          static_cast<std::streamsize>(layerSize * layer));
+        spilledSize += layerSize * layer;
+        previousLayer.swap(currentLayer);
+    }
+    spillStream.close();
+    if (!spillStream) {
+        throw std::invalid_argument("dynamicProgrammingHeldKarpCompact() error: parents could not be written to " +
+                                    spillFile.path.string());
+    }
+
+    // v∗ = min(opt(N, t) + dist(t, x) : t ∈ N), the full set is the only one of the last layer
+    std::int64_t bestPathCost = std::numeric_limits<std::int64_t>::max();
+    int lastVertexIdx = -1;
+    for (int endVertexIdx = 0; endVertexIdx < setSize; ++endVertexIdx) {
+        const TCost partialPathCost = previousLayer[endVertexIdx];
+        const int edgeCost = costs[endVertexIdx * nVertex + startVertex];
+        if (partialPathCost != infinity && edgeCost != missingEdge &&
+            static_cast<std::int64_t>(partialPathCost) + edgeCost < bestPathCost) {
+            bestPathCost = static_cast<std::int64_t>(partialPathCost) + edgeCost;
+            lastVertexIdx = endVertexIdx;
+        }
+    }
+    if (lastVertexIdx == -1) {
+        // No cycle goes through existing edges only, any permutation has infinite cost
+        for (int vertex = 0; vertex < nVertex; ++vertex) {
+            outSolution.emplace_back(vertex);
+        }
+        return missingEdge;
+    }
+
+    // Parents lead from the last vertex back to the first one, one lookup per layer in the mapped file
+    std::vector<int> reversedPath;
+    unsigned int pathSet = (1u << setSize) - 1;
+    int vertexIdx = lastVertexIdx;
+    if (setSize > 1) {
+        MappedFile parentsFile(spillFile.path.string(), MappedFile::OnDemand);
+        parentsFile.adviseAccess(MappedFile::Random);
+        const auto *parents = reinterpret_cast<const std::uint8_t *>(parentsFile.begin());
+        for (int layer = setSize; layer > 1; --layer) {
+            reversedPath.emplace_back(vertexIdx);
+            const auto cellIdx = static_cast<std::uint64_t>(__builtin_popcount(pathSet & ((1u << vertexIdx) - 1)));
+            const int parent = parents[layerOffsets[layer] + dpRankSubset(pathSet, binomials) * layer + cellIdx];
+            pathSet &= ~(1u << vertexIdx);
+            vertexIdx = parent;
+        }
+    }
+    reversedPath.emplace_back(vertexIdx);
+    outSolution.assign(reversedPath.rbegin(), reversedPath.rend());
+    outSolution.emplace_back(startVertex);
+    return static_cast<int>(bestPathCost);
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::dynamicProgrammingHeldKarpPruned(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                                         std::size_t maxStates) {
+    // (nVertex - 1) is the fixed start vertex, paths go through subsets of [0, nVertex - 2]
+    const int nVertex = tspInstance.getVertexCount();
+    const int infinity = std::numeric_limits<int>::max();
+    if (nVertex > 64) {
+        throw std::invalid_argument("dynamicProgrammingHeldKarpPruned() error: sets of vertices are stored as "
+                                    "std::uint64_t, instance may have at most 64 vertices");
+    }
+    if (nVertex == 1) {
+        outSolution.emplace_back(0);
+        return 0;
+    }
+    const int setSize = nVertex - 1;
+    const int startVertex = nVertex - 1;
+    auto noTour = [&]() {
+        // No cycle goes through existing edges only, any permutation has infinite cost
+        for (int vertex = 0; vertex < nVertex; ++vertex) {
+            outSolution.emplace_back(vertex);
+        }
+        return infinity;
+    };
+
+    std::vector<int> costs(static_cast<std::size_t>(nVertex) * nVertex);
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            costs[i * nVertex + j] = (i == j) ? infinity : tspInstance.getEdgeParameter(i, j);
+        }
+    }
+    // Every tour is a cycle cover, so it costs the cheapest cover plus reduced costs of its edges
+    std::vector<std::int64_t> reducedCosts;
+    const std::int64_t coverCost = dpReduceCosts(costs, nVertex, reducedCosts);
+    if (coverCost == infinity) {
+        return noTour();
+    }
+
+    // Upper bound - the better of heuristic tours, tours using missing edges are ignored
+    std::vector<int> bestTour;
+    std::int64_t bestTourCost = infinity;
+    auto considerTour = [&](const std::vector<int> &tour) {
+        std::int64_t tourCost = 0;
+        for (std::size_t i = 0; i < tour.size(); ++i) {
+            const int edgeCost = costs[tour[i] * nVertex + tour[(i + 1) % tour.size()]];
+            if (edgeCost == infinity) {
+                return;
+            }
+            tourCost += edgeCost;
+        }
+        if (tourCost < bestTourCost) {
+            bestTourCost = tourCost;
+            bestTour = tour;
+        }
+    };
+    std::vector<int> heuristicTour;
+    TSPGreedyAlgorithms::nearestNeighbour(tspInstance, heuristicTour);
+    considerTour(heuristicTour);
+    heuristicTour.clear();
+    TSPGreedyAlgorithms::greedy(tspInstance, heuristicTour);
+    considerTour(heuristicTour);
+    if (!bestTour.empty()) {
+        // Heuristic tours are 20-50% above the optimum on ATSP instances, states multiply with the gap
+        bestTourCost = dpImproveTour(costs, nVertex, bestTour);
+    }
+    // Paths with reduced cost reaching the gap between the bounds cannot be a part of a cheaper tour
+    const std::int64_t costGap = bestTourCost - coverCost;
+
+    // Successors and predecessors of each vertex, by increasing reduced cost of the edge
+    std::vector<int> successorOrder, predecessorOrder;
+    dpSortNeighbours(reducedCosts, nVertex, successorOrder, predecessorOrder);
+    const std::int64_t missingEdge = DP_PRUNED_MISSING_EDGE;
+
+    struct State {
+        // Sum of reduced costs of the path's edges, lower than gapLimit
+        std::int64_t pathCost;
+        // Vertex before the end vertex on the path
+        std::uint8_t parent;
+    };
+    // states[layer][endVertexIdx][pathSet] - cheapest path leaving the start vertex, going through all (layer)
+    // vertices of pathSet and ending at endVertexIdx; only states that may lead to a cheaper tour are kept
+    std::vector<std::vector<std::unordered_map<std::uint64_t, State>>> states(
+            setSize + 1, std::vector<std::unordered_map<std::uint64_t, State>>(setSize));
+    std::size_t nStates = 0;
+    const std::uint64_t fullPathSet = (std::uint64_t(1) << setSize) - 1;
+    // Tours are searched below growing limits of their reduced cost - a tour found below the limit is optimal,
+    // as states of all cheaper tours are kept; states multiply quickly with the limit, so passes with limits
+    // lower than the heuristic gap cost less than a single pass with it
+    std::int64_t gapLimit = std::min(costGap, std::max<std::int64_t>(1, costGap / 4));
+
+    // Lower bound of the rest of the tour after extending the path with vertex v: the tour still leaves every vertex
+    // of U (vertices outside of pathSet) once, for U \ {v} or the start vertex, and enters every one of them once,
+    // from U - so it uses at least the cheapest such edges of each vertex
+    // Cheapest allowed successor of a vertex changes only if it was v, the second cheapest one is kept for that
+    std::vector<std::int64_t> outgoingExtra(nVertex), cheapestIncoming(nVertex);
+    auto extendPath = [&](int layer, std::uint64_t pathSet, int endVertexIdx, std::int64_t partialPathCost) {
+        const std::uint64_t unvisited = fullPathSet & ~pathSet;
+        const std::uint64_t successors = unvisited | (std::uint64_t(1) << startVertex);
+        std::int64_t outgoingBound = 0, incomingBound = 0;
+        std::fill(outgoingExtra.begin(), outgoingExtra.end(), 0);
+        for (std::uint64_t vertices = unvisited; vertices != 0; vertices &= vertices - 1) {
+            const int vertexIdx = __builtin_ctzll(vertices);
+            const int *order = &successorOrder[vertexIdx * (nVertex - 1)];
+            int k = 0;
+            while (k < nVertex - 1 && !((successors >> order[k]) & 1)) {
+                ++k;
+            }
+            const int cheapest = order[k];
+            const std::int64_t cheapestCost = reducedCosts[vertexIdx * nVertex + cheapest];
+            for (++k; k < nVertex - 1 && !((successors >> order[k]) & 1); ++k) {}
+            const std::int64_t secondCost = (k < nVertex - 1) ? reducedCosts[vertexIdx * nVertex + order[k]]
+                                                              : missingEdge;
+            outgoingBound += cheapestCost;
+            outgoingExtra[cheapest] += secondCost - cheapestCost;
+        }
+        for (std::uint64_t vertices = successors; vertices != 0; vertices &= vertices - 1) {
+            const int vertexIdx = __builtin_ctzll(vertices);
+            const int *order = &predecessorOrder[vertexIdx * (nVertex - 1)];
+            int k = 0;
+            while (k < nVertex - 1 && !((unvisited >> order[k]) & 1)) {
+                ++k;
+            }
+            cheapestIncoming[vertexIdx] = (k < nVertex - 1) ? reducedCosts[order[k] * nVertex + vertexIdx]
+                                                            : missingEdge;
+            incomingBound += cheapestIncoming[vertexIdx];
+        }
+
+        for (std::uint64_t vertices = unvisited; vertices != 0; vertices &= vertices - 1) {
+            const int vertexIdx = __builtin_ctzll(vertices);
+            const std::int64_t pathCost = partialPathCost + reducedCosts[endVertexIdx * nVertex + vertexIdx];
+            const std::int64_t lowerBound = std::max(outgoingBound + outgoingExtra[vertexIdx],
+                                                     incomingBound - cheapestIncoming[vertexIdx]);
+            if (pathCost + lowerBound >= gapLimit) {
+                continue;
+            }
+            auto inserted = states[layer + 1][vertexIdx].try_emplace(
+                    pathSet | (std::uint64_t(1) << vertexIdx),
+                    State{pathCost, static_cast<std::uint8_t>(endVertexIdx)});
+            if (inserted.second) {
+                if (++nStates > maxStates) {
+                    throw std::invalid_argument("dynamicProgrammingHeldKarpPruned() error: more than " +
+                                                std::to_string(maxStates) + " states would be kept");
+                }
+            } else if (pathCost < inserted.first->second.pathCost) {
+                inserted.first->second = State{pathCost, static_cast<std::uint8_t>(endVertexIdx)};
+            }
+        }
+    };
+
+    int lastVertexIdx = -1;
+    std::int64_t bestPathCost = 0;
+    while (true) {
+        for (auto &layerStates : states) {
+            for (auto &endVertexStates : layerStates) {
+                endVertexStates.clear();
+            }
+        }
+        nStates = 0;
+        // opt({q}, q) = dist(x, q)
+        extendPath(0, 0, startVertex, 0);
+        // opt(S ∪ {v}, v) = min(opt(S, t) + dist(t, v)), states are extended forward, one layer at a time
+        for (int layer = 1; layer < setSize; ++layer) {
+            for (int endVertexIdx = 0; endVertexIdx < setSize; ++endVertexIdx) {
+                for (const auto &[pathSet, state] : states[layer][endVertexIdx]) {
+                    extendPath(layer, pathSet, endVertexIdx, state.pathCost);
+                }
+            }
+        }
+
+        // v∗ = min(opt(N, t) + dist(t, x) : t ∈ N)
+        bestPathCost = gapLimit;
+        for (int endVertexIdx = 0; endVertexIdx < setSize; ++endVertexIdx) {
+            auto state = states[setSize][endVertexIdx].find(fullPathSet);
+            if (state != states[setSize][endVertexIdx].end() &&
+                state->second.pathCost + reducedCosts[endVertexIdx * nVertex + startVertex] < bestPathCost) {
+                bestPathCost = state->second.pathCost + reducedCosts[endVertexIdx * nVertex + startVertex];
+                lastVertexIdx = endVertexIdx;
+            }
+        }
+        if (lastVertexIdx != -1 || gapLimit >= costGap) {
+            break;
+        }
+        gapLimit = std::min(costGap, gapLimit + gapLimit / 4 + 1);
+    }
+    if (lastVertexIdx == -1) {
+        // Every path was pruned - no tour is cheaper than the heuristic one
+        if (bestTour.empty()) {
+            return noTour();
+        }
+        outSolution = bestTour;
+        return static_cast<int>(bestTourCost);
+    }
+    bestTourCost = coverCost + bestPathCost;
+
+    // Parents lead from the last vertex back to the first one
+    std::vector<int> reversedPath;
+    std::uint64_t pathSet = fullPathSet;
+    int vertexIdx = lastVertexIdx;
+    for (int layer = setSize; layer >= 1; --layer) {
+        reversedPath.emplace_back(vertexIdx);
+        const int parent = states[layer][vertexIdx].at(pathSet).parent;
+        pathSet &= ~(std::uint64_t(1) << vertexIdx);
+        vertexIdx = parent;
+    }
+    outSolution.assign(reversedPath.rbegin(), reversedPath.rend());
+    outSolution.emplace_back(startVertex);
+    return static_cast<int>(bestTourCost);
+}
+
+std::int64_t TSPExactAlgorithms::dpReduceCosts(const std::vector<int> &costs, int nVertex,
+                                              std::vector<std::int64_t> &outReducedCosts) {
+    // Hungarian algorithm - successors are assigned to vertices one by one along shortest augmenting paths,
+    // keeping potentials of vertices (rowPotentials) and successors (columnPotentials) feasible
+    // Missing edges cost more than any cover of existing edges, indexes from 1 (0 is the augmenting path's root)
+    const std::int64_t missingEdgeCost = std::int64_t(1) << 40;
+    const std::int64_t unreachable = std::numeric_limits<std::int64_t>::max();
+    auto cost = [&](int i, int j) -> std::int64_t {
+        const int edgeCost = costs[(i - 1) * nVertex + (j - 1)];
+        return (edgeCost == std::numeric_limits<int>::max()) ? missingEdgeCost : edgeCost;
+    };
+    std::vector<std::int64_t> rowPotentials(nVertex + 1, 0), columnPotentials(nVertex + 1, 0);
+    // assignedRow[j] - vertex with successor j, previousColumn - augmenting path
+    std::vector<int> assignedRow(nVertex + 1, 0), previousColumn(nVertex + 1, 0);
+    for (int i = 1; i <= nVertex; ++i) {
+        assignedRow[0] = i;
+        int column = 0;
+        std::vector<std::int64_t> minSlack(nVertex + 1, unreachable);
+        std::vector<bool> isUsed(nVertex + 1, false);
+        do {
+            isUsed[column] = true;
+            const int row = assignedRow[column];
+            std::int64_t delta = unreachable;
+            int nextColumn = 0;
+            for (int j = 1; j <= nVertex; ++j) {
+                if (isUsed[j]) {
+                    continue;
+                }
+                const std::int64_t slack = cost(row, j) - rowPotentials[row] - columnPotentials[j];
+                if (slack < minSlack[j]) {
+                    minSlack[j] = slack;
+                    previousColumn[j] = column;
+                }
+                if (minSlack[j] < delta) {
+                    delta = minSlack[j];
+                    nextColumn = j;
+                }
+            }
+            for (int j = 0; j <= nVertex; ++j) {
+                if (isUsed[j]) {
+                    rowPotentials[assignedRow[j]] += delta;
+                    columnPotentials[j] -= delta;
+                } else {
+                    minSlack[j] -= delta;
+                }
+            }
+            column = nextColumn;
+        } while (assignedRow[column] != 0);
+        do {
+            const int previous = previousColumn[column];
+            assignedRow[column] = assignedRow[previous];
+            column = previous;
+        } while (column != 0);
+    }
+
+    std::int64_t coverCost = 0;
+    for (int j = 1; j <= nVertex; ++j) {
+        coverCost += cost(assignedRow[j], j);
+    }
+    if (coverCost >= missingEdgeCost) {
+        return std::numeric_limits<int>::max();
+    }
+    // Potentials are feasible, so reduced costs of existing edges are not negative; missing edges (and the diagonal)
+    // get a cost higher than any gap between the bounds, sums of a few of them do not overflow
+    outReducedCosts.assign(static_cast<std::size_t>(nVertex) * nVertex, DP_PRUNED_MISSING_EDGE);
+    for (int i = 1; i <= nVertex; ++i) {
+        for (int j = 1; j <= nVertex; ++j) {
+            if (costs[(i - 1) * nVertex + (j - 1)] != std::numeric_limits<int>::max()) {
+                outReducedCosts[(i - 1) * nVertex + (j - 1)] = cost(i, j) - rowPotentials[i] - columnPotentials[j];
+            }
+        }
+    }
+    return coverCost;
+}
+
+void TSPExactAlgorithms::dpSortNeighbours(const std::vector<std::int64_t> &reducedCosts, int nVertex,
+                                          std::vector<int> &outSuccessorOrder, std::vector<int> &outPredecessorOrder) {
+    outSuccessorOrder.clear();
+    outPredecessorOrder.clear();
+    for (int vertex = 0; vertex < nVertex; ++vertex) {
+        const auto successors = outSuccessorOrder.end() - outSuccessorOrder.begin();
+        const auto predecessors = outPredecessorOrder.end() - outPredecessorOrder.begin();
+        for (int neighbour = 0; neighbour < nVertex; ++neighbour) {
+            if (neighbour != vertex) {
+                outSuccessorOrder.emplace_back(neighbour);
+                outPredecessorOrder.emplace_back(neighbour);
+            }
+        }
+        std::stable_sort(outSuccessorOrder.begin() + successors, outSuccessorOrder.end(), [&](int lhs, int rhs) {
+            return reducedCosts[vertex * nVertex + lhs] < reducedCosts[vertex * nVertex + rhs];
+        });
+        std::stable_sort(outPredecessorOrder.begin() + predecessors, outPredecessorOrder.end(), [&](int lhs, int rhs) {
+            return reducedCosts[lhs * nVertex + vertex] < reducedCosts[rhs * nVertex + vertex];
+        });
+    }
+}
+
+std::int64_t TSPExactAlgorithms::dpImproveTour(const std::vector<int> &costs, int nVertex, std::vector<int> &tour) {
+    auto tourCost = [&](const std::vector<int> &candidate) {
+        std::int64_t cost = 0;
+        for (int i = 0; i < nVertex; ++i) {
+            const int edgeCost = costs[candidate[i] * nVertex + candidate[(i + 1) % nVertex]];
+            if (edgeCost == std::numeric_limits<int>::max()) {
+                return std::numeric_limits<std::int64_t>::max();
+            }
+            cost += edgeCost;
+        }
+        return cost;
+    };
+    // Costs are recomputed for each candidate - tours are short, and asymmetric costs change along reversed segments
+    std::int64_t bestCost = tourCost(tour);
+    std::vector<int> candidate(nVertex);
+    for (bool isImproved = true; isImproved;) {
+        isImproved = false;
+        for (int i = 0; i < nVertex; ++i) {
+            // Segment [i, i + length) is moved after position j, or [i, j] is reversed (length 0)
+            for (int length = 0; length <= 3 && i + std::max(length, 1) <= nVertex; ++length) {
+                for (int j = 0; j < nVertex; ++j) {
+                    if (length == 0) {
+                        if (j <= i) {
+                            continue;
+                        }
+                        candidate = tour;
+                        std::reverse(candidate.begin() + i, candidate.begin() + j + 1);
+                    } else {
+                        if (j >= i - 1 && j < i + length) {
+                            continue;
+                        }
+                        candidate.clear();
+                        for (int k = 0; k < nVertex; ++k) {
+                            if (k < i || k >= i + length) {
+                                candidate.emplace_back(tour[k]);
+                            }
+                            if (k == j) {
+                                candidate.insert(candidate.end(), tour.begin() + i, tour.begin() + i + length);
+                            }
+                        }
+                    }
+                    const std::int64_t candidateCost = tourCost(candidate);
+                    if (candidateCost < bestCost) {
+                        bestCost = candidateCost;
+                        tour = candidate;
+                        isImproved = true;
+                    }
+                }
+            }
+        }
+    }
+    return bestCost;
+}
+
+std::vector<std::vector<std::uint64_t>> TSPExactAlgorithms::dpCalculateBinomials(int setSize) {
+    std::vector<std::vector<std::uint64_t>> binomials(setSize + 1, std::vector<std::uint64_t>(setSize + 1, 0));
+    for (int n = 0; n <= setSize; ++n) {
+        binomials[n][0] = 1;
+        for (int k = 1; k <= n; ++k) {
+            binomials[n][k] = binomials[n - 1][k - 1] + ((k < n) ? binomials[n - 1][k] : 0);
+        }
+    }
+    return binomials;
+}
+
+unsigned int TSPExactAlgorithms::dpUnrankSubset(std::uint64_t rank, int subsetSize, int setSize,
+                                                const std::vector<std::vector<std::uint64_t>> &binomials) {
+    // Combinatorial number system - the highest element is the largest c with (c choose k) <= rank
+    unsigned int subset = 0;
+    int element = setSize - 1;
+    for (int k = subsetSize; k > 0; --k) {
+        while (binomials[element][k] > rank) {
+            --element;
+        }
+        subset |= 1u << element;
+        rank -= binomials[element][k];
+        --element;
+    }
+    return subset;
+}
+
+TSPExactAlgorithms::DPMinPlusKernel TSPExactAlgorithms::dpDetectMinPlusKernel() {
+#ifdef PEA_P1_X86_SIMD
+    // Needed before main(), see GCC documentation of __builtin_cpu_supports
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return DPMinPlusKernel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return DPMinPlusKernel::AVX2;
+    }
+#endif
+    return DPMinPlusKernel::Scalar;
+}
+
+int TSPExactAlgorithms::dpMinPlus(const int *partialPathCosts, const int *edgeCosts, unsigned int vertices,
+                                  int &outParent) {
+    int bestPathCost;
+    switch (dpMinPlusKernel) {
+#ifdef PEA_P1_X86_SIMD
+        case DPMinPlusKernel::AVX512:
+            bestPathCost = dpMinPlusAVX512(partialPathCosts, edgeCosts, vertices, outParent);
+            break;
+        case DPMinPlusKernel::AVX2:
+            bestPathCost = dpMinPlusAVX2(partialPathCosts, edgeCosts, vertices, outParent);
+            break;
+#endif
+        default:
+            bestPathCost = dpMinPlusScalar(partialPathCosts, edgeCosts, vertices, outParent);
+            break;
+    }
+    return std::min(bestPathCost, DP_MIN_PLUS_INFINITY);
+}
+
+std::uint64_t TSPExactAlgorithms::dpRankSubset(unsigned int subset,
+                                              const std::vector<std::vector<std::uint64_t>> &binomials) {
+    // Sum of (c_i choose i) over elements c_1 < c_2 < ... of the subset
+    std::uint64_t rank = 0;
+    for (int i = 1; subset != 0; subset &= subset - 1, ++i) {
+        rank += binomials[__builtin_ctz(subset)][i];
+    }
+    return rank;
+}
 
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBound(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                       BBSearchStrategy searchStrategy, std::size_t memoryBudget) {
     // region heuristics
     std::vector<int> heuristicSolution;
     int heuristicSolutionValue;
@@ -253,127 +1217,520 @@ int TSPExactAlgorithms::branchAndBound(const IGraph *tspInstance, std::vector<in
                                                         return lhs.first < rhs.first;
                                                     });
 
-    int upperBound = bestHeuristicSolutionIt->first;
-    std::list<int> tspSolution;
-    for (const auto &vertex : bestHeuristicSolutionIt->second) {
-        tspSolution.emplace_back(vertex);
+    std::vector<int> tspSolution = bestHeuristicSolutionIt->second;
+    const int upperBound = bbSearch(tspInstance, bestHeuristicSolutionIt->first, tspSolution, searchStrategy,
+                                    memoryBudget);
+    for (const auto &vertex : tspSolution) {
+        outSolution.emplace_back(vertex);
     }
+    return upperBound;
+}
 
-    BBNodeData initNode(instanceSize);
-    for (int i = 0; i != instanceSize; ++i) {
-        for (int j = 0; j != instanceSize; ++j) {
-            if (i == j) {
-                initNode.distances[i][j] = std::numeric_limits<int>::max();
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBoundParallel(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                               unsigned int nThreads) {
+    const int instanceSize = tspInstance.getVertexCount();
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Heap order of nodes - the lowest lower bound first, deeper nodes first among equal bounds
+    auto bbNodeComparator =
+            [](const BBNode *lhs, const BBNode *rhs) -> bool {
+                if (lhs->lowerBound == rhs->lowerBound) {
+                    return lhs->edgesOnPath < rhs->edgesOnPath;
+                }
+                return lhs->lowerBound > rhs->lowerBound;
+            };
+
+    // region heuristics
+    std::vector<int> heuristicSolution, bestHeuristicSolution;
+    int bestHeuristicSolutionValue = TSPGreedyAlgorithms::createNaturalPermutation(tspInstance,
+                                                                                   bestHeuristicSolution);
+    int heuristicSolutionValue = TSPGreedyAlgorithms::nearestNeighbour(tspInstance, heuristicSolution);
+    if (heuristicSolutionValue < bestHeuristicSolutionValue) {
+        bestHeuristicSolutionValue = heuristicSolutionValue;
+        bestHeuristicSolution = heuristicSolution;
+    }
+    heuristicSolution.clear();
+    heuristicSolutionValue = TSPGreedyAlgorithms::greedy(tspInstance, heuristicSolution);
+    if (heuristicSolutionValue < bestHeuristicSolutionValue) {
+        bestHeuristicSolutionValue = heuristicSolutionValue;
+        bestHeuristicSolution = heuristicSolution;
+    }
+    // endregion heuristics
+
+    // Incumbent - upperBound is read without the lock for pruning, the tour is replaced under it
+    std::atomic<int> upperBound(bestHeuristicSolutionValue);
+    std::mutex solutionMutex;
+    std::vector<int> tspSolution = bestHeuristicSolution;
+    auto offerSolution = [&](const std::vector<int> &tour) {
+        const int tourValue = TSPUtils::calculateTargetFunctionValue(tspInstance, tour);
+        if (tourValue >= upperBound.load()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(solutionMutex);
+        if (tourValue < upperBound.load()) {
+            tspSolution = tour;
+            upperBound.store(tourValue);
+        }
+    };
+
+    // Queues of the workers - binary heaps ordered by bbNodeComparator - and arenas of their nodes,
+    // each pair guarded by its own mutex (nodes are freed by whichever worker drops the last reference)
+    struct Worker {
+        std::mutex mutex;
+        std::vector<BBNode *> nodes;
+        PooledNodeAllocator<BBNode> nodeArena;
+    };
+    std::vector<Worker> workers(nThreads);
+    // Nodes in the queues or being processed - workers stop when it drops to 0
+    std::atomic<long long> nPendingNodes(1);
+    auto allocateNode = [&](unsigned int workerIdx, BBNode *parent, bool isEdgeIncluded) {
+        std::lock_guard<std::mutex> lock(workers[workerIdx].mutex);
+        return new(workers[workerIdx].nodeArena.allocate())
+                BBNode(parent, parent->highestZeroPenaltiesIndexes, isEdgeIncluded, workerIdx);
+    };
+    auto deallocateNode = [&](BBNode *node) {
+        Worker &worker = workers[node->arenaIdx];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        node->~BBNode();
+        worker.nodeArena.deallocate(node);
+    };
+    auto pushNode = [&](unsigned int workerIdx, BBNode *node) {
+        ++nPendingNodes;
+        std::lock_guard<std::mutex> lock(workers[workerIdx].mutex);
+        workers[workerIdx].nodes.emplace_back(node);
+        std::push_heap(workers[workerIdx].nodes.begin(), workers[workerIdx].nodes.end(), bbNodeComparator);
+    };
+    // Best node of the worker's own queue or, if it is empty, of the first other worker having any
+    auto popNode = [&](unsigned int workerIdx) -> BBNode * {
+        for (unsigned int k = 0; k < nThreads; ++k) {
+            Worker &worker = workers[(workerIdx + k) % nThreads];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            if (!worker.nodes.empty()) {
+                std::pop_heap(worker.nodes.begin(), worker.nodes.end(), bbNodeComparator);
+                BBNode *node = worker.nodes.back();
+                worker.nodes.pop_back();
+                return node;
+            }
+        }
+        return nullptr;
+    };
+
+    BBWorkspace rootWorkspace(instanceSize);
+    BBNode *root = new(workers[0].nodeArena.allocate()) BBNode(nullptr, EdgeCities(), false);
+    bbInitRoot(tspInstance, rootWorkspace, *root);
+    workers[0].nodes.emplace_back(root);
+
+    auto work = [&](unsigned int workerIdx) {
+        BBWorkspace workspace = rootWorkspace;
+        std::vector<int> tour;
+        while (nPendingNodes.load() != 0) {
+            BBNode *node = popNode(workerIdx);
+            if (node == nullptr) {
+                // Other workers are processing the last nodes, they may still push children
+                std::this_thread::yield();
+                continue;
+            }
+            if (node->lowerBound < upperBound.load()) {
+                bbRestoreNode(node, workspace);
+                if (node->isFinal) {
+                    if (node->edgesOnPath == instanceSize - 1) {
+                        bbRestoreTour(workspace, tour);
+                        offerSolution(tour);
+                    }
+                } else {
+                    for (bool isEdgeIncluded : {false, true}) {
+                        BBNode *child = allocateNode(workerIdx, node, isEdgeIncluded);
+                        bbEvaluateChild(workspace, *child);
+                        if (child->lowerBound < upperBound.load()) {
+                            ++node->nReferences;
+                            pushNode(workerIdx, child);
+                        } else {
+                            deallocateNode(child);
+                        }
+                    }
+                }
             }
-            initNode.distances[i][j] = tspInstance->getEdgeParameter(i, j);
+            bbReleaseNode(node, deallocateNode);
+            // Children are counted before their parent is dropped, so the count cannot reach 0 too early
+            --nPendingNodes;
         }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads - 1);
+    for (unsigned int workerIdx = 1; workerIdx < nThreads; ++workerIdx) {
+        threads.emplace_back(work, workerIdx);
+    }
+    work(0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (const auto &worker : workers) {
+        bbUnreleasedNodes += worker.nodeArena.getAllocatedNodeCount();
     }
-    bbCalculateLowerBoundAndDesignateHighestZeroPenalties(initNode);
-    bbNodes.push(initNode);
 
-    BBNodeData leftNode, rightNode;
+    for (const auto &vertex : tspSolution) {
+        outSolution.emplace_back(vertex);
+    }
+    return upperBound.load();
+}
+
+template<class TGraph>
+int TSPExactAlgorithms::bbSearch(const TGraph &tspInstance, int upperBound, std::vector<int> &tspSolution,
+                                 BBSearchStrategy searchStrategy, std::size_t memoryBudget) {
+    const int instanceSize = tspInstance.getVertexCount();
+
+    auto bbNodeComparator =
+            [](const BBNode *lhs, const BBNode *rhs) -> bool {
+                if (lhs->lowerBound == rhs->lowerBound) {
+                    return lhs->edgesOnPath < rhs->edgesOnPath;
+                }
+                return lhs->lowerBound > rhs->lowerBound;
+            };
+    // Open list - binary heap ordered by bbNodeComparator
+    std::vector<BBNode *> bbNodes;
+    // Nodes of the current dive, the next one to expand on top
+    std::vector<BBNode *> bbDiveNodes;
+
+    // Holds open nodes and their ancestors
+    PooledNodeAllocator<BBNode> bbNodeArena;
+    auto allocateNode = [&](BBNode *parent, EdgeCities branchingEdge, bool isEdgeIncluded) {
+        return new(bbNodeArena.allocate()) BBNode(parent, branchingEdge, isEdgeIncluded);
+    };
+    auto deallocateNode = [&](BBNode *node) {
+        node->~BBNode();
+        bbNodeArena.deallocate(node);
+    };
+    auto getOpenNodesMemory = [&]() {
+        return bbNodeArena.getAllocatedNodeCount() * sizeof(BBNode) +
+               (bbNodes.size() + bbDiveNodes.size()) * sizeof(BBNode *);
+    };
+
+    BBWorkspace workspace(instanceSize);
+    BBNode *root = allocateNode(nullptr, EdgeCities(), false);
+    bbInitRoot(tspInstance, workspace, *root);
+    if (searchStrategy == BBSearchStrategy::DepthFirst) {
+        bbDiveNodes.emplace_back(root);
+    } else {
+        bbNodes.emplace_back(root);
+    }
+
+    std::vector<int> tour;
+    BBNode *children[2];
     int calculatedUpperBound;
-    while (bbNodes.top().lowerBound < upperBound && !bbNodes.empty()) {
-        if (!bbNodes.top().isFinal) {
-            leftNode = bbNodes.top();
-            rightNode = bbNodes.top();
-            bbNodes.pop();
+    while (true) {
+        // Hybrid strategy resumes best-first as soon as the open nodes fit in the budget again (tours found
+        // in the dive prune the open list), nodes left in the dive return to the open list
+        if (searchStrategy == BBSearchStrategy::Hybrid && !bbDiveNodes.empty() &&
+            getOpenNodesMemory() <= memoryBudget) {
+            for (BBNode *diveNode : bbDiveNodes) {
+                if (diveNode->lowerBound < upperBound) {
+                    bbNodes.emplace_back(diveNode);
+                    std::push_heap(bbNodes.begin(), bbNodes.end(), bbNodeComparator);
+                } else {
+                    bbReleaseNode(diveNode, deallocateNode);
+                }
+            }
+            bbDiveNodes.clear();
+            ++bbInterruptedDives;
+        }
 
-            bbUpdateLeftNodeData(leftNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(leftNode);
-            if (leftNode.lowerBound < upperBound) {
-                bbNodes.push(leftNode);
+        BBNode *node;
+        // Children of the node go to the dive instead of the open list
+        bool isDiving;
+        if (!bbDiveNodes.empty()) {
+            node = bbDiveNodes.back();
+            bbDiveNodes.pop_back();
+            isDiving = true;
+        } else if (!bbNodes.empty() && bbNodes.front()->lowerBound < upperBound) {
+            std::pop_heap(bbNodes.begin(), bbNodes.end(), bbNodeComparator);
+            node = bbNodes.back();
+            bbNodes.pop_back();
+            // Hybrid strategy dives into the subtree of the best node while the open list is over the budget
+            isDiving = searchStrategy == BBSearchStrategy::Hybrid && getOpenNodesMemory() > memoryBudget;
+        } else {
+            break;
+        }
+
+        // Nodes of a dive may have been waiting since before the upper bound dropped
+        if (node->lowerBound < upperBound) {
+            bbRestoreNode(node, workspace);
+            if (!node->isFinal) {
+                int nChildren = 0;
+                for (bool isEdgeIncluded : {false, true}) {
+                    BBNode *child = allocateNode(node, node->highestZeroPenaltiesIndexes, isEdgeIncluded);
+                    bbEvaluateChild(workspace, *child);
+                    if (child->lowerBound < upperBound) {
+                        ++node->nReferences;
+                        children[nChildren++] = child;
+                    } else {
+                        deallocateNode(child);
+                    }
+                }
+                if (isDiving) {
+                    // Better child is expanded first
+                    if (nChildren == 2 && bbNodeComparator(children[1], children[0])) {
+                        std::swap(children[0], children[1]);
+                    }
+                    for (int k = 0; k != nChildren; ++k) {
+                        bbDiveNodes.emplace_back(children[k]);
+                    }
+                } else {
+                    for (int k = 0; k != nChildren; ++k) {
+                        bbNodes.emplace_back(children[k]);
+                        std::push_heap(bbNodes.begin(), bbNodes.end(), bbNodeComparator);
+                    }
+                }
+            } else if (node->edgesOnPath == instanceSize - 1) {
+                // Final nodes with fewer edges ran out of edges before closing the tour
+                bbRestoreTour(workspace, tour);
+                calculatedUpperBound = TSPUtils::calculateTargetFunctionValue(tspInstance, tour);
+                if (calculatedUpperBound < upperBound) {
+                    upperBound = calculatedUpperBound;
+                    tspSolution = tour;
+
+                    // Open nodes which can no longer lead to a better tour are dropped at once, not when popped
+                    auto prunedNodesIt = std::partition(bbNodes.begin(), bbNodes.end(), [&](const BBNode *openNode) {
+                        return openNode->lowerBound < upperBound;
+                    });
+                    if (prunedNodesIt != bbNodes.end()) {
+                        for (auto nodeIt = prunedNodesIt; nodeIt != bbNodes.end(); ++nodeIt) {
+                            bbReleaseNode(*nodeIt, deallocateNode);
+                        }
+                        bbNodes.erase(prunedNodesIt, bbNodes.end());
+                        std::make_heap(bbNodes.begin(), bbNodes.end(), bbNodeComparator);
+                    }
+                }
             }
+        }
+        bbReleaseNode(node, deallocateNode);
+    }
+    // Nodes left open cannot lead to a better tour
+    for (BBNode *node : bbNodes) {
+        bbReleaseNode(node, deallocateNode);
+    }
+    bbUnreleasedNodes += bbNodeArena.getAllocatedNodeCount();
+    return upperBound;
+}
+
+template<class TGraph>
+void TSPExactAlgorithms::bbInitRoot(const TGraph &tspInstance, BBWorkspace &workspace, BBNode &root) {
+    const int instanceSize = workspace.instanceSize;
+    for (int i = 0; i != instanceSize; ++i) {
+        for (int j = 0; j != instanceSize; ++j) {
+            workspace.rootDistances[i * instanceSize + j] = (i == j) ? std::numeric_limits<int>::max()
+                                                                     : tspInstance.getEdgeParameter(i, j);
+        }
+    }
+    bbCalculateLowerBoundAndDesignateHighestZeroPenalties(workspace.rootDistances, instanceSize, root,
+                                                          workspace.matrixZeroes);
+
+    std::fill(workspace.rootRowZeroCounts.begin(), workspace.rootRowZeroCounts.end(), 0);
+    std::fill(workspace.rootColumnZeroCounts.begin(), workspace.rootColumnZeroCounts.end(), 0);
+    for (int i = 0; i != instanceSize; ++i) {
+        for (int j = 0; j != instanceSize; ++j) {
+            if (workspace.rootDistances[i * instanceSize + j] == 0) {
+                ++workspace.rootRowZeroCounts[i];
+                ++workspace.rootColumnZeroCounts[j];
+            }
+        }
+    }
+}
+
+template<class TDeallocate>
+void TSPExactAlgorithms::bbReleaseNode(BBNode *node, TDeallocate deallocate) {
+    while (node != nullptr && --node->nReferences == 0) {
+        BBNode *parent = node->parent;
+        deallocate(node);
+        node = parent;
+    }
+}
+
+void TSPExactAlgorithms::bbRestoreNode(const BBNode *node, BBWorkspace &workspace) {
+    const int instanceSize = workspace.instanceSize;
+    std::vector<int> &distances = workspace.distances;
 
-            bbUpdateRightNodeData(rightNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(rightNode);
-            if (rightNode.lowerBound < upperBound) {
-                bbNodes.push(rightNode);
+    workspace.nodePath.clear();
+    for (; node->parent != nullptr; node = node->parent) {
+        workspace.nodePath.emplace_back(node);
+    }
+    distances = workspace.rootDistances;
+    workspace.rowZeroCounts = workspace.rootRowZeroCounts;
+    workspace.columnZeroCounts = workspace.rootColumnZeroCounts;
+    for (int v = 0; v != instanceSize; ++v) {
+        workspace.pathStarts[v] = v;
+        workspace.pathEnds[v] = v;
+        workspace.successors[v] = -1;
+    }
+
+    // Sets edge to infinity, noting lines which lose a zero
+    auto blockEdge = [&](int i, int j) {
+        int &distance = distances[i * instanceSize + j];
+        if (distance == 0) {
+            if (--workspace.rowZeroCounts[i] == 0) {
+                workspace.touchedRows.emplace_back(i);
+            }
+            if (--workspace.columnZeroCounts[j] == 0) {
+                workspace.touchedColumns.emplace_back(j);
             }
+        }
+        distance = std::numeric_limits<int>::max();
+    };
+    // Subtracts minimum of the line from its edges - rows first, as in
+    // bbCalculateLowerBoundAndDesignateHighestZeroPenalties(), other lines still have zeros
+    auto reduceLine = [&](int firstIdx, int stride, int &lineZeroCount, std::vector<int> &crossingZeroCounts) {
+        int lineMinimum = std::numeric_limits<int>::max();
+        for (int k = 0, idx = firstIdx; k != instanceSize; ++k, idx += stride) {
+            lineMinimum = std::min(lineMinimum, distances[idx]);
+        }
+        if (lineMinimum == std::numeric_limits<int>::max() || lineMinimum == 0) {
+            return;
+        }
+        for (int k = 0, idx = firstIdx; k != instanceSize; ++k, idx += stride) {
+            if (distances[idx] == std::numeric_limits<int>::max()) {
+                continue;
+            }
+            distances[idx] -= lineMinimum;
+            if (distances[idx] == 0) {
+                ++lineZeroCount;
+                ++crossingZeroCounts[k];
+            }
+        }
+    };
+
+    for (auto nodeIt = workspace.nodePath.rbegin(); nodeIt != workspace.nodePath.rend(); ++nodeIt) {
+        const EdgeCities edge = (*nodeIt)->branchingEdge;
+        workspace.touchedRows.clear();
+        workspace.touchedColumns.clear();
+        if ((*nodeIt)->isEdgeIncluded) {
+            const EdgeCities prohibitedEdge = bbProhibitedEdge(workspace, edge);
+            for (int k = 0; k != instanceSize; ++k) {
+                blockEdge(edge.i, k);
+                blockEdge(k, edge.j);
+            }
+            blockEdge(prohibitedEdge.i, prohibitedEdge.j);
+
+            const int pathStart = workspace.pathStarts[edge.i];
+            const int pathEnd = workspace.pathEnds[edge.j];
+            workspace.pathEnds[pathStart] = pathEnd;
+            workspace.pathStarts[pathEnd] = pathStart;
+            workspace.successors[edge.i] = edge.j;
         } else {
-            calculatedUpperBound = TSPUtils::calculateTargetFunctionValue(tspInstance,
-                                                                          bbNodes.top().partialPaths.front());
-            if (calculatedUpperBound < upperBound) {
-                upperBound = calculatedUpperBound;
-                tspSolution = bbNodes.top().partialPaths.front();
+            blockEdge(edge.i, edge.j);
+        }
+
+        for (const int row : workspace.touchedRows) {
+            reduceLine(row * instanceSize, 1, workspace.rowZeroCounts[row], workspace.columnZeroCounts);
+        }
+        for (const int column : workspace.touchedColumns) {
+            if (workspace.columnZeroCounts[column] == 0) {
+                reduceLine(column, instanceSize, workspace.columnZeroCounts[column], workspace.rowZeroCounts);
             }
-            bbNodes.pop();
         }
     }
-    for (const auto &vertex : tspSolution) {
-        outSolution.emplace_back(vertex);
+}
+
+void TSPExactAlgorithms::bbEvaluateChild(BBWorkspace &workspace, BBNode &child) {
+    workspace.childDistances = workspace.distances;
+    if (child.isEdgeIncluded) {
+        bbIncludeEdge(workspace.childDistances, workspace.instanceSize, child.branchingEdge,
+                      bbProhibitedEdge(workspace, child.branchingEdge));
+        child.edgesOnPath += 1;
+    } else {
+        bbExcludeEdge(workspace.childDistances, workspace.instanceSize, child.branchingEdge);
+    }
+    bbCalculateLowerBoundAndDesignateHighestZeroPenalties(workspace.childDistances, workspace.instanceSize, child,
+                                                          workspace.matrixZeroes);
+}
+
+void TSPExactAlgorithms::bbRestoreTour(const BBWorkspace &workspace, std::vector<int> &outTour) {
+    outTour.clear();
+    int vertex = 0;
+    while (workspace.successors[vertex] != -1) {
+        vertex = workspace.successors[vertex];
+    }
+    for (vertex = workspace.pathStarts[vertex]; vertex != -1; vertex = workspace.successors[vertex]) {
+        outTour.emplace_back(vertex);
     }
-    return upperBound;
 }
 
-void TSPExactAlgorithms::bbCalculateLowerBoundAndDesignateHighestZeroPenalties(BBNodeData &nodeData) {
-    // pair: <Indexes of zero, penalty>
-    std::list<std::pair<EdgeCities, int>> matrixZeroes;
+EdgeCities TSPExactAlgorithms::bbProhibitedEdge(const BBWorkspace &workspace, EdgeCities edge) {
+    return {workspace.pathEnds[edge.j], workspace.pathStarts[edge.i]};
+}
+
+void TSPExactAlgorithms::bbCalculateLowerBoundAndDesignateHighestZeroPenalties(std::vector<int> &distances,
+                                                                               int instanceSize, BBNode &node,
+                                                                               std::vector<std::pair<EdgeCities, int>> &matrixZeroes) {
+    matrixZeroes.clear();
 
     int rowMinimum;
     bool edgesAreAvailable = false;
-    for (int i = 0; i != nodeData.distances.size(); ++i) {
-        rowMinimum = *std::min_element(nodeData.distances[i].begin(), nodeData.distances[i].end());
+    for (int i = 0; i != instanceSize; ++i) {
+        int *row = distances.data() + i * instanceSize;
+        rowMinimum = *std::min_element(row, row + instanceSize);
         if (rowMinimum == std::numeric_limits<int>::max()) {
             continue;
         }
         edgesAreAvailable = true;
-        for (int j = 0; j != nodeData.distances.size(); ++j) {
-            if (nodeData.distances[i][j] == std::numeric_limits<int>::max()) {
+        for (int j = 0; j != instanceSize; ++j) {
+            if (row[j] == std::numeric_limits<int>::max()) {
                 continue;
             }
-            nodeData.distances[i][j] -= rowMinimum;
-            if (nodeData.distances[i][j] == 0) {
+            row[j] -= rowMinimum;
+            if (row[j] == 0) {
                 matrixZeroes.emplace_back(EdgeCities(i, j), 0);
             }
         }
-        nodeData.lowerBound += rowMinimum;
+        node.lowerBound += rowMinimum;
     }
 
     if (!edgesAreAvailable) {
-        nodeData.isFinal = true;
+        node.isFinal = true;
         return;
     }
 
     int columnMinimum;
-    for (int j = 0; j != nodeData.distances.size(); ++j) {
-        columnMinimum = nodeData.distances[0][j];
-        for (int i = 1; i != nodeData.distances.size(); ++i) {
-            if (nodeData.distances[i][j] < columnMinimum) {
-                columnMinimum = nodeData.distances[i][j];
+    for (int j = 0; j != instanceSize; ++j) {
+        columnMinimum = distances[j];
+        for (int i = 1; i != instanceSize; ++i) {
+            if (distances[i * instanceSize + j] < columnMinimum) {
+                columnMinimum = distances[i * instanceSize + j];
             }
         }
         if (columnMinimum == std::numeric_limits<int>::max() || columnMinimum == 0) {
             continue;
         }
-        for (int i = 0; i != nodeData.distances.size(); ++i) {
-            if (nodeData.distances[i][j] == std::numeric_limits<int>::max()) {
+        for (int i = 0; i != instanceSize; ++i) {
+            if (distances[i * instanceSize + j] == std::numeric_limits<int>::max()) {
                 continue;
             }
-            nodeData.distances[i][j] -= columnMinimum;
-            if (nodeData.distances[i][j] == 0) {
+            distances[i * instanceSize + j] -= columnMinimum;
+            if (distances[i * instanceSize + j] == 0) {
                 matrixZeroes.emplace_back(EdgeCities(i, j), 0);
             }
         }
-        nodeData.lowerBound += columnMinimum;
+        node.lowerBound += columnMinimum;
     }
-    bbDesignateHighestZeroPenalty(nodeData, matrixZeroes);
+    bbDesignateHighestZeroPenalty(distances, instanceSize, node, matrixZeroes);
 }
 
-void TSPExactAlgorithms::bbDesignateHighestZeroPenalty(BBNodeData &nodeData,
-                                                       std::list<std::pair<EdgeCities, int>> &matrixZeroes) {
+void TSPExactAlgorithms::bbDesignateHighestZeroPenalty(const std::vector<int> &distances, int instanceSize,
+                                                       BBNode &node,
+                                                       std::vector<std::pair<EdgeCities, int>> &matrixZeroes) {
     int rowMinimum, columnMinimum;
     for (auto &matrixZero : matrixZeroes) {
         rowMinimum = std::numeric_limits<int>::max();
-        for (int j = 0; j != nodeData.distances.size(); ++j) {
-            if (nodeData.distances[matrixZero.first.i][j] < rowMinimum && j != matrixZero.first.j) {
-                rowMinimum = nodeData.distances[matrixZero.first.i][j];
+        for (int j = 0; j != instanceSize; ++j) {
+            if (distances[matrixZero.first.i * instanceSize + j] < rowMinimum && j != matrixZero.first.j) {
+                rowMinimum = distances[matrixZero.first.i * instanceSize + j];
             }
         }
         columnMinimum = std::numeric_limits<int>::max();
-        for (int i = 0; i != nodeData.distances.size(); ++i) {
-            if (nodeData.distances[i][matrixZero.first.j] < columnMinimum && i != matrixZero.first.i) {
-                columnMinimum = nodeData.distances[i][matrixZero.first.j];
+        for (int i = 0; i != instanceSize; ++i) {
+            if (distances[i * instanceSize + matrixZero.first.j] < columnMinimum && i != matrixZero.first.i) {
+                columnMinimum = distances[i * instanceSize + matrixZero.first.j];
             }
         }
 //        matrixZero.second = 0; // No need for initialization
@@ -390,271 +1747,58 @@ void TSPExactAlgorithms::bbDesignateHighestZeroPenalty(BBNodeData &nodeData,
                                                       std::pair<EdgeCities, int> &rhs) -> bool {
                                                        return lhs.second < rhs.second;
                                                    });
-    nodeData.highestZeroPenaltiesIndexes = highestPenaltyZeroData->first;
-    nodeData.highestZeroPenalty = highestPenaltyZeroData->second;
-}
-
-void TSPExactAlgorithms::bbUpdateLeftNodeData(BBNodeData &nodeData) {
-    nodeData.distances[nodeData.highestZeroPenaltiesIndexes.i][nodeData.highestZeroPenaltiesIndexes.j] = std::numeric_limits<int>::max();
-}
-
-void TSPExactAlgorithms::bbUpdateRightNodeData(BBNodeData &nodeData) {
-    int iCityPathIdx = -1;
-    int jCityPathIdx = -1;
-    for (int k = 0; k != nodeData.partialPaths.size(); ++k) {
-        if (nodeData.partialPaths[k].back() == nodeData.highestZeroPenaltiesIndexes.i) {
-            iCityPathIdx = k;
-        } else if (nodeData.partialPaths[k].front() == nodeData.highestZeroPenaltiesIndexes.j) {
-            jCityPathIdx = k;
-        }
-    }
-
-    EdgeCities prohibitedEdge;
-    if (iCityPathIdx == -1 && jCityPathIdx == -1) {
-        nodeData.partialPaths.emplace_back();
-        auto newPathIt = nodeData.partialPaths.end();
-        --newPathIt;
-        newPathIt->emplace_back(nodeData.highestZeroPenaltiesIndexes.i);
-        newPathIt->emplace_back(nodeData.highestZeroPenaltiesIndexes.j);
-        prohibitedEdge.i = nodeData.highestZeroPenaltiesIndexes.j;
-        prohibitedEdge.j = nodeData.highestZeroPenaltiesIndexes.i;
-        nodeData.edgesOnPath += 1;
-    } else if (iCityPathIdx != -1 && jCityPathIdx == -1) {
-        nodeData.partialPaths[iCityPathIdx].emplace_back(nodeData.highestZeroPenaltiesIndexes.j);
-        prohibitedEdge.i = nodeData.highestZeroPenaltiesIndexes.j;
-        prohibitedEdge.j = nodeData.partialPaths[iCityPathIdx].front();
-        nodeData.edgesOnPath += 1;
-    } else if (iCityPathIdx == -1 /*&& jCityPathIdx != -1*/) {
-        nodeData.partialPaths[jCityPathIdx].emplace_front(nodeData.highestZeroPenaltiesIndexes.i);
-        prohibitedEdge.i = nodeData.partialPaths[jCityPathIdx].back();
-        prohibitedEdge.j = nodeData.highestZeroPenaltiesIndexes.i;
-        nodeData.edgesOnPath += 1;
-    } else if (iCityPathIdx != jCityPathIdx) {
-        nodeData.partialPaths[iCityPathIdx].splice(nodeData.partialPaths[iCityPathIdx].end(),
-                                                   nodeData.partialPaths[jCityPathIdx]);
-        prohibitedEdge.i = nodeData.partialPaths[iCityPathIdx].back();
-        prohibitedEdge.j = nodeData.partialPaths[iCityPathIdx].front();
-        nodeData.partialPaths.erase(nodeData.partialPaths.begin() + jCityPathIdx);
-        nodeData.edgesOnPath += 1;
-    } else { // iCityPathIdx == jCityPathIdx
-        throw std::exception();
-    }
-
-    for (int j = 0; j != nodeData.distances.size(); ++j) {
-        nodeData.distances[nodeData.highestZeroPenaltiesIndexes.i][j] = std::numeric_limits<int>::max();
-    }
-    for (int i = 0; i != nodeData.distances.size(); ++i) {
-        nodeData.distances[i][nodeData.highestZeroPenaltiesIndexes.j] = std::numeric_limits<int>::max();
-    }
-    nodeData.distances[prohibitedEdge.i][prohibitedEdge.j] = std::numeric_limits<int>::max();
+    node.highestZeroPenaltiesIndexes = highestPenaltyZeroData->first;
 }
 
-int TSPExactAlgorithms::branchAndBound0Heuristics(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    const int instanceSize = tspInstance->getVertexCount();
-
-    auto bbNodeComparator =
-            [](const BBNodeData &lhs, const BBNodeData &rhs) -> bool {
-                if (lhs.lowerBound == rhs.lowerBound) {
-                    return lhs.edgesOnPath < rhs.edgesOnPath;
-                }
-                return lhs.lowerBound > rhs.lowerBound;
-            };
-    std::priority_queue<BBNodeData, std::vector<BBNodeData>, decltype(bbNodeComparator)> bbNodes(bbNodeComparator);
-
-    int upperBound = std::numeric_limits<int>::max();
-    std::list<int> tspSolution;
+void TSPExactAlgorithms::bbExcludeEdge(std::vector<int> &distances, int instanceSize, EdgeCities edge) {
+    distances[edge.i * instanceSize + edge.j] = std::numeric_limits<int>::max();
+}
 
-    BBNodeData initNode(instanceSize);
+void TSPExactAlgorithms::bbIncludeEdge(std::vector<int> &distances, int instanceSize, EdgeCities edge,
+                                       EdgeCities prohibitedEdge) {
+    for (int j = 0; j != instanceSize; ++j) {
+        distances[edge.i * instanceSize + j] = std::numeric_limits<int>::max();
+    }
     for (int i = 0; i != instanceSize; ++i) {
-        for (int j = 0; j != instanceSize; ++j) {
-            if (i == j) {
-                initNode.distances[i][j] = std::numeric_limits<int>::max();
-            }
-            initNode.distances[i][j] = tspInstance->getEdgeParameter(i, j);
-        }
+        distances[i * instanceSize + edge.j] = std::numeric_limits<int>::max();
     }
-    bbCalculateLowerBoundAndDesignateHighestZeroPenalties(initNode);
-    bbNodes.push(initNode);
-
-    BBNodeData leftNode, rightNode;
-    int calculatedUpperBound;
-    while (bbNodes.top().lowerBound < upperBound && !bbNodes.empty()) {
-        if (!bbNodes.top().isFinal) {
-            leftNode = bbNodes.top();
-            rightNode = bbNodes.top();
-            bbNodes.pop();
-
-            bbUpdateLeftNodeData(leftNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(leftNode);
-            if (leftNode.lowerBound < upperBound) {
-                bbNodes.push(leftNode);
-            }
+    distances[prohibitedEdge.i * instanceSize + prohibitedEdge.j] = std::numeric_limits<int>::max();
+}
 
-            bbUpdateRightNodeData(rightNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(rightNode);
-            if (rightNode.lowerBound < upperBound) {
-                bbNodes.push(rightNode);
-            }
-        } else {
-            calculatedUpperBound = TSPUtils::calculateTargetFunctionValue(tspInstance,
-                                                                          bbNodes.top().partialPaths.front());
-            if (calculatedUpperBound < upperBound) {
-                upperBound = calculatedUpperBound;
-                tspSolution = bbNodes.top().partialPaths.front();
-            }
-            bbNodes.pop();
-        }
-    }
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBound0Heuristics(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    std::vector<int> tspSolution;
+    const int upperBound = bbSearch(tspInstance, std::numeric_limits<int>::max(), tspSolution);
     for (const auto &vertex : tspSolution) {
         outSolution.emplace_back(vertex);
     }
     return upperBound;
 }
 
-int TSPExactAlgorithms::branchAndBoundNNHeuristic(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    const int instanceSize = tspInstance->getVertexCount();
-
-    auto bbNodeComparator =
-            [](const BBNodeData &lhs, const BBNodeData &rhs) -> bool {
-                if (lhs.lowerBound == rhs.lowerBound) {
-                    return lhs.edgesOnPath < rhs.edgesOnPath;
-                }
-                return lhs.lowerBound > rhs.lowerBound;
-            };
-    std::priority_queue<BBNodeData, std::vector<BBNodeData>, decltype(bbNodeComparator)> bbNodes(bbNodeComparator);
-
-    std::vector<int> heuristicSolution;
-    int upperBound = TSPGreedyAlgorithms::nearestNeighbour(tspInstance, heuristicSolution);
-    std::list<int> tspSolution;
-    for (const auto &vertex : heuristicSolution) {
-        tspSolution.emplace_back(vertex);
-    }
-
-    BBNodeData initNode(instanceSize);
-    for (int i = 0; i != instanceSize; ++i) {
-        for (int j = 0; j != instanceSize; ++j) {
-            if (i == j) {
-                initNode.distances[i][j] = std::numeric_limits<int>::max();
-            }
-            initNode.distances[i][j] = tspInstance->getEdgeParameter(i, j);
-        }
-    }
-    bbCalculateLowerBoundAndDesignateHighestZeroPenalties(initNode);
-    bbNodes.push(initNode);
-
-    BBNodeData leftNode, rightNode;
-    int calculatedUpperBound;
-    while (bbNodes.top().lowerBound < upperBound && !bbNodes.empty()) {
-        if (!bbNodes.top().isFinal) {
-            leftNode = bbNodes.top();
-            rightNode = bbNodes.top();
-            bbNodes.pop();
-
-            bbUpdateLeftNodeData(leftNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(leftNode);
-            if (leftNode.lowerBound < upperBound) {
-                bbNodes.push(leftNode);
-            }
-
-            bbUpdateRightNodeData(rightNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(rightNode);
-            if (rightNode.lowerBound < upperBound) {
-                bbNodes.push(rightNode);
-            }
-        } else {
-            calculatedUpperBound = TSPUtils::calculateTargetFunctionValue(tspInstance,
-                                                                          bbNodes.top().partialPaths.front());
-            if (calculatedUpperBound < upperBound) {
-                upperBound = calculatedUpperBound;
-                tspSolution = bbNodes.top().partialPaths.front();
-            }
-            bbNodes.pop();
-        }
-    }
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBoundNNHeuristic(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    std::vector<int> tspSolution;
+    int upperBound = TSPGreedyAlgorithms::nearestNeighbour(tspInstance, tspSolution);
+    upperBound = bbSearch(tspInstance, upperBound, tspSolution);
     for (const auto &vertex : tspSolution) {
         outSolution.emplace_back(vertex);
     }
     return upperBound;
 }
 
-int TSPExactAlgorithms::branchAndBoundGHeuristic(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    const int instanceSize = tspInstance->getVertexCount();
-
-    auto bbNodeComparator =
-            [](const BBNodeData &lhs, const BBNodeData &rhs) -> bool {
-                if (lhs.lowerBound == rhs.lowerBound) {
-                    return lhs.edgesOnPath < rhs.edgesOnPath;
-                }
-                return lhs.lowerBound > rhs.lowerBound;
-            };
-    std::priority_queue<BBNodeData, std::vector<BBNodeData>, decltype(bbNodeComparator)> bbNodes(bbNodeComparator);
-
-    std::vector<int> heuristicSolution;
-    int upperBound = TSPGreedyAlgorithms::greedy(tspInstance, heuristicSolution);
-    std::list<int> tspSolution;
-    for (const auto &vertex : heuristicSolution) {
-        tspSolution.emplace_back(vertex);
-    }
-
-    BBNodeData initNode(instanceSize);
-    for (int i = 0; i != instanceSize; ++i) {
-        for (int j = 0; j != instanceSize; ++j) {
-            if (i == j) {
-                initNode.distances[i][j] = std::numeric_limits<int>::max();
-            }
-            initNode.distances[i][j] = tspInstance->getEdgeParameter(i, j);
-        }
-    }
-    bbCalculateLowerBoundAndDesignateHighestZeroPenalties(initNode);
-    bbNodes.push(initNode);
-
-    BBNodeData leftNode, rightNode;
-    int calculatedUpperBound;
-    while (bbNodes.top().lowerBound < upperBound && !bbNodes.empty()) {
-        if (!bbNodes.top().isFinal) {
-            leftNode = bbNodes.top();
-            rightNode = bbNodes.top();
-            bbNodes.pop();
-
-            bbUpdateLeftNodeData(leftNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(leftNode);
-            if (leftNode.lowerBound < upperBound) {
-                bbNodes.push(leftNode);
-            }
-
-            bbUpdateRightNodeData(rightNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(rightNode);
-            if (rightNode.lowerBound < upperBound) {
-                bbNodes.push(rightNode);
-            }
-        } else {
-            calculatedUpperBound = TSPUtils::calculateTargetFunctionValue(tspInstance,
-                                                                          bbNodes.top().partialPaths.front());
-            if (calculatedUpperBound < upperBound) {
-                upperBound = calculatedUpperBound;
-                tspSolution = bbNodes.top().partialPaths.front();
-            }
-            bbNodes.pop();
-        }
-    }
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBoundGHeuristic(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    std::vector<int> tspSolution;
+    int upperBound = TSPGreedyAlgorithms::greedy(tspInstance, tspSolution);
+    upperBound = bbSearch(tspInstance, upperBound, tspSolution);
     for (const auto &vertex : tspSolution) {
         outSolution.emplace_back(vertex);
     }
     return upperBound;
 }
 
-int TSPExactAlgorithms::branchAndBound2Heuristics(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    const int instanceSize = tspInstance->getVertexCount();
-
-    auto bbNodeComparator =
-            [](const BBNodeData &lhs, const BBNodeData &rhs) -> bool {
-                if (lhs.lowerBound == rhs.lowerBound) {
-                    return lhs.edgesOnPath < rhs.edgesOnPath;
-                }
-                return lhs.lowerBound > rhs.lowerBound;
-            };
-    std::priority_queue<BBNodeData, std::vector<BBNodeData>, decltype(bbNodeComparator)> bbNodes(bbNodeComparator);
-
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBound2Heuristics(const TGraph &tspInstance, std::vector<int> &outSolution) {
     // region heuristics
     std::vector<int> heuristicSolution;
     int heuristicSolutionValue;
@@ -674,60 +1818,44 @@ int TSPExactAlgorithms::branchAndBound2Heuristics(const IGraph *tspInstance, std
                                                         return lhs.first < rhs.first;
                                                     });
 
-    int upperBound = bestHeuristicSolutionIt->first;
-    std::list<int> tspSolution;
-    for (const auto &vertex : bestHeuristicSolutionIt->second) {
-        tspSolution.emplace_back(vertex);
-    }
-
-    BBNodeData initNode(instanceSize);
-    for (int i = 0; i != instanceSize; ++i) {
-        for (int j = 0; j != instanceSize; ++j) {
-            if (i == j) {
-                initNode.distances[i][j] = std::numeric_limits<int>::max();
-            }
-            initNode.distances[i][j] = tspInstance->getEdgeParameter(i, j);
-        }
-    }
-    bbCalculateLowerBoundAndDesignateHighestZeroPenalties(initNode);
-    bbNodes.push(initNode);
-
-    BBNodeData leftNode, rightNode;
-    int calculatedUpperBound;
-    while (bbNodes.top().lowerBound < upperBound && !bbNodes.empty()) {
-        if (!bbNodes.top().isFinal) {
-            leftNode = bbNodes.top();
-            rightNode = bbNodes.top();
-            bbNodes.pop();
-
-            bbUpdateLeftNodeData(leftNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(leftNode);
-            if (leftNode.lowerBound < upperBound) {
-                bbNodes.push(leftNode);
-            }
-
-            bbUpdateRightNodeData(rightNode);
-            bbCalculateLowerBoundAndDesignateHighestZeroPenalties(rightNode);
-            if (rightNode.lowerBound < upperBound) {
-                bbNodes.push(rightNode);
-            }
-        } else {
-            calculatedUpperBound = TSPUtils::calculateTargetFunctionValue(tspInstance,
-                                                                          bbNodes.top().partialPaths.front());
-            if (calculatedUpperBound < upperBound) {
-                upperBound = calculatedUpperBound;
-                tspSolution = bbNodes.top().partialPaths.front();
-            }
-            bbNodes.pop();
-        }
-    }
+    std::vector<int> tspSolution = bestHeuristicSolutionIt->second;
+    const int upperBound = bbSearch(tspInstance, bestHeuristicSolutionIt->first, tspSolution);
     for (const auto &vertex : tspSolution) {
         outSolution.emplace_back(vertex);
     }
     return upperBound;
 }
 
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBoundDepthFirst(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    return branchAndBound(tspInstance, outSolution, BBSearchStrategy::DepthFirst);
+}
 
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPExactAlgorithms::branchAndBoundHybrid(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    return branchAndBound(tspInstance, outSolution, BBSearchStrategy::Hybrid);
+}
 
-
-
+// Explicit instantiations for graph types handled by GraphDispatcher
+#define INSTANTIATE_EXACT_ALGORITHMS(TGraph)                                                                 \
+    template int TSPExactAlgorithms::bruteForce<TGraph>(const TGraph &, std::vector<int> &);                 \
+    template int TSPExactAlgorithms::bruteForceTree<TGraph>(const TGraph &, std::vector<int> &);             \
+    template int TSPExactAlgorithms::dynamicProgrammingHeldKarp<TGraph>(const TGraph &, std::vector<int> &); \
+    template int TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel<TGraph>(const TGraph &,              \
+            std::vector<int> &, unsigned int);                                                               \
+    template int TSPExactAlgorithms::dynamicProgrammingHeldKarpCompact<TGraph>(const TGraph &,               \
+            std::vector<int> &, unsigned int);                                                               \
+    template int TSPExactAlgorithms::dynamicProgrammingHeldKarpPruned<TGraph>(const TGraph &,                \
+            std::vector<int> &, std::size_t);                                                                \
+    template int TSPExactAlgorithms::branchAndBound<TGraph>(const TGraph &, std::vector<int> &,              \
+            TSPExactAlgorithms::BBSearchStrategy, std::size_t);                                              \
+    template int TSPExactAlgorithms::branchAndBoundParallel<TGraph>(const TGraph &, std::vector<int> &,      \
+            unsigned int);                                                                                   \
+    template int TSPExactAlgorithms::branchAndBound0Heuristics<TGraph>(const TGraph &, std::vector<int> &);  \
+    template int TSPExactAlgorithms::branchAndBoundNNHeuristic<TGraph>(const TGraph &, std::vector<int> &);  \
+    template int TSPExactAlgorithms::branchAndBoundGHeuristic<TGraph>(const TGraph &, std::vector<int> &);   \
+    template int TSPExactAlgorithms::branchAndBound2Heuristics<TGraph>(const TGraph &, std::vector<int> &);  \
+    template int TSPExactAlgorithms::branchAndBoundDepthFirst<TGraph>(const TGraph &, std::vector<int> &);   \
+    template int TSPExactAlgorithms::branchAndBoundHybrid<TGraph>(const TGraph &, std::vector<int> &);
+
+PEA_P1_FOR_EACH_DISPATCHED_GRAPH(INSTANTIATE_EXACT_ALGORITHMS)
@@ -6,6 +6,12 @@
 #include <list>
 #include <limits>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 
 #include "../utilities/TSPUtils.h"
 #include "helper_structures/TSPHelperStructures.h"
@@ -22,8 +28,48 @@ public:
 
     static int dynamicProgrammingHeldKarp(const IGraph *tspInstance, std::vector<int> &outSolution);
 
+    // Bottom-up Held-Karp over one flat table - subsets are computed layer by layer (by number of vertices),
+    // subsets of a layer are split between every hardware thread; vertex count is limited to 32
+    static int dynamicProgrammingHeldKarpParallel(const IGraph *tspInstance, std::vector<int> &outSolution);
+
+    // As dynamicProgrammingHeldKarpParallel(), in memory of two layers instead of all subsets:
+    // - cells of a layer are stored only for vertices of their subsets, as narrow as the upper bound from nearest
+    //   neighbour allows (1, 2 or 4 bytes), partial paths costlier than the bound are dropped
+    // - parents of finished layers (1 byte each) are spilled to a temporary file, mapped for path reconstruction
+    static int dynamicProgrammingHeldKarpCompact(const IGraph *tspInstance, std::vector<int> &outSolution);
+
+    // Held-Karp keeping only states that may still lead to a tour cheaper than the upper bound (nearest neighbour
+    // or greedy, improved with local search)
+    // Costs are reduced by the cheapest cycle cover (assignment), a path is kept while its reduced cost plus the
+    // cheapest edges leaving and entering the vertices left stays below the bound
+    // States are kept sparsely in hash maps, so instances of up to 64 vertices are solved if the bounds are tight
+    // (ATSP instances of up to 45 vertices from input_data/ATSP in seconds)
+    static int dynamicProgrammingHeldKarpPruned(const IGraph *tspInstance, std::vector<int> &outSolution);
+
+    // Order in which branchAndBound() expands open nodes
+    // BestFirst - the lowest lower bound first, open nodes may fill the memory
+    // DepthFirst - children of the last expanded node first, memory grows only with depth of the tree,
+    // tours found early tighten pruning
+    // Hybrid - best-first, but while open nodes take more than the memory budget, the subtree of the best node
+    // is searched depth-first; memory is checked after every expanded node, and once pruning or the dive itself
+    // brings it below the budget, the rest of the dive returns to the open list and best-first resumes
+    enum class BBSearchStrategy {
+        BestFirst,
+        DepthFirst,
+        Hybrid
+    };
+
     static int branchAndBound(const IGraph *tspInstance, std::vector<int> &outSolution);
 
+    // memoryBudget - bytes of open nodes above which Hybrid strategy dives
+    static int branchAndBound(const IGraph *tspInstance, std::vector<int> &outSolution,
+                              BBSearchStrategy searchStrategy, std::size_t memoryBudget = BB_MEMORY_BUDGET);
+
+    // As branchAndBound(), nodes are processed by workers, each with its own best-first queue
+    // Idle workers steal the best node of another worker; the upper bound is shared through an atomic, so a tour
+    // found by one worker prunes nodes of all of them at once
+    static int branchAndBoundParallel(const IGraph *tspInstance, std::vector<int> &outSolution);
+
     // For tests
     static int branchAndBound0Heuristics(const IGraph *tspInstance, std::vector<int> &outSolution);
 
@@ -33,27 +79,222 @@ public:
 
     static int branchAndBound2Heuristics(const IGraph *tspInstance, std::vector<int> &outSolution);
 
+    static int branchAndBoundDepthFirst(const IGraph *tspInstance, std::vector<int> &outSolution);
+
+    static int branchAndBoundHybrid(const IGraph *tspInstance, std::vector<int> &outSolution);
+
+    // Variants taking the concrete graph type, so that edge lookups are not virtual calls
+    // Instantiated for IGraph and every graph type handled by GraphDispatcher
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int bruteForce(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int bruteForceTree(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int dynamicProgrammingHeldKarp(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    // nThreads = 0 uses every hardware thread
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int dynamicProgrammingHeldKarpParallel(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                                  unsigned int nThreads = 0);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int dynamicProgrammingHeldKarpCompact(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                                 unsigned int nThreads = 0);
+
+    // Throws std::invalid_argument if more than maxStates states would be kept
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int dynamicProgrammingHeldKarpPruned(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                                std::size_t maxStates = DP_PRUNED_MAX_STATES);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBound(const TGraph &tspInstance, std::vector<int> &outSolution,
+                              BBSearchStrategy searchStrategy = BBSearchStrategy::BestFirst,
+                              std::size_t memoryBudget = BB_MEMORY_BUDGET);
+
+    // nThreads = 0 uses every hardware thread
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBoundParallel(const TGraph &tspInstance, std::vector<int> &outSolution,
+                                      unsigned int nThreads = 0);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBound0Heuristics(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBoundNNHeuristic(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBoundGHeuristic(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBound2Heuristics(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBoundDepthFirst(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int branchAndBoundHybrid(const TGraph &tspInstance, std::vector<int> &outSolution);
+
 private:
 
+    template<class TGraph>
     static void
     bruteForceTreeRecursiveBuild(std::vector<int> &availableElements, std::vector<int> &usedElements,
-                                 int &bestSolutionValue, const IGraph *tspInstance,
+                                 int &bestSolutionValue, const TGraph &tspInstance,
                                  std::vector<int> &solution);
 
+    template<class TGraph>
     static int
     dpGetPartialPathCost(unsigned int partialPathSet, int endVertexIdx,
                          std::vector<std::vector<int>> &partialPathCostTable,
-                         const IGraph *tspInstance);
+                         const TGraph &tspInstance);
 
-    static void bbCalculateLowerBoundAndDesignateHighestZeroPenalties(BBNodeData &nodeData);
+    // Layers smaller than this are not split between threads
+    static const std::uint64_t DP_PARALLEL_THRESHOLD = 1 << 12;
 
-    static void
-    bbDesignateHighestZeroPenalty(BBNodeData &nodeData, std::list<std::pair<EdgeCities, int>> &matrixZeroes);
+    // Default memory budget of open nodes of branchAndBound() with Hybrid strategy (about 10M nodes)
+    static constexpr std::size_t BB_MEMORY_BUDGET = std::size_t(512) << 20;
+
+    // Default limit of states kept by dynamicProgrammingHeldKarpPruned() (about 1 GB)
+    static constexpr std::size_t DP_PRUNED_MAX_STATES = std::size_t(1) << 24;
+
+    // Reduced cost of missing edges (see dpReduceCosts()), higher than any gap between the bounds
+    static constexpr std::int64_t DP_PRUNED_MISSING_EDGE = std::int64_t(1) << 50;
+
+    // Implementations of dpMinPlus()
+    enum class DPMinPlusKernel {
+        Scalar,
+        AVX2,
+        AVX512
+    };
+
+    // Set once at startup, from the CPU features
+    static DPMinPlusKernel dpMinPlusKernel;
+
+    [[nodiscard]] static DPMinPlusKernel dpDetectMinPlusKernel();
+
+    // Unreachable paths and missing edges in dpMinPlus() - sums of two costs from [0, DP_MIN_PLUS_INFINITY]
+    // do not overflow
+    static constexpr int DP_MIN_PLUS_INFINITY = std::numeric_limits<int>::max() / 2;
+
+    // Row length of edgeCosts in dpMinPlus(), entries past the vertices are padding
+    static constexpr int DP_MIN_PLUS_ROW_SIZE = 32;
+
+    // min(partialPathCosts[q] + edgeCosts[q] : q ∈ vertices), capped at DP_MIN_PLUS_INFINITY; vertices is not empty
+    // outParent - the lowest q reaching the minimum
+    // Entries of partialPathCosts outside of vertices are not read, edgeCosts has DP_MIN_PLUS_ROW_SIZE entries
+    [[nodiscard]] static int dpMinPlus(const int *partialPathCosts, const int *edgeCosts, unsigned int vertices,
+                                       int &outParent);
+
+    // Cost of the cheapest cycle cover (assignment of a successor to every vertex) of existing edges,
+    // std::numeric_limits<int>::max() if there is none
+    // outReducedCosts - costs less optimal dual potentials of the assignment, every cycle cover (so every tour)
+    // costs the cheapest cover plus reduced costs of its edges; reduced costs of existing edges are not negative
+    [[nodiscard]] static std::int64_t dpReduceCosts(const std::vector<int> &costs, int nVertex,
+                                                    std::vector<std::int64_t> &outReducedCosts);
+
+    // outSuccessorOrder[v * (nVertex - 1) + k] - k-th cheapest successor of v, outPredecessorOrder likewise
+    static void dpSortNeighbours(const std::vector<std::int64_t> &reducedCosts, int nVertex,
+                                 std::vector<int> &outSuccessorOrder, std::vector<int> &outPredecessorOrder);
+
+    // Local search on a tour of existing edges - moves of segments of up to 3 vertices and reversals are made while
+    // they make the tour cheaper; returns the cost of the tour
+    static std::int64_t dpImproveTour(const std::vector<int> &costs, int nVertex, std::vector<int> &tour);
+
+    // binomials[n][k] = n choose k, for n, k from [0, setSize]
+    [[nodiscard]] static std::vector<std::vector<std::uint64_t>> dpCalculateBinomials(int setSize);
+
+    // Calls computeSubsets(firstRank, endRank) for ranges of [0, layerSize) on up to nThreads threads
+    // Ranges are disjoint, so subsets of a layer can be computed independently
+    template<class TFunction>
+    static void dpSplitLayer(std::uint64_t layerSize, unsigned int nThreads, const TFunction &computeSubsets) {
+        const std::uint64_t nChunks = std::max<std::uint64_t>(
+                1, std::min<std::uint64_t>(nThreads, layerSize / DP_PARALLEL_THRESHOLD));
+        if (nChunks == 1) {
+            computeSubsets(0, layerSize);
+            return;
+        }
+        std::vector<std::thread> threads;
+        threads.reserve(nChunks);
+        for (std::uint64_t c = 0; c < nChunks; ++c) {
+            threads.emplace_back(computeSubsets, layerSize * c / nChunks, layerSize * (c + 1) / nChunks);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    // rank-th subset of [0, setSize) with subsetSize elements, in increasing order of subsets as numbers
+    [[nodiscard]] static unsigned int dpUnrankSubset(std::uint64_t rank, int subsetSize, int setSize,
+                                                     const std::vector<std::vector<std::uint64_t>> &binomials);
+
+    // Inverse of dpUnrankSubset() - position of subset among subsets with the same number of elements
+    [[nodiscard]] static std::uint64_t dpRankSubset(unsigned int subset,
+                                                    const std::vector<std::vector<std::uint64_t>> &binomials);
+
+    // Layers of dynamicProgrammingHeldKarpCompact() for given cost cell type
+    // Costs above costBound are stored as infinity (max of TCost), so costBound must be lower than it
+    template<class TCost>
+    static int dpHeldKarpLayers(const std::vector<int> &costs, int nVertex, std::int64_t costBound,
+                                unsigned int nThreads, std::vector<int> &outSolution);
+
+    // Next subset with the same number of elements, in increasing order (Gosper's hack)
+    [[nodiscard]] static unsigned int dpNextSubset(unsigned int subset) {
+        const unsigned int lowestBit = subset & -subset;
+        const unsigned int ripple = subset + lowestBit;
+        return (((ripple ^ subset) >> 2) / lowestBit) | ripple;
+    }
+
+    // Nodes still allocated when searches of Little's algorithm ended, summed over all searches
+    // Every node is released by the search itself, so it stays 0 unless a node leaks
+    static std::atomic<std::size_t> bbUnreleasedNodes;
+
+    // Dives of Hybrid strategy ended before their subtree was searched, summed over all searches
+    static std::atomic<std::size_t> bbInterruptedDives;
+
+    // Search of Little's algorithm, started with upperBound and its tour (empty if none)
+    // Returns the cost of the best tour, which replaces tspSolution if it is better than upperBound
+    template<class TGraph>
+    static int bbSearch(const TGraph &tspInstance, int upperBound, std::vector<int> &tspSolution,
+                        BBSearchStrategy searchStrategy = BBSearchStrategy::BestFirst,
+                        std::size_t memoryBudget = BB_MEMORY_BUDGET);
+
+    // Reduces costs of tspInstance into root matrix of the workspace and evaluates root node
+    template<class TGraph>
+    static void bbInitRoot(const TGraph &tspInstance, BBWorkspace &workspace, BBNode &root);
+
+    // Drops a reference to node - freed nodes (passed to deallocate) release their parents in turn
+    template<class TDeallocate>
+    static void bbReleaseNode(BBNode *node, TDeallocate deallocate);
+
+    // Rebuilds reduced matrix and partial paths of node in the workspace, replaying decisions from the root
+    // Only lines which lost their last zero are reduced again, so a decision costs O(n) instead of O(n^2)
+    static void bbRestoreNode(const BBNode *node, BBWorkspace &workspace);
+
+    // Evaluates child of the node restored in the workspace - its matrix is derived in childDistances
+    static void bbEvaluateChild(BBWorkspace &workspace, BBNode &child);
+
+    // Tour of a final node restored in the workspace
+    static void bbRestoreTour(const BBWorkspace &workspace, std::vector<int> &outTour);
+
+    // Edge closing a cycle if edge joins partial paths of the restored node
+    [[nodiscard]] static EdgeCities bbProhibitedEdge(const BBWorkspace &workspace, EdgeCities edge);
+
+    static void bbCalculateLowerBoundAndDesignateHighestZeroPenalties(std::vector<int> &distances, int instanceSize,
+                                                                      BBNode &node,
+                                                                      std::vector<std::pair<EdgeCities, int>> &matrixZeroes);
+
+    static void bbDesignateHighestZeroPenalty(const std::vector<int> &distances, int instanceSize, BBNode &node,
+                                              std::vector<std::pair<EdgeCities, int>> &matrixZeroes);
 
-    static void bbUpdateLeftNodeData(BBNodeData &nodeData);
+    static void bbExcludeEdge(std::vector<int> &distances, int instanceSize, EdgeCities edge);
 
-    static void bbUpdateRightNodeData(BBNodeData &nodeData);
+    static void bbIncludeEdge(std::vector<int> &distances, int instanceSize, EdgeCities edge,
+                              EdgeCities prohibitedEdge);
 
+    friend class TSPAlgorithmsTest;
+    friend class PerformanceBenchmark;
 };
 
 
@@ -1,12 +1,54 @@
 #include "TSPGreedyAlgorithms.h"
 #include "../utilities/Random.h"
+#include "../structures/graphs/GraphDispatcher.h"
 
+#include <algorithm>
 #include <vector>
 #include <list>
 #include <limits>
+#include <type_traits>
 
 int TSPGreedyAlgorithms::nearestNeighbour(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    const int instanceSize = tspInstance->getVertexCount();
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return nearestNeighbour(graph, outSolution);
+    });
+}
+
+int TSPGreedyAlgorithms::greedy(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return greedy(graph, outSolution);
+    });
+}
+
+int TSPGreedyAlgorithms::createNaturalPermutation(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return createNaturalPermutation(graph, outSolution);
+    });
+}
+
+int TSPGreedyAlgorithms::createRandomPermutation(const IGraph *tspInstance, std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return createRandomPermutation(graph, outSolution);
+    });
+}
+
+bool TSPGreedyAlgorithms::isTSPAlgorithm(fTSPAlgorithm function) {
+    return function == static_cast<fTSPAlgorithm>(nearestNeighbour)
+           || function == static_cast<fTSPAlgorithm>(greedy)
+           || function == static_cast<fTSPAlgorithm>(createNaturalPermutation)
+           || function == static_cast<fTSPAlgorithm>(createRandomPermutation);
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPGreedyAlgorithms::nearestNeighbour(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    if constexpr (std::is_same_v<TGraph, SparseGraph>) {
+        return sparseNearestNeighbour(tspInstance, outSolution);
+    }
+    if constexpr (std::is_same_v<TGraph, CoordinateGraph>) {
+        return coordinateNearestNeighbour(tspInstance, outSolution);
+    }
+
+    const int instanceSize = tspInstance.getVertexCount();
     std::vector<bool> isVertexVisited(instanceSize, false);
 
     outSolution.emplace_back(0);
@@ -20,7 +62,7 @@ int TSPGreedyAlgorithms::nearestNeighbour(const IGraph *tspInstance, std::vector
             if (isVertexVisited[j]) {
                 continue;
             }
-            currentRowValue = tspInstance->getEdgeParameter(outSolution.back(), j);
+            currentRowValue = tspInstance.getEdgeParameter(outSolution.back(), j);
             if (currentRowValue < rowMinimum) {
                 rowMinimum = currentRowValue;
                 rowMinimumIndex = j;
@@ -32,82 +74,148 @@ int TSPGreedyAlgorithms::nearestNeighbour(const IGraph *tspInstance, std::vector
     return TSPUtils::calculateTargetFunctionValue(tspInstance, outSolution);
 }
 
-int TSPGreedyAlgorithms::greedy(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    const int instanceSize = tspInstance->getVertexCount();
+int TSPGreedyAlgorithms::sparseNearestNeighbour(const SparseGraph &tspInstance, std::vector<int> &outSolution) {
+    const int instanceSize = tspInstance.getVertexCount();
+    std::vector<bool> isVertexVisited(instanceSize, false);
 
-    std::__cxx11::list<TSPEdge> edgesList;
-    for (int i = 0; i < instanceSize; ++i) {
-        for (int j = 0; j < instanceSize; ++j) {
-            if (i == j) {
-                continue;
+    outSolution.reserve(instanceSize);
+    outSolution.emplace_back(0);
+    isVertexVisited[0] = true;
+
+    // No vertex below firstUnvisited is unvisited
+    int firstUnvisited = 1;
+    int rowMinimum;
+    int rowMinimumIndex;
+    while (outSolution.size() != instanceSize) {
+        // Rows are sorted by vertex ID, so ties are resolved as in the dense variant
+        auto successors = tspInstance.getSuccessorsView(outSolution.back());
+        auto costs = tspInstance.getSuccessorCostsView(outSolution.back());
+        rowMinimum = std::numeric_limits<int>::max();
+        rowMinimumIndex = -1;
+        for (int k = 0; k < successors.getSize(); ++k) {
+            if (!isVertexVisited[successors[k]] && costs[k] < rowMinimum) {
+                rowMinimum = costs[k];
+                rowMinimumIndex = successors[k];
+            }
+        }
+        if (rowMinimumIndex == -1) {
+            // Dead end - tour continues through missing edge
+            while (isVertexVisited[firstUnvisited]) {
+                ++firstUnvisited;
             }
-            edgesList.emplace_back(i, j, tspInstance->getEdgeParameter(i, j));
+            rowMinimumIndex = firstUnvisited;
         }
+        outSolution.emplace_back(rowMinimumIndex);
+        isVertexVisited[rowMinimumIndex] = true;
     }
-    edgesList.sort([](const TSPEdge &lhs, const TSPEdge &rhs) -> bool {
-        return lhs.cost < rhs.cost;
-    });
+    return TSPUtils::calculateTargetFunctionValue(tspInstance, outSolution);
+}
 
-    int iCityPathIdx, jCityPathIdx;
-    std::vector<std::list<int>> partialPaths;
-    // [i][0] -> true if the city was exited, [i][1] -> true if the city was entered
-    std::vector<std::vector<bool>> cityOnPath(instanceSize, std::vector<bool>(2, false));
-    while (!edgesList.empty()) {
-        if (cityOnPath[edgesList.front().i][0] || cityOnPath[edgesList.front().j][1]) {
-            edgesList.pop_front();
-            continue;
-        }
-        iCityPathIdx = -1;
-        jCityPathIdx = -1;
-        for (int k = 0; k != partialPaths.size(); ++k) {
-            if (partialPaths[k].back() == edgesList.front().i) {
-                iCityPathIdx = k;
-            }
-            if (partialPaths[k].front() == edgesList.front().j) {
-                jCityPathIdx = k;
+int TSPGreedyAlgorithms::coordinateNearestNeighbour(const CoordinateGraph &tspInstance,
+                                                    std::vector<int> &outSolution) {
+    const int instanceSize = tspInstance.getVertexCount();
+    // Kept in ascending order, so that ties are resolved as in the generic variant
+    std::vector<int> unvisitedVertices(instanceSize - 1);
+    for (int j = 1; j < instanceSize; ++j) {
+        unvisitedVertices[j - 1] = j;
+    }
+    std::vector<int> currentVertex(instanceSize - 1);
+    std::vector<int> costs(instanceSize - 1);
+
+    outSolution.reserve(instanceSize);
+    outSolution.emplace_back(0);
+    while (!unvisitedVertices.empty()) {
+        const int unvisitedCount = static_cast<int>(unvisitedVertices.size());
+        std::fill(currentVertex.begin(), currentVertex.begin() + unvisitedCount, outSolution.back());
+        tspInstance.computeCosts(currentVertex.data(), unvisitedVertices.data(), unvisitedCount, costs.data());
+        const int minimumPosition = static_cast<int>(std::min_element(costs.begin(),
+                                                                      costs.begin() + unvisitedCount) -
+                                                     costs.begin());
+        outSolution.emplace_back(unvisitedVertices[minimumPosition]);
+        unvisitedVertices.erase(unvisitedVertices.begin() + minimumPosition);
+    }
+    return TSPUtils::calculateTargetFunctionValue(tspInstance, outSolution);
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPGreedyAlgorithms::greedy(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    const int instanceSize = tspInstance.getVertexCount();
+
+    std::vector<TSPEdge> edges;
+    if constexpr (std::is_same_v<TGraph, SparseGraph>) {
+        // Only existing edges are considered
+        for (int i = 0; i < instanceSize; ++i) {
+            auto successors = tspInstance.getSuccessorsView(i);
+            auto costs = tspInstance.getSuccessorCostsView(i);
+            for (int k = 0; k < successors.getSize(); ++k) {
+                edges.emplace_back(i, successors[k], costs[k]);
             }
-            if (iCityPathIdx != -1 && jCityPathIdx != -1) {
-                break;
+        }
+    } else {
+        edges.reserve(static_cast<std::size_t>(instanceSize) * (instanceSize - 1));
+        for (int i = 0; i < instanceSize; ++i) {
+            for (int j = 0; j < instanceSize; ++j) {
+                if (i == j) {
+                    continue;
+                }
+                edges.emplace_back(i, j, tspInstance.getEdgeParameter(i, j));
             }
         }
+    }
+    std::stable_sort(edges.begin(), edges.end(), [](const TSPEdge &lhs, const TSPEdge &rhs) -> bool {
+        return lhs.cost < rhs.cost;
+    });
 
-        if (iCityPathIdx == -1 && jCityPathIdx == -1) {
-            partialPaths.emplace_back();
-            auto newPathIt = partialPaths.end();
-            --newPathIt;
-            newPathIt->emplace_back(edgesList.front().i);
-            newPathIt->emplace_back(edgesList.front().j);
-        } else if (iCityPathIdx != -1 && jCityPathIdx == -1) {
-            partialPaths[iCityPathIdx].emplace_back(edgesList.front().j);
-        } else if (iCityPathIdx == -1 /*&& jCityPathIdx != -1*/) {
-            partialPaths[jCityPathIdx].emplace_front(edgesList.front().i);
-        } else if (iCityPathIdx != jCityPathIdx) {
-            partialPaths[iCityPathIdx].splice(partialPaths[iCityPathIdx].end(),
-                                              partialPaths[jCityPathIdx]);
-            partialPaths.erase(partialPaths.begin() + jCityPathIdx);
-        } else { // iCityPathIdx == jCityPathIdx
-            edgesList.pop_front();
+    // Cities are joined into partial paths - every city starts as a path of its own
+    // nextCity/previousCity: neighbours on the path (-1 if the city was not exited/entered)
+    // pathEnd[first city of a path] is its last city, pathStart[last city of a path] is its first city
+    std::vector<int> nextCity(instanceSize, -1), previousCity(instanceSize, -1);
+    std::vector<int> pathEnd(instanceSize), pathStart(instanceSize);
+    for (int i = 0; i < instanceSize; ++i) {
+        pathEnd[i] = i;
+        pathStart[i] = i;
+    }
+    int joinedEdges = 0;
+    for (const TSPEdge &edge : edges) {
+        if (joinedEdges == instanceSize - 1) {
+            break;
+        }
+        // Edge has to lead from the last city of one path to the first city of another one
+        if (nextCity[edge.i] != -1 || previousCity[edge.j] != -1 || pathStart[edge.i] == edge.j) {
             continue;
         }
-
-        cityOnPath[edgesList.front().i][0] = true;
-        cityOnPath[edgesList.front().j][1] = true;
-        edgesList.pop_front();
+        nextCity[edge.i] = edge.j;
+        previousCity[edge.j] = edge.i;
+        const int firstCity = pathStart[edge.i];
+        const int lastCity = pathEnd[edge.j];
+        pathEnd[firstCity] = lastCity;
+        pathStart[lastCity] = firstCity;
+        ++joinedEdges;
     }
-    for (const auto &vertex : partialPaths.front()) {
-        outSolution.emplace_back(vertex);
+
+    // Single path for complete graphs, otherwise paths are concatenated in order of their first cities
+    outSolution.reserve(instanceSize);
+    for (int firstCity = 0; firstCity < instanceSize; ++firstCity) {
+        if (previousCity[firstCity] != -1) {
+            continue;
+        }
+        for (int city = firstCity; city != -1; city = nextCity[city]) {
+            outSolution.emplace_back(city);
+        }
     }
     return TSPUtils::calculateTargetFunctionValue(tspInstance, outSolution);
 }
 
-int TSPGreedyAlgorithms::createNaturalPermutation(const IGraph *tspInstance, std::vector<int> &outSolution) {
-    for (int i = 0; i != tspInstance->getVertexCount(); ++i) {
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPGreedyAlgorithms::createNaturalPermutation(const TGraph &tspInstance, std::vector<int> &outSolution) {
+    for (int i = 0; i != tspInstance.getVertexCount(); ++i) {
         outSolution.emplace_back(i);
     }
     return TSPUtils::calculateTargetFunctionValue(tspInstance, outSolution);
 }
 
-int TSPGreedyAlgorithms::createRandomPermutation(const IGraph *tspInstance, std::vector<int> &outSolution) {
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPGreedyAlgorithms::createRandomPermutation(const TGraph &tspInstance, std::vector<int> &outSolution) {
     std::vector<int> availableCities;
     createNaturalPermutation(tspInstance, availableCities);
 
@@ -120,3 +228,12 @@ int TSPGreedyAlgorithms::createRandomPermutation(const IGraph *tspInstance, std:
     outSolution.emplace_back(availableCities[0]);
     return TSPUtils::calculateTargetFunctionValue(tspInstance, outSolution);
 }
+
+// Explicit instantiations for graph types handled by GraphDispatcher
+#define INSTANTIATE_GREEDY_ALGORITHMS(TGraph)                                                               \
+    template int TSPGreedyAlgorithms::nearestNeighbour<TGraph>(const TGraph &, std::vector<int> &);         \
+    template int TSPGreedyAlgorithms::greedy<TGraph>(const TGraph &, std::vector<int> &);                   \
+    template int TSPGreedyAlgorithms::createNaturalPermutation<TGraph>(const TGraph &, std::vector<int> &); \
+    template int TSPGreedyAlgorithms::createRandomPermutation<TGraph>(const TGraph &, std::vector<int> &);
+
+PEA_P1_FOR_EACH_DISPATCHED_GRAPH(INSTANTIATE_GREEDY_ALGORITHMS)
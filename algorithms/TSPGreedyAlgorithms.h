@@ -4,6 +4,8 @@
 #include "../utilities/TSPUtils.h"
 
 // outSolution is a permutation of vertices (not cycle) - MUST be provided (as an argument) empty
+// For SparseGraph nearestNeighbour and greedy visit existing edges only; if they cannot complete the tour,
+// missing edges are used (and the returned cost is std::numeric_limits<int>::max())
 class TSPGreedyAlgorithms {
 
 public:
@@ -15,7 +17,32 @@ public:
 
     static int createRandomPermutation(const IGraph *tspInstance, std::vector<int> &outSolution);
 
-    using fTSPAlgorithm = decltype(&nearestNeighbour);
+    // Variants taking the concrete graph type, so that edge lookups are not virtual calls
+    // Instantiated for IGraph and every graph type handled by GraphDispatcher
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int nearestNeighbour(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int greedy(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int createNaturalPermutation(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int createRandomPermutation(const TGraph &tspInstance, std::vector<int> &outSolution);
+
+    using fTSPAlgorithm = int (*)(const IGraph *tspInstance, std::vector<int> &outSolution);
+
+    // True if function is one of the IGraph * entry points above
+    static bool isTSPAlgorithm(fTSPAlgorithm function);
+
+private:
+
+    // Nearest neighbour scanning only rows of the sparse graph
+    static int sparseNearestNeighbour(const SparseGraph &tspInstance, std::vector<int> &outSolution);
+
+    // Nearest neighbour with rows computed in batches (see CoordinateGraph::computeCostRow())
+    static int coordinateNearestNeighbour(const CoordinateGraph &tspInstance, std::vector<int> &outSolution);
 };
 
 #endif //PEA_P1_TSPGREEDYALGORITHMS_H
@@ -1,10 +1,61 @@
 #include "TSPLocalSearchAlgorithms.h"
+#include "../structures/graphs/GraphDispatcher.h"
 
 //region Simulated annealing
 
 int TSPLocalSearchAlgorithms::simulatedAnnealing(const IGraph *tspInstance,
                                                  const LocalSearchParameters &parameters,
                                                  std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return simulatedAnnealing(graph, parameters, outSolution);
+    });
+}
+
+int TSPLocalSearchAlgorithms::tabuSearchList(const IGraph *tspInstance, const LocalSearchParameters &parameters,
+                                             std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return tabuSearchList(graph, parameters, outSolution);
+    });
+}
+
+int TSPLocalSearchAlgorithms::tabuSearchMatrix(const IGraph *tspInstance, const LocalSearchParameters &parameters,
+                                               std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return tabuSearchMatrix(graph, parameters, outSolution);
+    });
+}
+
+int TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue(const IGraph *tspInstance, int i, int j,
+                                                       const std::vector<int> &currentSolution,
+                                                       const std::vector<int> &nextSolution,
+                                                       int currentSolutionValue) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return swapNeighbourhoodTFValue(graph, i, j, currentSolution, nextSolution, currentSolutionValue);
+    });
+}
+
+int TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue(const IGraph *tspInstance, int i, int j,
+                                                         const std::vector<int> &currentSolution,
+                                                         const std::vector<int> &nextSolution,
+                                                         int currentSolutionValue) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return insertNeighbourhoodTFValue(graph, i, j, currentSolution, nextSolution, currentSolutionValue);
+    });
+}
+
+int TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue(const IGraph *tspInstance, int i, int j,
+                                                         const std::vector<int> &currentSolution,
+                                                         const std::vector<int> &nextSolution,
+                                                         int currentSolutionValue) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return invertNeighbourhoodTFValue(graph, i, j, currentSolution, nextSolution, currentSolutionValue);
+    });
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPLocalSearchAlgorithms::simulatedAnnealing(const TGraph &tspInstance,
+                                                 const LocalSearchParameters &parameters,
+                                                 std::vector<int> &outSolution) {
     if (parameters.initialTemperature <= 0 || parameters.coolingSchemeParameter <= 0
         || parameters.epochIterationsNumber <= 0 || parameters.iterationsNumber <= 0) {
         throw std::invalid_argument("Simulated annealing started with invalid parameters");
@@ -19,10 +70,7 @@ int TSPLocalSearchAlgorithms::simulatedAnnealing(const IGraph *tspInstance,
         && parameters.nextNeighbourFunction != TSPLocalSearchAlgorithms::invertNeighbourhood) {
         throw std::invalid_argument("Simulated annealing started with invalid neighbour designation function");
     }
-    if (parameters.initialSolutionFunction != TSPGreedyAlgorithms::createNaturalPermutation
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::createRandomPermutation
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::greedy
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::nearestNeighbour) {
+    if (!TSPGreedyAlgorithms::isTSPAlgorithm(parameters.initialSolutionFunction)) {
         throw std::invalid_argument("Tabu search started with invalid initial solution designation function");
     }
     if (parameters.coolingSchemeFunction == TSPLocalSearchAlgorithms::geometricCoolingScheme
@@ -30,7 +78,7 @@ int TSPLocalSearchAlgorithms::simulatedAnnealing(const IGraph *tspInstance,
         throw std::invalid_argument("Tabu search started with coolingSchemeParameter >= 1 for geometricCoolingScheme");
     }
 
-    const int instanceSize = tspInstance->getVertexCount();
+    const int instanceSize = tspInstance.getVertexCount();
 
     if (instanceSize <= 2) {
         return TSPGreedyAlgorithms::createNaturalPermutation(tspInstance, outSolution);
@@ -40,18 +88,18 @@ int TSPLocalSearchAlgorithms::simulatedAnnealing(const IGraph *tspInstance,
     TSPGreedyAlgorithms::fTSPAlgorithm designateInitialSolution = parameters.initialSolutionFunction;
     fNeighbourhood getNextNeighbour = parameters.nextNeighbourFunction;
 
-    fNeighbourhoodDiff calculateNextSolutionTargetFunctionValue = nullptr;
+    fGraphNeighbourhoodDiff<TGraph> calculateNextSolutionTargetFunctionValue = nullptr;
     if (getNextNeighbour == swapNeighbourhood) {
-        calculateNextSolutionTargetFunctionValue = swapNeighbourhoodTFValue;
+        calculateNextSolutionTargetFunctionValue = swapNeighbourhoodTFValue<TGraph>;
     } else if (getNextNeighbour == insertNeighbourhood) {
-        calculateNextSolutionTargetFunctionValue = insertNeighbourhoodTFValue;
+        calculateNextSolutionTargetFunctionValue = insertNeighbourhoodTFValue<TGraph>;
     } else {
-        calculateNextSolutionTargetFunctionValue = invertNeighbourhoodTFValue;
+        calculateNextSolutionTargetFunctionValue = invertNeighbourhoodTFValue<TGraph>;
     }
 
     std::vector<int> currentSolution, nextSolution, bestSolution;
     int currentSolutionValue, nextSolutionValue, bestSolutionValue;
-    currentSolutionValue = designateInitialSolution(tspInstance, currentSolution);
+    currentSolutionValue = designateInitialSolution(&tspInstance, currentSolution);
 
     bestSolution = currentSolution;
     bestSolutionValue = currentSolutionValue;
@@ -139,11 +187,12 @@ std::vector<int> TSPLocalSearchAlgorithms::swapNeighbourhood(int i, int j, std::
     return currentSolution;
 }
 
-int TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue(const IGraph *tspInstance, int i, int j,
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue(const TGraph &tspInstance, int i, int j,
                                                        const std::vector<int> &currentSolution,
                                                        const std::vector<int> &nextSolution,
                                                        int currentSolutionValue) {
-    const int lastVertexIdx = tspInstance->getVertexCount() - 1;
+    const int lastVertexIdx = tspInstance.getVertexCount() - 1;
     if (j < i) {
         std::swap(i, j);
     }
@@ -177,29 +226,29 @@ int TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue(const IGraph *tspInstance
     }
 
     if (i == 0 && j == lastVertexIdx) {
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[jLeft], nextSolution[j]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[jLeft], nextSolution[j]);
 
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[j], currentSolution[i]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[j], nextSolution[i]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[j], currentSolution[i]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[j], nextSolution[i]);
 
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[i], currentSolution[iRight]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[i], nextSolution[iRight]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[i], currentSolution[iRight]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[i], nextSolution[iRight]);
         return currentSolutionValue;
     }
 
-    currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[iLeft], currentSolution[i]);
-    currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[iLeft], nextSolution[i]);
+    currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[iLeft], currentSolution[i]);
+    currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[iLeft], nextSolution[i]);
 
-    currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[j], currentSolution[jRight]);
-    currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[j], nextSolution[jRight]);
+    currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[j], currentSolution[jRight]);
+    currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[j], nextSolution[jRight]);
 
-    currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[i], currentSolution[iRight]);
-    currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[i], nextSolution[iRight]);
+    currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[i], currentSolution[iRight]);
+    currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[i], nextSolution[iRight]);
 
     if (j - i != 1) {
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[jLeft], nextSolution[j]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[jLeft], nextSolution[j]);
     }
     return currentSolutionValue;
 }
@@ -211,11 +260,12 @@ std::vector<int> TSPLocalSearchAlgorithms::insertNeighbourhood(int i, int j, std
     return currentSolution;
 }
 
-int TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue(const IGraph *tspInstance, int i, int j,
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue(const TGraph &tspInstance, int i, int j,
                                                          const std::vector<int> &currentSolution,
                                                          const std::vector<int> &nextSolution,
                                                          int currentSolutionValue) {
-    const int lastVertexIdx = tspInstance->getVertexCount() - 1;
+    const int lastVertexIdx = tspInstance.getVertexCount() - 1;
 
     int iLeft;
     if (i == 0) {
@@ -250,24 +300,24 @@ int TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue(const IGraph *tspInstan
     }
 
     if (i < j) {
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[j], currentSolution[jRight]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[j], nextSolution[jRight]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[j], currentSolution[jRight]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[j], nextSolution[jRight]);
 
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[iLeft], currentSolution[i]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[iLeft], nextSolution[i]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[iLeft], currentSolution[i]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[iLeft], nextSolution[i]);
 
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[i], nextSolution[iRight]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[i], nextSolution[iRight]);
 
     } else {
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[jLeft], nextSolution[j]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[jLeft], currentSolution[j]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[jLeft], nextSolution[j]);
 
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[i], currentSolution[iRight]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[i], nextSolution[iRight]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[i], currentSolution[iRight]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[i], nextSolution[iRight]);
 
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[j], currentSolution[jRight]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[iLeft], nextSolution[i]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[j], currentSolution[jRight]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[iLeft], nextSolution[i]);
     }
     return currentSolutionValue;
 }
@@ -291,11 +341,12 @@ std::vector<int> TSPLocalSearchAlgorithms::invertNeighbourhood(int i, int j, std
     return currentSolution;
 }
 
-int TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue(const IGraph *tspInstance, int i, int j,
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue(const TGraph &tspInstance, int i, int j,
                                                          const std::vector<int> &currentSolution,
                                                          const std::vector<int> &nextSolution,
                                                          int currentSolutionValue) {
-    const int lastVertexIdx = tspInstance->getVertexCount() - 1;
+    const int lastVertexIdx = tspInstance.getVertexCount() - 1;
     if (j < i) {
         std::swap(i, j);
     }
@@ -334,8 +385,8 @@ int TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue(const IGraph *tspInstan
 
     int idxL = iLeft;
     int idxR = i;
-    currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[idxL], currentSolution[idxR]);
-    currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[idxL], nextSolution[idxR]);
+    currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[idxL], currentSolution[idxR]);
+    currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[idxL], nextSolution[idxR]);
     if (idxL == lastVertexIdx) {
         idxL = 0;
     } else {
@@ -343,13 +394,13 @@ int TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue(const IGraph *tspInstan
     }
     ++idxR;
     while (idxR != j + 1) {
-        currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[idxL], currentSolution[idxR]);
-        currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[idxL], nextSolution[idxR]);
+        currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[idxL], currentSolution[idxR]);
+        currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[idxL], nextSolution[idxR]);
         ++idxL;
         ++idxR;
     }
-    currentSolutionValue -= tspInstance->getEdgeParameter(currentSolution[j], currentSolution[jRight]);
-    currentSolutionValue += tspInstance->getEdgeParameter(nextSolution[j], nextSolution[jRight]);
+    currentSolutionValue -= tspInstance.getEdgeParameter(currentSolution[j], currentSolution[jRight]);
+    currentSolutionValue += tspInstance.getEdgeParameter(nextSolution[j], nextSolution[jRight]);
 
     return currentSolutionValue;
 }
@@ -360,7 +411,8 @@ double TSPLocalSearchAlgorithms::sigmoidFunction(double x) {
 
 //endregion
 
-int TSPLocalSearchAlgorithms::tabuSearchList(const IGraph *tspInstance, const LocalSearchParameters &parameters,
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPLocalSearchAlgorithms::tabuSearchList(const TGraph &tspInstance, const LocalSearchParameters &parameters,
                                              std::vector<int> &outSolution) {
     if (parameters.iterationsNumber <= 0 || parameters.tabuListSize <= 0 || parameters.cadenzaLengthParameter <= 0
         || parameters.iterationsWithoutImprovementToRestart <= 0 || parameters.patternsNumberToCache <= 0) {
@@ -371,14 +423,11 @@ int TSPLocalSearchAlgorithms::tabuSearchList(const IGraph *tspInstance, const Lo
         && parameters.nextNeighbourFunction != TSPLocalSearchAlgorithms::invertNeighbourhood) {
         throw std::invalid_argument("Tabu search started with invalid neighbour designation function");
     }
-    if (parameters.initialSolutionFunction != TSPGreedyAlgorithms::createNaturalPermutation
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::createRandomPermutation
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::greedy
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::nearestNeighbour) {
+    if (!TSPGreedyAlgorithms::isTSPAlgorithm(parameters.initialSolutionFunction)) {
         throw std::invalid_argument("Tabu search started with invalid initial solution designation function");
     }
 
-    const int instanceSize = tspInstance->getVertexCount();
+    const int instanceSize = tspInstance.getVertexCount();
     if (instanceSize <= 2) {
         return TSPGreedyAlgorithms::createNaturalPermutation(tspInstance, outSolution);
     }
@@ -387,17 +436,17 @@ int TSPLocalSearchAlgorithms::tabuSearchList(const IGraph *tspInstance, const Lo
 
     std::vector<int> currentSolution, nextSolution, neighbourSolution, bestSolution;
     int currentSolutionValue, nextSolutionValue, neighbourSolutionValue, bestSolutionValue;
-    currentSolutionValue = parameters.initialSolutionFunction(tspInstance, currentSolution);
+    currentSolutionValue = parameters.initialSolutionFunction(&tspInstance, currentSolution);
     bestSolution = currentSolution;
     bestSolutionValue = currentSolutionValue;
 
-    TSPLocalSearchAlgorithms::fNeighbourhoodDiff nextSolutionTFValue;
+    TSPLocalSearchAlgorithms::fGraphNeighbourhoodDiff<TGraph> nextSolutionTFValue;
     if (parameters.nextNeighbourFunction == TSPLocalSearchAlgorithms::swapNeighbourhood) {
-        nextSolutionTFValue = TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue;
+        nextSolutionTFValue = TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue<TGraph>;
     } else if (parameters.nextNeighbourFunction == TSPLocalSearchAlgorithms::insertNeighbourhood) {
-        nextSolutionTFValue = TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue;
+        nextSolutionTFValue = TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue<TGraph>;
     } else {
-        nextSolutionTFValue = TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue;
+        nextSolutionTFValue = TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue<TGraph>;
     }
 
     // ((i, j), cadenza)
@@ -508,7 +557,8 @@ int TSPLocalSearchAlgorithms::tabuSearchList(const IGraph *tspInstance, const Lo
     return bestSolutionValue;
 }
 
-int TSPLocalSearchAlgorithms::tabuSearchMatrix(const IGraph *tspInstance, const LocalSearchParameters &parameters,
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPLocalSearchAlgorithms::tabuSearchMatrix(const TGraph &tspInstance, const LocalSearchParameters &parameters,
                                                std::vector<int> &outSolution) {
     if (parameters.iterationsNumber <= 0 || parameters.tabuListSize <= 0 || parameters.cadenzaLengthParameter <= 0
         || parameters.iterationsWithoutImprovementToRestart <= 0 || parameters.patternsNumberToCache <= 0) {
@@ -519,14 +569,11 @@ int TSPLocalSearchAlgorithms::tabuSearchMatrix(const IGraph *tspInstance, const
         && parameters.nextNeighbourFunction != TSPLocalSearchAlgorithms::invertNeighbourhood) {
         throw std::invalid_argument("Tabu search started with invalid neighbour designation function");
     }
-    if (parameters.initialSolutionFunction != TSPGreedyAlgorithms::createNaturalPermutation
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::createRandomPermutation
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::greedy
-        && parameters.initialSolutionFunction != TSPGreedyAlgorithms::nearestNeighbour) {
+    if (!TSPGreedyAlgorithms::isTSPAlgorithm(parameters.initialSolutionFunction)) {
         throw std::invalid_argument("Tabu search started with invalid initial solution designation function");
     }
 
-    const int instanceSize = tspInstance->getVertexCount();
+    const int instanceSize = tspInstance.getVertexCount();
     if (instanceSize <= 2) {
         return TSPGreedyAlgorithms::createNaturalPermutation(tspInstance, outSolution);
     }
@@ -535,17 +582,17 @@ int TSPLocalSearchAlgorithms::tabuSearchMatrix(const IGraph *tspInstance, const
 
     std::vector<int> currentSolution, nextSolution, neighbourSolution, bestSolution;
     int currentSolutionValue, nextSolutionValue, neighbourSolutionValue, bestSolutionValue;
-    currentSolutionValue = parameters.initialSolutionFunction(tspInstance, currentSolution);
+    currentSolutionValue = parameters.initialSolutionFunction(&tspInstance, currentSolution);
     bestSolution = currentSolution;
     bestSolutionValue = currentSolutionValue;
 
-    TSPLocalSearchAlgorithms::fNeighbourhoodDiff nextSolutionTFValue;
+    TSPLocalSearchAlgorithms::fGraphNeighbourhoodDiff<TGraph> nextSolutionTFValue;
     if (parameters.nextNeighbourFunction == TSPLocalSearchAlgorithms::swapNeighbourhood) {
-        nextSolutionTFValue = TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue;
+        nextSolutionTFValue = TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue<TGraph>;
     } else if (parameters.nextNeighbourFunction == TSPLocalSearchAlgorithms::insertNeighbourhood) {
-        nextSolutionTFValue = TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue;
+        nextSolutionTFValue = TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue<TGraph>;
     } else {
-        nextSolutionTFValue = TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue;
+        nextSolutionTFValue = TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue<TGraph>;
     }
 
     // [i][j] = cadenza
@@ -657,4 +704,22 @@ int TSPLocalSearchAlgorithms::tabuSearchMatrix(const IGraph *tspInstance, const
     return bestSolutionValue;
 }
 
-
+// Explicit instantiations for graph types handled by GraphDispatcher
+#define INSTANTIATE_LOCAL_SEARCH_ALGORITHMS(TGraph)                                                                  \
+    template int TSPLocalSearchAlgorithms::simulatedAnnealing<TGraph>(const TGraph &, const LocalSearchParameters &, \
+                                                                      std::vector<int> &);                           \
+    template int TSPLocalSearchAlgorithms::tabuSearchList<TGraph>(const TGraph &, const LocalSearchParameters &,     \
+                                                                  std::vector<int> &);                               \
+    template int TSPLocalSearchAlgorithms::tabuSearchMatrix<TGraph>(const TGraph &, const LocalSearchParameters &,   \
+                                                                    std::vector<int> &);                             \
+    template int TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue<TGraph>(const TGraph &, int, int,                \
+                                                                            const std::vector<int> &,                \
+                                                                            const std::vector<int> &, int);          \
+    template int TSPLocalSearchAlgorithms::insertNeighbourhoodTFValue<TGraph>(const TGraph &, int, int,              \
+                                                                              const std::vector<int> &,              \
+                                                                              const std::vector<int> &, int);        \
+    template int TSPLocalSearchAlgorithms::invertNeighbourhoodTFValue<TGraph>(const TGraph &, int, int,              \
+                                                                              const std::vector<int> &,              \
+                                                                              const std::vector<int> &, int);
+
+PEA_P1_FOR_EACH_DISPATCHED_GRAPH(INSTANTIATE_LOCAL_SEARCH_ALGORITHMS)
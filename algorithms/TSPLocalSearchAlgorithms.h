@@ -28,7 +28,22 @@ public:
     static int tabuSearchMatrix(const IGraph *tspInstance, const LocalSearchParameters &parameters,
                               std::vector<int> &outSolution);
 
-    using fLocalSearchAlgorithm = decltype(&simulatedAnnealing);
+    // Variants taking the concrete graph type, so that edge lookups are not virtual calls
+    // Instantiated for IGraph and every graph type handled by GraphDispatcher
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int simulatedAnnealing(const TGraph &tspInstance, const LocalSearchParameters &parameters,
+                                  std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int tabuSearchList(const TGraph &tspInstance, const LocalSearchParameters &parameters,
+                              std::vector<int> &outSolution);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int tabuSearchMatrix(const TGraph &tspInstance, const LocalSearchParameters &parameters,
+                                std::vector<int> &outSolution);
+
+    using fLocalSearchAlgorithm = int (*)(const IGraph *tspInstance, const LocalSearchParameters &parameters,
+                                          std::vector<int> &outSolution);
 
     // initialTemperature > 0, parameter > 0
     [[nodiscard]] static double
@@ -66,11 +81,38 @@ public:
                                                         const std::vector<int> &nextSolution,
                                                         int currentSolutionValue);
 
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    [[nodiscard]] static int swapNeighbourhoodTFValue(const TGraph &tspInstance, int i, int j,
+                                                      const std::vector<int> &currentSolution,
+                                                      const std::vector<int> &nextSolution,
+                                                      int currentSolutionValue);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    [[nodiscard]] static int insertNeighbourhoodTFValue(const TGraph &tspInstance, int i, int j,
+                                                        const std::vector<int> &currentSolution,
+                                                        const std::vector<int> &nextSolution,
+                                                        int currentSolutionValue);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    [[nodiscard]] static int invertNeighbourhoodTFValue(const TGraph &tspInstance, int i, int j,
+                                                        const std::vector<int> &currentSolution,
+                                                        const std::vector<int> &nextSolution,
+                                                        int currentSolutionValue);
+
     [[nodiscard]] static double sigmoidFunction(double x);
 
     using fCoolingScheme = decltype(&geometricCoolingScheme);
     using fNeighbourhood = decltype(&swapNeighbourhood);
-    using fNeighbourhoodDiff = decltype(&swapNeighbourhoodTFValue);
+    using fNeighbourhoodDiff = int (*)(const IGraph *tspInstance, int i, int j,
+                                       const std::vector<int> &currentSolution,
+                                       const std::vector<int> &nextSolution,
+                                       int currentSolutionValue);
+
+    template<class TGraph>
+    using fGraphNeighbourhoodDiff = int (*)(const TGraph &tspInstance, int i, int j,
+                                            const std::vector<int> &currentSolution,
+                                            const std::vector<int> &nextSolution,
+                                            int currentSolutionValue);
 
     friend class LocalSearchParameters;
 };
@@ -2,12 +2,21 @@
 #include "../utilities/TSPUtils.h"
 #include "../utilities/Random.h"
 #include "helper_structures/LocalSearchParameters.h"
+#include "../structures/graphs/GraphDispatcher.h"
 
 
 int TSPPopulationAlgorithms::geneticAlgorithm(const IGraph *tspInstance, const GeneticAlgorithmParameters &parameters,
                                               std::vector<int> &outSolution) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return geneticAlgorithm(graph, parameters, outSolution);
+    });
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPPopulationAlgorithms::geneticAlgorithm(const TGraph &tspInstance, const GeneticAlgorithmParameters &parameters,
+                                              std::vector<int> &outSolution) {
 
-    const int INSTANCE_SIZE = tspInstance->getVertexCount();
+    const int INSTANCE_SIZE = tspInstance.getVertexCount();
 
     if (INSTANCE_SIZE <= 2) {
         return TSPGreedyAlgorithms::createNaturalPermutation(tspInstance, outSolution);
@@ -49,7 +58,7 @@ int TSPPopulationAlgorithms::geneticAlgorithm(const IGraph *tspInstance, const G
     std::vector<Specimen> population, selected, elites;
     Specimen bestSpecimen;
 
-    createPopulation(tspInstance, parameters.populationSize, bestSpecimen, population);
+    createPopulation(&tspInstance, parameters.populationSize, bestSpecimen, population);
 
     for (int generation = 0; generation < parameters.nGenerations; ++generation) {
         if (performSelection == TSPPopulationAlgorithms::tournamentSelection) {
@@ -305,4 +314,11 @@ void TSPPopulationAlgorithms::OX(std::vector<int> &s1, std::vector<int> &s2) {
 
     s1 = std::vector<int>(c1.begin(), c1.end());
     s2 = std::vector<int>(c2.begin(), c2.end());
-}
\ No newline at end of file
+}
+
+// Explicit instantiations for graph types handled by GraphDispatcher
+#define INSTANTIATE_GENETIC_ALGORITHM(TGraph)                                                                          \
+    template int TSPPopulationAlgorithms::geneticAlgorithm<TGraph>(const TGraph &, const GeneticAlgorithmParameters &, \
+                                                                    std::vector<int> &);
+
+PEA_P1_FOR_EACH_DISPATCHED_GRAPH(INSTANTIATE_GENETIC_ALGORITHM)
@@ -16,6 +16,12 @@ public:
     static int geneticAlgorithm(const IGraph *tspInstance, const GeneticAlgorithmParameters &parameters,
                                 std::vector<int> &outSolution);
 
+    // Variant taking the concrete graph type, so that edge lookups are not virtual calls
+    // Instantiated for IGraph and every graph type handled by GraphDispatcher
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int geneticAlgorithm(const TGraph &tspInstance, const GeneticAlgorithmParameters &parameters,
+                                std::vector<int> &outSolution);
+
     using TSelectionFunction = void (*)(const std::vector<Specimen> &population, std::vector<Specimen> &selected,
                                         int parameter);
     using TMutationCore = void (*)(int i, int j, std::vector<int> &specimenPermutation);
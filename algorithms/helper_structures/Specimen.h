@@ -1,6 +1,7 @@
 #ifndef PEA_P1_SPECIMEN_H
 #define PEA_P1_SPECIMEN_H
 
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -1,6 +1,9 @@
 #ifndef PEA_P1_TSPHELPERSTRUCTURES_H
 #define PEA_P1_TSPHELPERSTRUCTURES_H
 
+#include <atomic>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <list>
 
@@ -26,12 +29,21 @@ struct EdgeCities {
     EdgeCities(int i, int j) : i(i), j(j) {}
 };
 
-struct BBNodeData {
-    // ATSP distances
-    std::vector<std::vector<int>> distances;
+// Node of branch and bound tree (Little's algorithm), allocated from a slab arena (PooledNodeAllocator)
+// Only the branching decision is stored - reduced matrix and partial paths of a node are rebuilt by replaying
+// decisions of its ancestors (see TSPExactAlgorithms::bbRestoreNode()), so an open node takes O(1) memory
+// instead of O(n^2); ancestors are shared by their subtrees and freed with the last of their descendants
+struct BBNode {
+    // nullptr for the root
+    BBNode *parent;
 
-    // Partial paths already added to possible solution
-    std::vector<std::list<int>> partialPaths;
+    // Children referring to the node, plus 1 while the node itself is open - the node is freed at 0
+    std::atomic<int> nReferences;
+
+    // Edge excluded from the path (left node) or included into it (right node) by the node
+    EdgeCities branchingEdge;
+
+    bool isEdgeIncluded;
 
     // Number of already added edges to the path (maximum = instanceSize)
     int edgesOnPath;
@@ -39,25 +51,59 @@ struct BBNodeData {
     // True if the node can't be processed further, otherwise false
     bool isFinal;
 
-    // Indexes of 0 with the highest penalty in distances
+    // Indexes of 0 with the highest penalty in the reduced matrix - edge branched on by children
     EdgeCities highestZeroPenaltiesIndexes;
 
-    // Highest penalty of 0
-    int highestZeroPenalty;
-
     // Current lower bound
     int lowerBound;
 
-    BBNodeData() { init(); }
+    // Arena the node comes from (parallel search keeps one per worker)
+    unsigned int arenaIdx;
 
-    explicit BBNodeData(int instanceSize) : distances(instanceSize, std::vector<int>(instanceSize)) { init(); }
+    BBNode(BBNode *parent, EdgeCities branchingEdge, bool isEdgeIncluded, unsigned int arenaIdx = 0)
+            : parent(parent), nReferences(1), branchingEdge(branchingEdge), isEdgeIncluded(isEdgeIncluded),
+              edgesOnPath((parent != nullptr) ? parent->edgesOnPath : 0), isFinal(false),
+              lowerBound((parent != nullptr) ? parent->lowerBound : 0), arenaIdx(arenaIdx) {
+    }
+};
 
-private:
-    void init() {
-        edgesOnPath = 0;
-        isFinal = false;
-        highestZeroPenalty = 0;
-        lowerBound = 0;
+// Buffers of branch and bound reused for every expanded node
+struct BBWorkspace {
+    int instanceSize;
+
+    // Row-major reduced matrices - of the root, of the restored node and of its child being evaluated
+    std::vector<int> rootDistances;
+    std::vector<int> distances;
+    std::vector<int> childDistances;
+
+    // Zeros in every row and column of rootDistances and distances - replay reduces only lines which lost all
+    std::vector<int> rootRowZeroCounts;
+    std::vector<int> rootColumnZeroCounts;
+    std::vector<int> rowZeroCounts;
+    std::vector<int> columnZeroCounts;
+
+    // Lines which lost a zero in the replayed decision
+    std::vector<int> touchedRows;
+    std::vector<int> touchedColumns;
+
+    // Partial paths of the restored node - first vertex of the path ending at v, last vertex of the path
+    // starting at v and successor of v (-1 if none)
+    std::vector<int> pathStarts;
+    std::vector<int> pathEnds;
+    std::vector<int> successors;
+
+    // Restored node and its ancestors, without the root
+    std::vector<const BBNode *> nodePath;
+
+    // pair: <Indexes of zero, penalty>
+    std::vector<std::pair<EdgeCities, int>> matrixZeroes;
+
+    explicit BBWorkspace(int instanceSize)
+            : instanceSize(instanceSize), rootDistances(instanceSize * instanceSize),
+              distances(instanceSize * instanceSize), childDistances(instanceSize * instanceSize),
+              rootRowZeroCounts(instanceSize), rootColumnZeroCounts(instanceSize), rowZeroCounts(instanceSize),
+              columnZeroCounts(instanceSize), pathStarts(instanceSize), pathEnds(instanceSize),
+              successors(instanceSize) {
     }
 };
 
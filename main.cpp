@@ -1,17 +1,70 @@
+#include "tests/TableTest.h"
+#include "tests/DoublyLinkedListTest.h"
 #include "tests/ListGraphTest.h"
+#include "tests/DistanceMatrixTest.h"
+#include "tests/QuantizedMatrixTest.h"
+#include "tests/TriangularMatrixTest.h"
+#include "tests/SparseGraphTest.h"
+#include "tests/TiledMatrixTest.h"
+#include "tests/InstanceParserTest.h"
+#include "tests/BinaryInstanceTest.h"
+#include "tests/TSPLIBInstanceTest.h"
+#include "tests/InstanceRegistryTest.h"
+#include "tests/MappedMatrixTest.h"
+#include "tests/GraphBuilderTest.h"
 #include "tests/TSPAlgorithmsTest.h"
 #include "tests/MiscellaneousTests.h"
 #include "menu/ConsoleMenu.h"
 #include "time_tests/TimeMeasurement.h"
+#include "time_tests/PerformanceBenchmark.h"
 #include "parameter_analysis/local_search/LSParameterAnalysis.h"
 #include "parameter_analysis/populational_algorithms/GAParameterAnalysis.h"
 
 
 int main() {
 
+//    TableTest tt;
+//    tt.run();
+
+//    DoublyLinkedListTest dllt;
+//    dllt.run();
+
 //    ListGraphTest lgt;
 //    lgt.run();
 
+//    DistanceMatrixTest dmt;
+//    dmt.run();
+
+//    QuantizedMatrixTest qmt;
+//    qmt.run();
+
+//    TriangularMatrixTest tmt;
+//    tmt.run();
+
+//    SparseGraphTest sgt;
+//    sgt.run();
+
+//    TiledMatrixTest tlmt;
+//    tlmt.run();
+
+//    InstanceParserTest ipt;
+//    ipt.run();
+
+//    BinaryInstanceTest bit;
+//    bit.run();
+
+//    TSPLIBInstanceTest tlit;
+//    tlit.run();
+
+//    InstanceRegistryTest irt;
+//    irt.run();
+
+//    MappedMatrixTest mmt;
+//    mmt.run();
+
+//    GraphBuilderTest gbt;
+//    gbt.run();
+
     TSPAlgorithmsTest tspAlgorithmsTest;
     tspAlgorithmsTest.run();
 
@@ -27,6 +80,10 @@ int main() {
 //    TimeMeasurement tm;
 //    tm.run();
 
+//    PerformanceBenchmark pb;
+//    pb.run();
+//    pb.benchmarkMinPlusKernels();
+
 //    GAParameterAnalysis gaParameterAnalysis;
 //    gaParameterAnalysis.run();
 
@@ -93,13 +93,14 @@ ConsoleMenu::ProgramState ConsoleMenu::chooseMenuOperation(const std::string &me
         /////////////////////////////////////////////////////////////////
     } else if (operationCode == "1") {
         std::string path, instanceName;
+        TSPUtils::TSPType tspType;
 
         cout << "Enter path to the instance:";
         cin >> path;
 
         IGraph *tmpTSPInstance = tspInstance;
         try {
-            instanceName = TSPUtils::loadTSPInstance(&tspInstance, path);
+            instanceName = TSPUtils::loadTSPInstanceDetectType(&tspInstance, path, tspType);
         } catch (const std::invalid_argument &e) {
             cout << e.what() << endl;
             return ProgramState::RUNNING;
@@ -108,7 +109,7 @@ ConsoleMenu::ProgramState ConsoleMenu::chooseMenuOperation(const std::string &me
 
         cout << "Instance \"" + instanceName + "\" has been loaded!" << endl;
         cout << "TSP type: "
-             << ((TSPUtils::getTSPType(path) == TSPUtils::TSPType::Asymmetric) ? "Asymmetric" : "Symmetric") << endl;
+             << ((tspType == TSPUtils::TSPType::Asymmetric) ? "Asymmetric" : "Symmetric") << endl;
 //        cout << tspInstance->toString() << endl;
 
     } else if (operationCode == "2") {
@@ -173,19 +173,16 @@ std::map<std::string, std::vector<std::string>> LSParameterAnalysis::getInstance
     return fileGroups;
 }
 
-std::vector<std::pair<IGraph *, int>>
+std::vector<std::pair<std::shared_ptr<const IGraph>, int>>
 LSParameterAnalysis::loadInstances(const std::map<std::string, std::vector<std::string>> &instancePaths) {
-    std::vector<std::pair<IGraph *, int>> tspInstances;
-    IGraph *instance = nullptr;
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances;
     std::map<std::string, int> optimalSolutions;
     std::string instancePath;
     for (const auto &fileGroup : instancePaths) {
         optimalSolutions = TSPUtils::loadTSPSolutionValuesAbsolutePath(fileGroup.first + '/' + fileGroup.second[0]);
         for (int i = 1; i < fileGroup.second.size(); ++i) {
             instancePath = fileGroup.first + '/' + fileGroup.second[i];
-            TSPUtils::loadTSPInstanceAbsolutePath(&instance, instancePath,
-                                                  TSPUtils::getTSPTypeAbsolutePath(instancePath));
-            tspInstances.emplace_back(instance,
+            tspInstances.emplace_back(instanceRegistry.getAbsolutePath(instancePath),
                                       optimalSolutions.at(
                                               fileGroup.second[i].substr(0, fileGroup.second[i].find('.'))));
         }
@@ -214,7 +211,7 @@ LSParameterAnalysis::performSimulatedAnnealingParameterRangeTests(LocalSearchPar
             break;
     }
     std::cout << "SA: " << parameterName << " analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     LocalSearchParameters parameters;
     std::vector<int> tmpSolution;
@@ -255,7 +252,7 @@ LSParameterAnalysis::performSimulatedAnnealingParameterRangeTests(LocalSearchPar
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first, parameters,
+                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first.get(), parameters,
                                                                                 tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -282,10 +279,6 @@ LSParameterAnalysis::performSimulatedAnnealingParameterRangeTests(LocalSearchPar
     writeResultsToFile("simulated_annealing", parameterAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "SA: " << parameterName << " analysis DONE" << std::endl;
 }
 
@@ -302,7 +295,7 @@ void LSParameterAnalysis::performSimulatedAnnealingCoolingSchemeParameterTests(
     }
 
     std::cout << "SA: " << coolingSchemeName << " parameter analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     LocalSearchParameters parameters;
     std::vector<int> tmpSolution;
@@ -331,7 +324,7 @@ void LSParameterAnalysis::performSimulatedAnnealingCoolingSchemeParameterTests(
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first, parameters,
+                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first.get(), parameters,
                                                                                 tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -358,10 +351,6 @@ void LSParameterAnalysis::performSimulatedAnnealingCoolingSchemeParameterTests(
     writeResultsToFile("simulated_annealing", coolingParameterAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "SA: " << coolingSchemeName << " parameter analysis DONE" << std::endl;
 }
 
@@ -374,7 +363,7 @@ void LSParameterAnalysis::performSimulatedAnnealingInitialSolutionTests(int nRep
     };
 
     std::cout << "SA: initial solution algorithm analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     LocalSearchParameters parameters;
     std::vector<int> tmpSolution;
@@ -400,7 +389,7 @@ void LSParameterAnalysis::performSimulatedAnnealingInitialSolutionTests(int nRep
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first, parameters,
+                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first.get(), parameters,
                                                                                 tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -427,10 +416,6 @@ void LSParameterAnalysis::performSimulatedAnnealingInitialSolutionTests(int nRep
     writeResultsToFile("simulated_annealing", initialSolutionAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "SA: initial solution algorithm analysis DONE" << std::endl;
 }
 
@@ -442,7 +427,7 @@ void LSParameterAnalysis::performSimulatedAnnealingNeighbourhoodTests(int nRepet
     };
 
     std::cout << "SA: neighbourhood algorithm analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     LocalSearchParameters parameters;
     std::vector<int> tmpSolution;
@@ -468,7 +453,7 @@ void LSParameterAnalysis::performSimulatedAnnealingNeighbourhoodTests(int nRepet
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first, parameters,
+                tmpSolutionValue = TSPLocalSearchAlgorithms::simulatedAnnealing(tspInstance.first.get(), parameters,
                                                                                 tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -495,10 +480,6 @@ void LSParameterAnalysis::performSimulatedAnnealingNeighbourhoodTests(int nRepet
     writeResultsToFile("simulated_annealing", neighbourhoodAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "SA: neighbourhood algorithm analysis DONE" << std::endl;
 }
 
@@ -527,7 +508,7 @@ LSParameterAnalysis::performTabuSearchParameterRangeTests(LocalSearchParameters:
             break;
     }
     std::cout << "TS: " << parameterName << " analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     LocalSearchParameters parameters;
     std::vector<int> tmpSolution;
@@ -574,7 +555,7 @@ LSParameterAnalysis::performTabuSearchParameterRangeTests(LocalSearchParameters:
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPLocalSearchAlgorithms::tabuSearchList(tspInstance.first, parameters,
+                tmpSolutionValue = TSPLocalSearchAlgorithms::tabuSearchList(tspInstance.first.get(), parameters,
                                                                             tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -601,10 +582,6 @@ LSParameterAnalysis::performTabuSearchParameterRangeTests(LocalSearchParameters:
     writeResultsToFile("tabu_search_list", parameterAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "TS: " << parameterName << " analysis DONE" << std::endl;
 }
 
@@ -617,7 +594,7 @@ void LSParameterAnalysis::performTabuSearchInitialSolutionTests(int nRepetitions
     };
 
     std::cout << "TS: initial solution algorithm analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     LocalSearchParameters parameters;
     std::vector<int> tmpSolution;
@@ -643,7 +620,7 @@ void LSParameterAnalysis::performTabuSearchInitialSolutionTests(int nRepetitions
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPLocalSearchAlgorithms::tabuSearchList(tspInstance.first, parameters,
+                tmpSolutionValue = TSPLocalSearchAlgorithms::tabuSearchList(tspInstance.first.get(), parameters,
                                                                             tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -670,10 +647,6 @@ void LSParameterAnalysis::performTabuSearchInitialSolutionTests(int nRepetitions
     writeResultsToFile("tabu_search_list", initialSolutionAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "TS: initial solution algorithm analysis DONE" << std::endl;
 }
 
@@ -685,7 +658,7 @@ void LSParameterAnalysis::performTabuSearchNeighbourhoodTests(int nRepetitions)
     };
 
     std::cout << "TS: neighbourhood algorithm analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     LocalSearchParameters parameters;
     std::vector<int> tmpSolution;
@@ -711,7 +684,7 @@ void LSParameterAnalysis::performTabuSearchNeighbourhoodTests(int nRepetitions)
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPLocalSearchAlgorithms::tabuSearchList(tspInstance.first, parameters,
+                tmpSolutionValue = TSPLocalSearchAlgorithms::tabuSearchList(tspInstance.first.get(), parameters,
                                                                             tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -738,26 +711,23 @@ void LSParameterAnalysis::performTabuSearchNeighbourhoodTests(int nRepetitions)
     writeResultsToFile("tabu_search_list", neighbourhoodAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "TS: neighbourhood algorithm analysis DONE" << std::endl;
 }
 
 void LSParameterAnalysis::performTimeBenchmark(TSPLocalSearchAlgorithms::fLocalSearchAlgorithm algorithm,
                                                LocalSearchParameters parameters, int nRepetitions) {
     std::string algorithmName;
-    if (algorithm == TSPLocalSearchAlgorithms::simulatedAnnealing) {
+    using fLocalSearchAlgorithm = TSPLocalSearchAlgorithms::fLocalSearchAlgorithm;
+    if (algorithm == static_cast<fLocalSearchAlgorithm>(TSPLocalSearchAlgorithms::simulatedAnnealing)) {
         algorithmName = "simulated_annealing";
-    } else if (algorithm == TSPLocalSearchAlgorithms::tabuSearchList) {
+    } else if (algorithm == static_cast<fLocalSearchAlgorithm>(TSPLocalSearchAlgorithms::tabuSearchList)) {
         algorithmName = "tabu_search_list";
     } else {
         algorithmName = "tabu_search_matrix";
     }
 
     std::cout << algorithmName << ": time benchmark START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePathsTimeTests());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePathsTimeTests());
 
     std::vector<int> tmpSolution;
     int tmpSolutionValue, bestSolutionValue;
@@ -779,7 +749,7 @@ void LSParameterAnalysis::performTimeBenchmark(TSPLocalSearchAlgorithms::fLocalS
             tmpSolution.clear();
 
             start = std::chrono::high_resolution_clock::now();
-            tmpSolutionValue = algorithm(tspInstance.first, parameters, tmpSolution);
+            tmpSolutionValue = algorithm(tspInstance.first.get(), parameters, tmpSolution);
             finish = std::chrono::high_resolution_clock::now();
             elapsed = finish - start;
             timePoint.time += elapsed.count();
@@ -804,9 +774,5 @@ void LSParameterAnalysis::performTimeBenchmark(TSPLocalSearchAlgorithms::fLocalS
     writeResultsToFile(algorithmName, timeAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << algorithmName << ": time benchmark DONE" << std::endl;
 }
\ No newline at end of file
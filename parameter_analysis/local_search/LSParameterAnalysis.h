@@ -4,9 +4,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 #include "../../structures/graphs/IGraph.h"
 #include "../../algorithms/TSPLocalSearchAlgorithms.h"
 #include "../AnalysisPoint.h"
+#include "../../utilities/InstanceRegistry.h"
 #include <algorithm>
 #include <fstream>
 
@@ -36,10 +38,13 @@ private:
 
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getInstancePaths() const;
 
-    // <instance, optimal solution>
-    std::vector<std::pair<IGraph *, int>>
+    // <instance, optimal solution>, instances are shared through instanceRegistry
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>>
     loadInstances(const std::map<std::string, std::vector<std::string>> &instancePaths);
 
+    // Instances stay loaded between the analyses of one run()
+    InstanceRegistry instanceRegistry;
+
     template<class T>
     void
     writeResultsToFile(const std::string &algorithm, std::vector<AnalysisPoint<T>> &analysisPoints, int nRepetitions) {
@@ -57,7 +57,7 @@ GAParameterAnalysis::performGeneticAlgorithmParameterRangeTests(GeneticAlgorithm
             break;
     }
     std::cout << "GA: " << parameterName << " analysis START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePaths());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePaths());
 
     GeneticAlgorithmParameters parameters;
     std::vector<int> tmpSolution;
@@ -108,7 +108,7 @@ GAParameterAnalysis::performGeneticAlgorithmParameterRangeTests(GeneticAlgorithm
                 tmpSolution.clear();
 
                 start = std::chrono::high_resolution_clock::now();
-                tmpSolutionValue = TSPPopulationAlgorithms::geneticAlgorithm(tspInstance.first, parameters,
+                tmpSolutionValue = TSPPopulationAlgorithms::geneticAlgorithm(tspInstance.first.get(), parameters,
                                                                              tmpSolution);
                 finish = std::chrono::high_resolution_clock::now();
                 elapsed = finish - start;
@@ -135,10 +135,6 @@ GAParameterAnalysis::performGeneticAlgorithmParameterRangeTests(GeneticAlgorithm
     writeResultsToFile("genetic_algorithm", parameterAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << "GA: " << parameterName << " analysis DONE" << std::endl;
 }
 
@@ -147,7 +143,7 @@ void GAParameterAnalysis::performTimeBenchmark(const std::string &testName, Gene
     std::string algorithmName = "genetic_algorithm";
 
     std::cout << algorithmName << '_' << testName << ": time benchmark START" << std::endl;
-    std::vector<std::pair<IGraph *, int>> tspInstances = loadInstances(getInstancePathsTimeTests());
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances = loadInstances(getInstancePathsTimeTests());
 
     std::vector<int> tmpSolution;
     int tmpSolutionValue, bestSolutionValue;
@@ -169,7 +165,7 @@ void GAParameterAnalysis::performTimeBenchmark(const std::string &testName, Gene
             tmpSolution.clear();
 
             start = std::chrono::high_resolution_clock::now();
-            tmpSolutionValue = TSPPopulationAlgorithms::geneticAlgorithm(tspInstance.first, parameters, tmpSolution);
+            tmpSolutionValue = TSPPopulationAlgorithms::geneticAlgorithm(tspInstance.first.get(), parameters, tmpSolution);
             finish = std::chrono::high_resolution_clock::now();
             elapsed = finish - start;
             timePoint.time += elapsed.count();
@@ -194,26 +190,19 @@ void GAParameterAnalysis::performTimeBenchmark(const std::string &testName, Gene
     writeResultsToFile(algorithmName, timeAnalysisPoints, nRepetitions);
     std::cout << "DONE" << std::endl;
 
-    // Cleanup
-    for (const auto &item : tspInstances) {
-        delete item.first;
-    }
     std::cout << algorithmName << '_' << testName << ": time benchmark DONE" << std::endl;
 }
 
-std::vector<std::pair<IGraph *, int>>
+std::vector<std::pair<std::shared_ptr<const IGraph>, int>>
 GAParameterAnalysis::loadInstances(const std::map<std::string, std::vector<std::string>> &instancePaths) {
-    std::vector<std::pair<IGraph *, int>> tspInstances;
-    IGraph *instance = nullptr;
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>> tspInstances;
     std::map<std::string, int> optimalSolutions;
     std::string instancePath;
     for (const auto &fileGroup : instancePaths) {
         optimalSolutions = TSPUtils::loadTSPSolutionValuesAbsolutePath(fileGroup.first + '/' + fileGroup.second[0]);
         for (int i = 1; i < fileGroup.second.size(); ++i) {
             instancePath = fileGroup.first + '/' + fileGroup.second[i];
-            TSPUtils::loadTSPInstanceAbsolutePath(&instance, instancePath,
-                                                  TSPUtils::getTSPTypeAbsolutePath(instancePath));
-            tspInstances.emplace_back(instance,
+            tspInstances.emplace_back(instanceRegistry.getAbsolutePath(instancePath),
                                       optimalSolutions.at(
                                               fileGroup.second[i].substr(0, fileGroup.second[i].find('.'))));
         }
@@ -3,12 +3,14 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <algorithm>
 #include <fstream>
 #include <iostream>
 
 #include "../../algorithms/helper_structures/GeneticAlgorithmParameters.h"
 #include "../AnalysisPoint.h"
+#include "../../utilities/InstanceRegistry.h"
 
 using std::cout;
 using std::endl;
@@ -27,10 +29,13 @@ private:
 
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getInstancePaths() const;
 
-    // <instance, optimal solution>
-    std::vector<std::pair<IGraph *, int>>
+    // <instance, optimal solution>, instances are shared through instanceRegistry
+    std::vector<std::pair<std::shared_ptr<const IGraph>, int>>
     loadInstances(const std::map<std::string, std::vector<std::string>> &instancePaths);
 
+    // Instances stay loaded between the analyses of one run()
+    InstanceRegistry instanceRegistry;
+
     template<class T>
     void
     writeResultsToFile(const std::string &algorithm, std::vector<AnalysisPoint<T>> &analysisPoints, int nRepetitions) {
@@ -0,0 +1,86 @@
+#ifndef PEA_P1_ARRAYVIEW_H
+#define PEA_P1_ARRAYVIEW_H
+
+#include <utility>
+
+#include "Table.h"
+
+// Read-only view of getSize() contiguous elements, usable in range-based for loops
+// View either borrows storage of its source (valid until the source is modified or destroyed)
+// or owns a Table with the elements - used by sources which do not store them contiguously
+template<class T>
+class ArrayView {
+public:
+    ArrayView() noexcept : first(nullptr), count(0) {
+    }
+
+    // Borrows count elements starting at first
+    ArrayView(const T *first, int count) noexcept : first(first), count(count) {
+    }
+
+    // Takes ownership of elements
+    explicit ArrayView(Table<T> &&elements) noexcept
+            : first(elements.getData()), count(elements.getSize()), ownedElements(std::move(elements)) {
+    }
+
+    ArrayView(const ArrayView &otherView) : first(otherView.first), count(otherView.count),
+                                            ownedElements(otherView.ownedElements) {
+        if (otherView.isOwning()) {
+            first = ownedElements.getData();
+        }
+    }
+
+    // Owned buffer is moved together with the pointer, otherView is left empty
+    ArrayView(ArrayView &&otherView) noexcept
+            : first(otherView.first), count(otherView.count), ownedElements(std::move(otherView.ownedElements)) {
+        otherView.first = nullptr;
+        otherView.count = 0;
+    }
+
+    ArrayView &operator=(ArrayView otherView) noexcept {
+        std::swap(first, otherView.first);
+        std::swap(count, otherView.count);
+        ownedElements.swap(otherView.ownedElements);
+        return *this;
+    }
+
+    // Unchecked access
+    const T &operator[](int index) const {
+        return first[index];
+    }
+
+    [[nodiscard]] const T *begin() const {
+        return first;
+    }
+
+    [[nodiscard]] const T *end() const {
+        return first + count;
+    }
+
+    [[nodiscard]] const T *getData() const {
+        return first;
+    }
+
+    [[nodiscard]] int getSize() const {
+        return count;
+    }
+
+    [[nodiscard]] bool isEmpty() const {
+        return count == 0;
+    }
+
+    // True if elements are held by the view itself
+    [[nodiscard]] bool isOwning() const {
+        return first != nullptr && first == ownedElements.getData();
+    }
+
+private:
+    const T *first;
+
+    int count;
+
+    // Empty for borrowing views
+    Table<T> ownedElements;
+};
+
+#endif //PEA_P1_ARRAYVIEW_H
@@ -3,6 +3,11 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "NodeAllocator.h"
 
 // Represents single node of the list
 template<class T>
@@ -26,7 +31,9 @@ public:
     explicit Node(const T &data) : next(nullptr), prev(nullptr), data(data), isSentry(false) {}
 };
 
-template<class T>
+// Nodes come from TNodeAllocator - by default from chunks owned by the list (see NodeAllocator.h),
+// HeapNodeAllocator<Node<T>> allocates each node separately
+template<class T, class TNodeAllocator = PooledNodeAllocator<Node<T>>>
 class DoublyLinkedList {
 
 public:
@@ -64,39 +71,45 @@ public:
         Node<T> *currNode;
     };
 
-    DoublyLinkedList() noexcept {
-        sentry = new Node<T>();
-        size = 0;
+    // Sentry is a part of the list, so creating an empty list allocates nothing
+    DoublyLinkedList() noexcept : sentry(&sentryNode), size(0) {
     }
 
     ~DoublyLinkedList() noexcept {
-        // Free memory
-        auto *it = sentry->next;
-        while (!it->isSentry) {
-            it = it->next;
-            delete it->prev;
+        // Free memory - pooled nodes holding trivially destructible data are freed all at once by the allocator
+        if constexpr (!TNodeAllocator::RELEASES_ALL_NODES || !std::is_trivially_destructible_v<T>) {
+            auto *it = sentry->next;
+            while (!it->isSentry) {
+                it = it->next;
+                destroyNode(it->prev);
+            }
         }
-        delete sentry;
+        nodeAllocator.release();
     }
 
-    DoublyLinkedList(const DoublyLinkedList &otherList) {
-        sentry = new Node<T>();
-        size = 0;
-        DoublyLinkedList<T>::Iterator otherIt = otherList.getIterator();
-        DoublyLinkedList<T>::Iterator otherItEnd = otherList.getEndIt();
+    DoublyLinkedList(const DoublyLinkedList &otherList) : DoublyLinkedList() {
+        // All copied nodes are allocated at once
+        nodeAllocator.reserve(otherList.size);
+        DoublyLinkedList::Iterator otherIt = otherList.getIterator();
+        DoublyLinkedList::Iterator otherItEnd = otherList.getEndIt();
         while (otherIt != otherItEnd) {
             this->insertAtEnd(otherIt.getData());
             ++otherIt;
         }
     }
 
-    DoublyLinkedList<T> &operator=(const DoublyLinkedList &otherList) {
+    // Takes over nodes and the allocator, otherList is left empty - nothing is allocated
+    DoublyLinkedList(DoublyLinkedList &&otherList) noexcept : DoublyLinkedList() {
+        this->swap(otherList);
+    }
+
+    DoublyLinkedList &operator=(const DoublyLinkedList &otherList) {
         if (this != &otherList) {
             while (this->size > 0) {
                 this->removeFromEnd();
             }
-            DoublyLinkedList<T>::Iterator otherIt = otherList.getIterator();
-            DoublyLinkedList<T>::Iterator otherItEnd = otherList.getEndIt();
+            DoublyLinkedList::Iterator otherIt = otherList.getIterator();
+            DoublyLinkedList::Iterator otherItEnd = otherList.getEndIt();
             while (otherIt != otherItEnd) {
                 this->insertAtEnd(otherIt.getData());
                 ++otherIt;
@@ -105,6 +118,22 @@ public:
         return *this;
     }
 
+    // Swaps contents - otherList gets the previous contents of this list
+    DoublyLinkedList &operator=(DoublyLinkedList &&otherList) noexcept {
+        this->swap(otherList);
+        return *this;
+    }
+
+    void swap(DoublyLinkedList &otherList) noexcept {
+        // Sentries stay in their lists, only the nodes linked to them are exchanged
+        std::swap(sentryNode.next, otherList.sentryNode.next);
+        std::swap(sentryNode.prev, otherList.sentryNode.prev);
+        relinkSentry(sentryNode, otherList.sentryNode);
+        relinkSentry(otherList.sentryNode, sentryNode);
+        std::swap(size, otherList.size);
+        nodeAllocator.swap(otherList.nodeAllocator);
+    }
+
     // Inserts new node with data equal to value into the place described by index
     void insert(int index, const T &value) {
         // Check if index is valid
@@ -112,7 +141,7 @@ public:
             throw std::out_of_range("insert() failed: index out of bounds");
         }
 
-        auto *newNode = new Node<T>(value);
+        auto *newNode = createNode(value);
         auto *it = sentry->next;
 
         // Find proper place for the node based on index
@@ -130,7 +159,7 @@ public:
 
     // Inserts new node with data equal to value at beginning of the list
     void insertAtStart(const T &value) {
-        auto *newNode = new Node<T>(value);
+        auto *newNode = createNode(value);
 
         // Insert the new node into the list
         newNode->next = sentry->next;
@@ -142,7 +171,7 @@ public:
 
     // Inserts new node with data equal to value at end of the list
     void insertAtEnd(const T &value) {
-        auto *newNode = new Node<T>(value);
+        auto *newNode = createNode(value);
 
         // Insert the new node into the list
         newNode->prev = sentry->prev;
@@ -159,7 +188,7 @@ public:
         for (auto *it = sentry->next; !it->isSentry; it = it->next) {
             if (it->data == searchValue) {
                 // searchValue found -> insert the new node
-                auto *newNode = new Node<T>(insertValue);
+                auto *newNode = createNode(insertValue);
                 newNode->next = it->next;
                 it->next->prev = newNode;
                 it->next = newNode;
@@ -188,7 +217,7 @@ public:
         // Delete the node
         it->prev->next = it->next;
         it->next->prev = it->prev;
-        delete it;
+        destroyNode(it);
         --size;
     }
 
@@ -204,7 +233,7 @@ public:
         auto *head = sentry->next;
         sentry->next = head->next;
         head->next->prev = sentry;
-        delete head;
+        destroyNode(head);
         --size;
         return data;
     }
@@ -220,7 +249,7 @@ public:
         auto *tail = sentry->prev;
         sentry->prev = tail->prev;
         tail->prev->next = sentry;
-        delete tail;
+        destroyNode(tail);
         --size;
     }
 
@@ -253,13 +282,13 @@ public:
         return returnIdx;
     }
 
-    bool operator==(const DoublyLinkedList<T> &otherList) const {
+    bool operator==(const DoublyLinkedList &otherList) const {
         if (this->size != otherList.getSize()) {
             return false;
         }
-        DoublyLinkedList<T>::Iterator it = this->getIterator();
-        DoublyLinkedList<T>::Iterator itEnd = this->getEndIt();
-        DoublyLinkedList<T>::Iterator otherIt = otherList.getIterator();
+        DoublyLinkedList::Iterator it = this->getIterator();
+        DoublyLinkedList::Iterator itEnd = this->getEndIt();
+        DoublyLinkedList::Iterator otherIt = otherList.getIterator();
         while (it != itEnd) {
             if (it.getData() != otherIt.getData()) {
                 return false;
@@ -270,7 +299,7 @@ public:
         return true;
     }
 
-    bool operator!=(const DoublyLinkedList<T> &otherList) const {
+    bool operator!=(const DoublyLinkedList &otherList) const {
         return !(*this == otherList);
     }
 
@@ -306,19 +335,19 @@ public:
         return size == 0;
     }
 
-    DoublyLinkedList<T>::Iterator getIterator() {
-        return DoublyLinkedList<T>::Iterator(this->sentry->next);
+    DoublyLinkedList::Iterator getIterator() {
+        return DoublyLinkedList::Iterator(this->sentry->next);
     }
 
-    DoublyLinkedList<T>::Iterator getIterator() const {
-        return DoublyLinkedList<T>::Iterator(this->sentry->next);
+    DoublyLinkedList::Iterator getIterator() const {
+        return DoublyLinkedList::Iterator(this->sentry->next);
     }
 
-    DoublyLinkedList<T>::Iterator getEndIt() {
+    DoublyLinkedList::Iterator getEndIt() {
         return DoublyLinkedList::Iterator(this->sentry);
     }
 
-    DoublyLinkedList<T>::Iterator getEndIt() const {
+    DoublyLinkedList::Iterator getEndIt() const {
         return DoublyLinkedList::Iterator(this->sentry);
     }
 
@@ -326,12 +355,43 @@ public:
     static const int VALUE_NOT_FOUND = -1;
 private:
 
-    // Sentry's pointer
+    // Sentry's pointer - always &sentryNode, kept as a pointer so that const methods hand out plain iterators
     Node<T> *sentry;
 
+    Node<T> sentryNode;
+
     // Number of elements in the list
     int size;
 
+    TNodeAllocator nodeAllocator;
+
+    Node<T> *createNode(const T &value) {
+        Node<T> *node = nodeAllocator.allocate();
+        try {
+            return ::new(static_cast<void *>(node)) Node<T>(value);
+        } catch (...) {
+            nodeAllocator.deallocate(node);
+            throw;
+        }
+    }
+
+    void destroyNode(Node<T> *node) noexcept {
+        node->~Node<T>();
+        nodeAllocator.deallocate(node);
+    }
+
+    // Points the first and the last node back at newSentry, whose links were taken over from oldSentry
+    static void relinkSentry(Node<T> &newSentry, Node<T> &oldSentry) noexcept {
+        if (newSentry.next == &oldSentry) {
+            // Taken over list was empty
+            newSentry.next = &newSentry;
+            newSentry.prev = &newSentry;
+        } else {
+            newSentry.next->prev = &newSentry;
+            newSentry.prev->next = &newSentry;
+        }
+    }
+
 };
 
 std::ostream &operator<<(std::ostream &ostr, const DoublyLinkedList<int> &dll);
@@ -0,0 +1,161 @@
+#ifndef PEA_P1_NODEALLOCATOR_H
+#define PEA_P1_NODEALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Node allocators used by DoublyLinkedList (and Stack)
+// Both hand out raw memory for a single TNode - constructing and destroying nodes is up to the caller
+// RELEASES_ALL_NODES tells whether release() frees every node that was not deallocated
+
+// Every node is a separate heap allocation
+template<class TNode>
+class HeapNodeAllocator {
+public:
+    static const bool RELEASES_ALL_NODES = false;
+
+    [[nodiscard]] TNode *allocate() {
+        return static_cast<TNode *>(::operator new(sizeof(TNode)));
+    }
+
+    void deallocate(TNode *node) noexcept {
+        ::operator delete(node);
+    }
+
+    // Nothing to prepare
+    void reserve(int) {
+    }
+
+    // Nodes are freed by deallocate()
+    void release() noexcept {
+    }
+
+    // Allocator has no state
+    void swap(HeapNodeAllocator &) noexcept {
+    }
+};
+
+// Nodes are carved out of contiguous chunks owned by the allocator, deallocated nodes are reused
+// Chunks grow geometrically (up to MAX_CHUNK_CAPACITY nodes), release() frees all of them at once
+// Not thread-safe, meant to be owned by a single list
+template<class TNode>
+class PooledNodeAllocator {
+public:
+    static const bool RELEASES_ALL_NODES = true;
+
+    PooledNodeAllocator() noexcept
+            : chunks(nullptr), freeSlots(nullptr), nextSlot(nullptr), chunkEnd(nullptr),
+              nextChunkCapacity(FIRST_CHUNK_CAPACITY), nAllocatedNodes(0) {
+    }
+
+    ~PooledNodeAllocator() noexcept {
+        release();
+    }
+
+    PooledNodeAllocator(const PooledNodeAllocator &otherAllocator) = delete;
+
+    PooledNodeAllocator &operator=(const PooledNodeAllocator &otherAllocator) = delete;
+
+    [[nodiscard]] TNode *allocate() {
+        if (freeSlots != nullptr) {
+            Slot *slot = freeSlots;
+            freeSlots = slot->next;
+            ++nAllocatedNodes;
+            return reinterpret_cast<TNode *>(slot);
+        }
+        if (nextSlot == chunkEnd) {
+            addChunk(nextChunkCapacity);
+            if (nextChunkCapacity < MAX_CHUNK_CAPACITY) {
+                nextChunkCapacity *= 2;
+            }
+        }
+        ++nAllocatedNodes;
+        return reinterpret_cast<TNode *>(nextSlot++);
+    }
+
+    // Node (already destroyed) becomes available for next allocate()
+    void deallocate(TNode *node) noexcept {
+        Slot *slot = reinterpret_cast<Slot *>(node);
+        slot->next = freeSlots;
+        freeSlots = slot;
+        --nAllocatedNodes;
+    }
+
+    // Nodes handed out and not deallocated yet
+    [[nodiscard]] std::size_t getAllocatedNodeCount() const noexcept {
+        return nAllocatedNodes;
+    }
+
+    // Makes sure that next nNodes allocations are served from a single chunk
+    void reserve(int nNodes) {
+        const std::ptrdiff_t available = chunkEnd - nextSlot;
+        if (nNodes > available) {
+            addChunk(nNodes);
+        }
+    }
+
+    // Frees every chunk - all nodes handed out become invalid
+    void release() noexcept {
+        while (chunks != nullptr) {
+            Slot *nextChunk = chunks->next;
+            ::operator delete(chunks);
+            chunks = nextChunk;
+        }
+        freeSlots = nullptr;
+        nextSlot = nullptr;
+        chunkEnd = nullptr;
+        nextChunkCapacity = FIRST_CHUNK_CAPACITY;
+        nAllocatedNodes = 0;
+    }
+
+    void swap(PooledNodeAllocator &otherAllocator) noexcept {
+        std::swap(chunks, otherAllocator.chunks);
+        std::swap(freeSlots, otherAllocator.freeSlots);
+        std::swap(nextSlot, otherAllocator.nextSlot);
+        std::swap(chunkEnd, otherAllocator.chunkEnd);
+        std::swap(nextChunkCapacity, otherAllocator.nextChunkCapacity);
+        std::swap(nAllocatedNodes, otherAllocator.nAllocatedNodes);
+    }
+
+private:
+
+    // Storage of a single node
+    // First slot of every chunk links chunks together, free slots are linked into a list
+    union Slot {
+        Slot *next;
+        alignas(TNode) unsigned char storage[sizeof(TNode)];
+    };
+
+    // Capacity (in nodes) of the first chunk - enough for a few elements
+    static const int FIRST_CHUNK_CAPACITY = 4;
+
+    static const int MAX_CHUNK_CAPACITY = 1024;
+
+    // Adds chunk with room for nNodes nodes, remaining slots of the current chunk are abandoned
+    void addChunk(int nNodes) {
+        auto *chunk = static_cast<Slot *>(::operator new(sizeof(Slot) * (static_cast<std::size_t>(nNodes) + 1)));
+        chunk->next = chunks;
+        chunks = chunk;
+        nextSlot = chunk + 1;
+        chunkEnd = nextSlot + nNodes;
+    }
+
+    // Most recently added chunk
+    Slot *chunks;
+
+    // Deallocated slots
+    Slot *freeSlots;
+
+    // Next never used slot of the current chunk
+    Slot *nextSlot;
+
+    // End of the current chunk
+    Slot *chunkEnd;
+
+    int nextChunkCapacity;
+
+    std::size_t nAllocatedNodes;
+};
+
+#endif //PEA_P1_NODEALLOCATOR_H
@@ -3,7 +3,8 @@
 
 #include "DoublyLinkedList.h"
 
-template<class T>
+// TNodeAllocator - see DoublyLinkedList
+template<class T, class TNodeAllocator = PooledNodeAllocator<Node<T>>>
 class Stack {
 
 public:
@@ -26,7 +27,7 @@ public:
     }
 
 private:
-    DoublyLinkedList<T> list;
+    DoublyLinkedList<T, TNodeAllocator> list;
 };
 
 
@@ -2,7 +2,14 @@
 #define PEA_P1_TABLE_H
 
 #include <stdexcept>
+#include <memory>
+#include <new>
+#include <utility>
+#include <cstring>
+#include <type_traits>
 
+// Dynamic array - elements are kept in raw storage, only [0, getSize()) are constructed
+// Trivially copyable elements are copied with memcpy
 template<class T>
 class Table {
 
@@ -11,103 +18,125 @@ public:
     }
 
     ~Table() noexcept {
-        delete[] table;
+        destroy(table, size);
+        deallocate(table, capacity);
     }
 
+    // Allocates exactly otherTable.getSize() elements and copies them in bulk
     Table(const Table &otherTable) : size(0), capacity(0), table(nullptr) {
-        for (int i = 0; i < otherTable.getSize(); ++i) {
-            this->insert(i, otherTable[i]);
+        if (otherTable.size > 0) {
+            table = allocate(otherTable.size);
+            capacity = otherTable.size;
+            copyConstruct(otherTable.table, otherTable.size, table);
+            size = otherTable.size;
         }
     }
 
+    Table(Table &&otherTable) noexcept
+            : size(otherTable.size), capacity(otherTable.capacity), table(otherTable.table) {
+        otherTable.size = 0;
+        otherTable.capacity = 0;
+        otherTable.table = nullptr;
+    }
+
     Table<T> &operator=(const Table &otherTable) {
         if (this != &otherTable) {
-            while (this->getSize() > 0) {
-                this->removeFromEnd();
-            }
-            for (int i = 0; i < otherTable.getSize(); ++i) {
-                this->insert(i, otherTable[i]);
-            }
+            Table<T> tableCopy(otherTable);
+            this->swap(tableCopy);
         }
         return *this;
     }
 
+    Table<T> &operator=(Table &&otherTable) noexcept {
+        if (this != &otherTable) {
+            Table<T> movedTable(std::move(otherTable));
+            this->swap(movedTable);
+        }
+        return *this;
+    }
+
+    void swap(Table &otherTable) noexcept {
+        std::swap(size, otherTable.size);
+        std::swap(capacity, otherTable.capacity);
+        std::swap(table, otherTable.table);
+    }
+
     // Inserts value into table on place described by index
     void insert(int index, const T &value) {
         // Check if index is valid
         if (index > size || index < 0) {
             throw std::out_of_range("insert() failed: index out of bounds");
         }
-        if (capacity == 0) {
-            // First elements is being inserted
-            table = new T[1];
-            capacity = 1;
-        } else if (capacity > size) {
-            // Insert element without enlarging table
-            for (int i = size - 1; i >= index; --i) {
-                table[i + 1] = table[i];
-            }
-        } else if (capacity == size) {
-            // Table must be enlarged before insertion
-            auto *tmpTable = new T[ENLARGEMENT_COEFFICIENT * capacity];
-            int i;
-            for (i = 0; i < index; ++i) {
-                tmpTable[i] = table[i];
-            }
-            for (int j = index + 1; i < size; ++i, ++j) {
-                tmpTable[j] = table[i];
-            }
-            delete[] table;
-            table = tmpTable;
-            capacity *= ENLARGEMENT_COEFFICIENT;
-        }
-        table[index] = value;
-        ++size;
+        emplaceAt(index, value);
     }
 
     // Inserts value into table at start
     void insertAtStart(const T &value) {
-        if (capacity == 0) {
-            // First elements is being inserted
-            table = new T[1];
-            capacity = 1;
-        } else if (capacity > size) {
-            // Insert element without enlarging table
-            for (int i = size - 1; i >= 0; --i) {
-                table[i + 1] = table[i];
-            }
-        } else if (capacity == size) {
-            // Table must be enlarged before insertion
-            auto *tmpTable = new T[ENLARGEMENT_COEFFICIENT * capacity];
-            for (int i = size - 1; i >= 0; --i) {
-                tmpTable[i + 1] = table[i];
-            }
-            delete[] table;
-            table = tmpTable;
-            capacity *= ENLARGEMENT_COEFFICIENT;
-        }
-        table[0] = value;
-        ++size;
+        emplaceAt(0, value);
     }
 
     // Inserts value into table at end
     void insertAtEnd(const T &value) {
-        if (capacity == 0) {
-            // First elements is being inserted
-            table = new T[1];
-            capacity = 1;
-        } else if (capacity == size) {
-            // Table must be enlarged before insertion
-            auto *tmpTable = new T[ENLARGEMENT_COEFFICIENT * capacity];
-            for (int i = 0; i < size; ++i) {
-                tmpTable[i] = table[i];
-            }
-            delete[] table;
-            table = tmpTable;
-            capacity *= ENLARGEMENT_COEFFICIENT;
+        emplaceAt(size, value);
+    }
+
+    // Inserts value into table at end
+    void insertAtEnd(T &&value) {
+        emplaceAt(size, std::move(value));
+    }
+
+    // Constructs element from arguments at the end of the table, returns reference to it
+    template<class... Args>
+    T &emplaceAtEnd(Args &&... args) {
+        return emplaceAt(size, std::forward<Args>(args)...);
+    }
+
+    // Enlarges capacity to at least newCapacity (never reduces it)
+    // Note that removals may still reduce the capacity below newCapacity
+    void reserve(int newCapacity) {
+        if (newCapacity > capacity) {
+            reallocate(newCapacity);
         }
-        table[size] = value;
-        ++size;
+    }
+
+    // Changes size to newSize - added elements are value-initialized, removed ones are destroyed
+    // Capacity is not reduced
+    void resize(int newSize) {
+        if (newSize < 0) {
+            throw std::out_of_range("resize() failed: negative size");
+        }
+        reserve(newSize);
+        if (newSize > size) {
+            std::uninitialized_value_construct(table + size, table + newSize);
+        } else {
+            destroy(table + newSize, size - newSize);
+        }
+        size = newSize;
+    }
+
+    // Changes size to newSize - added elements are copies of value, removed ones are destroyed
+    // Capacity is not reduced
+    void resize(int newSize, const T &value) {
+        if (newSize < 0) {
+            throw std::out_of_range("resize() failed: negative size");
+        }
+        if (newSize > capacity) {
+            // value may be an element of this table
+            T valueCopy(value);
+            reserve(newSize);
+            std::uninitialized_fill(table + size, table + newSize, valueCopy);
+        } else if (newSize > size) {
+            std::uninitialized_fill(table + size, table + newSize, value);
+        } else {
+            destroy(table + newSize, size - newSize);
+        }
+        size = newSize;
+    }
+
+    // Destroys all elements, capacity is kept
+    void clear() noexcept {
+        destroy(table, size);
+        size = 0;
     }
 
     // Remove value described by index from table
@@ -116,32 +145,7 @@ public:
         if (index >= size || index < 0) {
             throw std::out_of_range("remove() failed: index out of bounds");
         }
-        if (size == 1) {
-            // Remove last element
-            delete[] table;
-            table = nullptr;
-            capacity = 0;
-        } else if (getFullFactor() > REDUCTION_COEFFICIENT) {
-            // Table doesn't have to be reduced after removal
-            for (int i = index; i < size - 1; ++i) {
-                table[i] = table[i + 1];
-            }
-        } else {
-            // Table has to be reduced after removal
-            auto *tmpTable = new T[capacity / ENLARGEMENT_COEFFICIENT];
-            int i;
-            for (i = 0; i < index; ++i) {
-                tmpTable[i] = table[i];
-            }
-            ++i;
-            for (int j = index; i < size; ++i, ++j) {
-                tmpTable[j] = table[i];
-            }
-            delete[] table;
-            table = tmpTable;
-            capacity /= ENLARGEMENT_COEFFICIENT;
-        }
-        --size;
+        removeAt(index);
     }
 
     // Remove value from table from start
@@ -150,27 +154,7 @@ public:
         if (size < 1) {
             throw std::out_of_range("removeFromStart() failed: table is empty");
         }
-        if (size == 1) {
-            // Remove last element
-            delete[] table;
-            table = nullptr;
-            capacity = 0;
-        } else if (getFullFactor() > REDUCTION_COEFFICIENT) {
-            // Table doesn't have to be reduced after removal
-            for (int i = 0; i < size - 1; ++i) {
-                table[i] = table[i + 1];
-            }
-        } else {
-            // Table has to be reduced after removal
-            auto *tmpTable = new T[capacity / ENLARGEMENT_COEFFICIENT];
-            for (int i = 0; i < size - 1; ++i) {
-                tmpTable[i] = table[i + 1];
-            }
-            delete[] table;
-            table = tmpTable;
-            capacity /= ENLARGEMENT_COEFFICIENT;
-        }
-        --size;
+        removeAt(0);
     }
 
     // Remove value from table from end
@@ -181,20 +165,18 @@ public:
         }
         if (size == 1) {
             // Remove last element
-            delete[] table;
-            table = nullptr;
-            capacity = 0;
-        } else if (getFullFactor() == REDUCTION_COEFFICIENT) {
+            releaseStorage();
+            return;
+        }
+        if (getFullFactor() == REDUCTION_COEFFICIENT) {
             // Table has to be reduced after removal
-            auto *tmpTable = new T[capacity / ENLARGEMENT_COEFFICIENT];
-            for (int i = 0; i < size - 1; ++i) {
-                tmpTable[i] = table[i];
-            }
-            delete[] table;
-            table = tmpTable;
-            capacity /= ENLARGEMENT_COEFFICIENT;
+            destroy(table + size - 1, 1);
+            --size;
+            reallocate(capacity / ENLARGEMENT_COEFFICIENT);
+        } else {
+            destroy(table + size - 1, 1);
+            --size;
         }
-        --size;
     }
 
     // Linear search for value in the table
@@ -245,6 +227,15 @@ public:
         return !(*this == otherTable);
     }
 
+    // Contiguous storage of getSize() elements (nullptr if nothing is allocated), unchecked access
+    [[nodiscard]] T *getData() {
+        return table;
+    }
+
+    [[nodiscard]] const T *getData() const {
+        return table;
+    }
+
     [[nodiscard]] int getSize() const {
         return size;
     }
@@ -281,6 +272,129 @@ private:
             return static_cast<double>(size) / capacity;
         }
     }
+
+    // Constructs element on place described by (valid) index, enlarging the table if it is full
+    template<class... Args>
+    T &emplaceAt(int index, Args &&... args) {
+        if (size == capacity) {
+            // Table must be enlarged before insertion
+            // New element is constructed first, as arguments may refer to elements of the table
+            // Counts are computed into locals before allocating, so that the optimiser can bound both relocations
+            const int oldCapacity = capacity;
+            const int newCapacity = (oldCapacity == 0) ? 1 : ENLARGEMENT_COEFFICIENT * oldCapacity;
+            const int nBefore = index, nAfter = size - index;
+            T *oldTable = table;
+            T *newTable = allocate(newCapacity);
+            try {
+                ::new(static_cast<void *>(newTable + nBefore)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(newTable, newCapacity);
+                throw;
+            }
+            relocate(oldTable, nBefore, newTable);
+            relocate(oldTable + nBefore, nAfter, newTable + nBefore + 1);
+            deallocate(oldTable, oldCapacity);
+            table = newTable;
+            capacity = newCapacity;
+        } else if (index == size) {
+            ::new(static_cast<void *>(table + size)) T(std::forward<Args>(args)...);
+        } else {
+            // Insert element without enlarging table
+            T value(std::forward<Args>(args)...);
+            ::new(static_cast<void *>(table + size)) T(std::move(table[size - 1]));
+            for (int i = size - 1; i > index; --i) {
+                table[i] = std::move(table[i - 1]);
+            }
+            table[index] = std::move(value);
+        }
+        ++size;
+        return table[index];
+    }
+
+    // Removes element on place described by (valid) index, reducing the table if it gets sparse
+    void removeAt(int index) {
+        if (size == 1) {
+            // Remove last element
+            releaseStorage();
+        } else if (getFullFactor() > REDUCTION_COEFFICIENT) {
+            // Table doesn't have to be reduced after removal
+            for (int i = index; i < size - 1; ++i) {
+                table[i] = std::move(table[i + 1]);
+            }
+            destroy(table + size - 1, 1);
+            --size;
+        } else {
+            // Table has to be reduced after removal
+            const int newCapacity = capacity / ENLARGEMENT_COEFFICIENT;
+            T *newTable = allocate(newCapacity);
+            destroy(table + index, 1);
+            relocate(table, index, newTable);
+            relocate(table + index + 1, size - index - 1, newTable + index);
+            deallocate(table, capacity);
+            table = newTable;
+            capacity = newCapacity;
+            --size;
+        }
+    }
+
+    // Moves all elements to new storage of newCapacity (>= size) elements
+    void reallocate(int newCapacity) {
+        // Size is read before allocating and checked, so that the optimiser can bound the relocation
+        const int oldSize = size;
+        if (oldSize > newCapacity) {
+            throw std::length_error("reallocate() failed: capacity smaller than size");
+        }
+        T *oldTable = table;
+        T *newTable = allocate(newCapacity);
+        relocate(oldTable, oldSize, newTable);
+        deallocate(oldTable, capacity);
+        table = newTable;
+        capacity = newCapacity;
+    }
+
+    // Destroys all elements and frees storage
+    void releaseStorage() noexcept {
+        destroy(table, size);
+        deallocate(table, capacity);
+        table = nullptr;
+        size = 0;
+        capacity = 0;
+    }
+
+    [[nodiscard]] static T *allocate(int count) {
+        return std::allocator<T>().allocate(count);
+    }
+
+    static void deallocate(T *storage, int count) noexcept {
+        if (storage != nullptr) {
+            std::allocator<T>().deallocate(storage, count);
+        }
+    }
+
+    static void destroy(T *first, int count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy(first, first + count);
+        }
+    }
+
+    // Copy constructs count elements from source in uninitialized destination
+    static void copyConstruct(const T *source, int count, T *destination) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memcpy(static_cast<void *>(destination), source, count * sizeof(T));
+        } else {
+            std::uninitialized_copy(source, source + count, destination);
+        }
+    }
+
+    // Moves count elements from source to uninitialized destination, source elements are destroyed
+    static void relocate(T *source, int count, T *destination) {
+        if (count <= 0) {
+            return;
+        }
+        // Trivial elements are moved in bulk by the standard library, destroy() is a no-op for them
+        std::uninitialized_move(source, source + count, destination);
+        destroy(source, count);
+    }
 };
 
 #endif //PEA_P1_TABLE_H
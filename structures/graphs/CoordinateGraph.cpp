@@ -0,0 +1,312 @@
+#include "CoordinateGraph.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define PEA_P1_X86_SIMD
+#endif
+
+#ifdef PEA_P1_X86_SIMD
+namespace {
+
+    // Kernels below compute costs of edges while they are all within int range, like the scalar getCost()
+    // Ceiling (CeilEuclidean2D) and rounding up of PseudoEuclidean are done by comparing the truncated value
+    // with the distance, as SSE2 has no rounding instruction
+
+    __attribute__((target("avx2")))
+    inline __m128i roundDistancesAVX2(__m256d dx, __m256d dy, CoordinateGraph::DistanceFunction distanceFunction) {
+        __m256d squaredDistance = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+        if (distanceFunction == CoordinateGraph::PseudoEuclidean) {
+            squaredDistance = _mm256_div_pd(squaredDistance, _mm256_set1_pd(10.0));
+        }
+        const __m256d distance = _mm256_sqrt_pd(squaredDistance);
+        const __m256d roundedBase = (distanceFunction == CoordinateGraph::CeilEuclidean2D)
+                                    ? distance : _mm256_add_pd(distance, _mm256_set1_pd(0.5));
+        const __m256d truncated = _mm256_round_pd(roundedBase, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        if (distanceFunction == CoordinateGraph::Euclidean2D) {
+            return _mm256_cvttpd_epi32(truncated);
+        }
+        const __m256d increment = _mm256_and_pd(_mm256_cmp_pd(truncated, distance, _CMP_LT_OQ),
+                                                _mm256_set1_pd(1.0));
+        return _mm256_cvttpd_epi32(_mm256_add_pd(truncated, increment));
+    }
+
+    // Costs of edges {vertexID, j} for j from 0, 4 at a time; returns number of computed costs
+    __attribute__((target("avx2")))
+    int computeRowAVX2(const double *xs, const double *ys, int vertexID, int count,
+                       CoordinateGraph::DistanceFunction distanceFunction, int *outCosts) {
+        const __m256d x = _mm256_set1_pd(xs[vertexID]);
+        const __m256d y = _mm256_set1_pd(ys[vertexID]);
+        int j = 0;
+        for (; j + 4 <= count; j += 4) {
+            const __m256d dx = _mm256_sub_pd(x, _mm256_loadu_pd(xs + j));
+            const __m256d dy = _mm256_sub_pd(y, _mm256_loadu_pd(ys + j));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(outCosts + j), roundDistancesAVX2(dx, dy, distanceFunction));
+        }
+        return j;
+    }
+
+    // 4 pairs at a time, returns number of computed costs
+    // Coordinates are loaded one by one - vgatherdpd was slower than separate loads on tested hardware
+    __attribute__((target("avx2")))
+    int computePairsAVX2(const double *xs, const double *ys, const int *startVertexIDs, const int *endVertexIDs,
+                         int count, CoordinateGraph::DistanceFunction distanceFunction, int *outCosts) {
+        int k = 0;
+        for (; k + 4 <= count; k += 4) {
+            const int *s = startVertexIDs + k, *e = endVertexIDs + k;
+            const __m256d dx = _mm256_sub_pd(_mm256_set_pd(xs[s[3]], xs[s[2]], xs[s[1]], xs[s[0]]),
+                                             _mm256_set_pd(xs[e[3]], xs[e[2]], xs[e[1]], xs[e[0]]));
+            const __m256d dy = _mm256_sub_pd(_mm256_set_pd(ys[s[3]], ys[s[2]], ys[s[1]], ys[s[0]]),
+                                             _mm256_set_pd(ys[e[3]], ys[e[2]], ys[e[1]], ys[e[0]]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(outCosts + k), roundDistancesAVX2(dx, dy, distanceFunction));
+        }
+        return k;
+    }
+
+    inline __m128i roundDistancesSSE2(__m128d dx, __m128d dy, CoordinateGraph::DistanceFunction distanceFunction) {
+        __m128d squaredDistance = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+        if (distanceFunction == CoordinateGraph::PseudoEuclidean) {
+            squaredDistance = _mm_div_pd(squaredDistance, _mm_set1_pd(10.0));
+        }
+        const __m128d distance = _mm_sqrt_pd(squaredDistance);
+        const __m128d roundedBase = (distanceFunction == CoordinateGraph::CeilEuclidean2D)
+                                    ? distance : _mm_add_pd(distance, _mm_set1_pd(0.5));
+        const __m128i truncated = _mm_cvttpd_epi32(roundedBase);
+        if (distanceFunction == CoordinateGraph::Euclidean2D) {
+            return truncated;
+        }
+        const __m128d increment = _mm_and_pd(_mm_cmplt_pd(_mm_cvtepi32_pd(truncated), distance), _mm_set1_pd(1.0));
+        return _mm_cvttpd_epi32(_mm_add_pd(_mm_cvtepi32_pd(truncated), increment));
+    }
+
+    // As computeRowAVX2(), 2 costs at a time
+    int computeRowSSE2(const double *xs, const double *ys, int vertexID, int count,
+                       CoordinateGraph::DistanceFunction distanceFunction, int *outCosts) {
+        const __m128d x = _mm_set1_pd(xs[vertexID]);
+        const __m128d y = _mm_set1_pd(ys[vertexID]);
+        int j = 0;
+        for (; j + 2 <= count; j += 2) {
+            const __m128d dx = _mm_sub_pd(x, _mm_loadu_pd(xs + j));
+            const __m128d dy = _mm_sub_pd(y, _mm_loadu_pd(ys + j));
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(outCosts + j), roundDistancesSSE2(dx, dy, distanceFunction));
+        }
+        return j;
+    }
+
+    // As computePairsAVX2(), 2 pairs at a time
+    int computePairsSSE2(const double *xs, const double *ys, const int *startVertexIDs, const int *endVertexIDs,
+                         int count, CoordinateGraph::DistanceFunction distanceFunction, int *outCosts) {
+        int k = 0;
+        for (; k + 2 <= count; k += 2) {
+            const __m128d dx = _mm_sub_pd(_mm_set_pd(xs[startVertexIDs[k + 1]], xs[startVertexIDs[k]]),
+                                          _mm_set_pd(xs[endVertexIDs[k + 1]], xs[endVertexIDs[k]]));
+            const __m128d dy = _mm_sub_pd(_mm_set_pd(ys[startVertexIDs[k + 1]], ys[startVertexIDs[k]]),
+                                          _mm_set_pd(ys[endVertexIDs[k + 1]], ys[endVertexIDs[k]]));
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(outCosts + k), roundDistancesSSE2(dx, dy, distanceFunction));
+        }
+        return k;
+    }
+
+    bool isAVX2Supported() {
+        // Needed before main(), see GCC documentation of __builtin_cpu_supports
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    }
+}
+
+bool CoordinateGraph::useAVX2 = isAVX2Supported();
+#else
+bool CoordinateGraph::useAVX2 = false;
+#endif
+
+CoordinateGraph::CoordinateGraph(GraphType graphType, DistanceFunction distanceFunction, const double *x,
+                                 const double *y, int nVertex)
+        : TYPE(graphType), distanceFunction(distanceFunction), vertexCount(nVertex), xs(nullptr), ys(nullptr),
+          rowCacheCapacity(0), rowCacheClock(0) {
+    if (nVertex < 1) {
+        throw std::invalid_argument("CoordinateGraph() error: graph must have at least one vertex");
+    }
+    xs = new double[nVertex];
+    ys = new double[nVertex];
+    for (int i = 0; i < nVertex; ++i) {
+        if (distanceFunction == Geographic) {
+            xs[i] = geographicToRadians(x[i]);
+            ys[i] = geographicToRadians(y[i]);
+        } else {
+            xs[i] = x[i];
+            ys[i] = y[i];
+        }
+    }
+}
+
+CoordinateGraph::~CoordinateGraph() {
+    delete[] xs;
+    delete[] ys;
+}
+
+double CoordinateGraph::geographicToRadians(double coordinate) {
+    // Degrees are truncated (as in TSPLIB reference implementations), fraction is minutes
+    const double pi = 3.141592;
+    const double degrees = std::trunc(coordinate);
+    const double minutes = coordinate - degrees;
+    return pi * (degrees + 5.0 * minutes / 3.0) / 180.0;
+}
+
+void CoordinateGraph::addVertex() {
+    throw std::logic_error("addVertex() error: CoordinateGraph has fixed vertex count");
+}
+
+void CoordinateGraph::addEdge(int /*startVertexID*/, int /*endVertexID*/, int /*edgeParameter*/) {
+    throw std::logic_error("addEdge() error: CoordinateGraph edges are defined by coordinates");
+}
+
+void CoordinateGraph::removeEdge(int /*startVertexID*/, int /*endVertexID*/) {
+    throw std::logic_error("removeEdge() error: CoordinateGraph edges are defined by coordinates");
+}
+
+void CoordinateGraph::setEdgeParameter(int /*startVertexID*/, int /*endVertexID*/, int /*parameter*/) {
+    throw std::logic_error("setEdgeParameter() error: CoordinateGraph edges are defined by coordinates");
+}
+
+DoublyLinkedList<int> CoordinateGraph::getVertices() const {
+    DoublyLinkedList<int> vertexes;
+    for (int i = 0; i < vertexCount; ++i) {
+        vertexes.insertAtEnd(i);
+    }
+    return vertexes;
+}
+
+DoublyLinkedList<int> CoordinateGraph::getVertexSuccessors(int vertexID) const {
+    DoublyLinkedList<int> successors;
+    for (int j = 0; j < vertexCount; ++j) {
+        if (j != vertexID) {
+            successors.insertAtEnd(j);
+        }
+    }
+    return successors;
+}
+
+DoublyLinkedList<int> CoordinateGraph::getVertexPredecessors(int vertexID) const {
+    // Graph is complete
+    return getVertexSuccessors(vertexID);
+}
+
+ArrayView<int> CoordinateGraph::getSuccessorsView(int vertexID) const {
+    Table<int> successors;
+    successors.resize(vertexCount - 1);
+    int *successorIDs = successors.getData();
+    for (int j = 0, k = 0; j < vertexCount; ++j) {
+        if (j != vertexID) {
+            successorIDs[k++] = j;
+        }
+    }
+    return ArrayView<int>(std::move(successors));
+}
+
+ArrayView<int> CoordinateGraph::getPredecessorsView(int vertexID) const {
+    return getSuccessorsView(vertexID);
+}
+
+ArrayView<int> CoordinateGraph::getCostRowView(int vertexID) const {
+    if (rowCacheCapacity == 0) {
+        Table<int> row;
+        row.resize(vertexCount);
+        computeCostRow(vertexID, row.getData());
+        return ArrayView<int>(std::move(row));
+    }
+
+    std::lock_guard<std::mutex> lock(rowCacheMutex);
+    CachedRow *cachedRow = nullptr;
+    for (auto &row : rowCache) {
+        if (row.vertexID == vertexID) {
+            cachedRow = &row;
+            break;
+        }
+    }
+    if (cachedRow == nullptr) {
+        if (static_cast<int>(rowCache.size()) < rowCacheCapacity) {
+            cachedRow = &rowCache.emplace_back();
+            cachedRow->costs.resize(vertexCount);
+        } else {
+            cachedRow = &*std::min_element(rowCache.begin(), rowCache.end(),
+                                           [](const CachedRow &lhs, const CachedRow &rhs) {
+                                               return lhs.lastUse < rhs.lastUse;
+                                           });
+        }
+        cachedRow->vertexID = vertexID;
+        computeCostRow(vertexID, cachedRow->costs.getData());
+    }
+    cachedRow->lastUse = ++rowCacheClock;
+    return ArrayView<int>(Table<int>(cachedRow->costs));
+}
+
+void CoordinateGraph::computeCostRow(int vertexID, int *outCosts) const {
+    int j = 0;
+#ifdef PEA_P1_X86_SIMD
+    if (distanceFunction != Geographic) {
+        j = useAVX2 ? computeRowAVX2(xs, ys, vertexID, vertexCount, distanceFunction, outCosts)
+                    : computeRowSSE2(xs, ys, vertexID, vertexCount, distanceFunction, outCosts);
+    }
+#endif
+    for (; j < vertexCount; ++j) {
+        outCosts[j] = getCost(vertexID, j);
+    }
+    outCosts[vertexID] = std::numeric_limits<int>::max();
+}
+
+void CoordinateGraph::computeCosts(const int *startVertexIDs, const int *endVertexIDs, int count,
+                                   int *outCosts) const {
+    int k = 0;
+#ifdef PEA_P1_X86_SIMD
+    if (distanceFunction != Geographic) {
+        k = useAVX2 ? computePairsAVX2(xs, ys, startVertexIDs, endVertexIDs, count, distanceFunction, outCosts)
+                    : computePairsSSE2(xs, ys, startVertexIDs, endVertexIDs, count, distanceFunction, outCosts);
+        // Loops computed by the kernels are fixed
+        for (int l = 0; l < k; ++l) {
+            if (startVertexIDs[l] == endVertexIDs[l]) {
+                outCosts[l] = std::numeric_limits<int>::max();
+            }
+        }
+    }
+#endif
+    for (; k < count; ++k) {
+        outCosts[k] = getCost(startVertexIDs[k], endVertexIDs[k]);
+    }
+}
+
+void CoordinateGraph::setRowCacheCapacity(int capacity) {
+    if (capacity < 0) {
+        throw std::invalid_argument("setRowCacheCapacity() error: capacity must not be negative");
+    }
+    std::lock_guard<std::mutex> lock(rowCacheMutex);
+    rowCacheCapacity = capacity;
+    rowCache.clear();
+}
+
+int CoordinateGraph::getEdgeCount() const {
+    const long long pairCount = static_cast<long long>(vertexCount) * (vertexCount - 1) / 2;
+    const long long edgeCount = (TYPE == GraphType::Directed) ? 2 * pairCount : pairCount;
+    // Complete graphs above ~46k vertices have more edges than int can count
+    return (edgeCount > std::numeric_limits<int>::max()) ? std::numeric_limits<int>::max()
+                                                         : static_cast<int>(edgeCount);
+}
+
+double CoordinateGraph::getDensity() const {
+    return (vertexCount > 1) ? 1.0 : 0.0;
+}
+
+std::string CoordinateGraph::toString() const {
+    std::stringstream graphString;
+    graphString << std::endl << "Coordinate graph:" << std::endl;
+    for (int i = 0; i < vertexCount; ++i) {
+        graphString << i << ": (" << xs[i] << ", " << ys[i] << ")" << std::endl;
+    }
+    return graphString.str();
+}
+
+IGraph::GraphType CoordinateGraph::getGraphType() const {
+    return TYPE;
+}
+
+IGraph::GraphStructure CoordinateGraph::getGraphStructure() const {
+    return NodeCoordinates;
+}
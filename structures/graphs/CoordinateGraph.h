@@ -0,0 +1,186 @@
+#ifndef PEA_P1_COORDINATEGRAPH_H
+#define PEA_P1_COORDINATEGRAPH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "IGraph.h"
+#include "../Table.h"
+#include "../DoublyLinkedList.h"
+
+// Complete graph given by planar coordinates of its vertices - memory is O(V), meant for instances too large
+// for any matrix (100k vertices would need 40 GB as DistanceMatrix)
+// Edge costs are computed on every lookup with one of the TSPLIB distance functions, so they are symmetric;
+// Directed graph reports both directions of every edge
+// Edges are defined by the coordinates, addEdge(), removeEdge() and setEdgeParameter() always throw
+// Batch methods compute 4 (AVX2, chosen at runtime) or 2 (SSE2) costs at once on x86-64, Geographic costs
+// are computed one by one (there is no vector acos)
+class CoordinateGraph final : public IGraph {
+public:
+
+    // Distance functions of TSPLIB (EDGE_WEIGHT_TYPE)
+    enum DistanceFunction {
+        // EUC_2D - Euclidean distance rounded to the nearest integer
+        Euclidean2D,
+        // CEIL_2D - Euclidean distance rounded up
+        CeilEuclidean2D,
+        // GEO - distance on Earth in km, coordinates are latitude and longitude in DDD.MM (degrees and minutes)
+        Geographic,
+        // ATT - pseudo-Euclidean distance of att48 and att532
+        PseudoEuclidean
+    };
+
+    // x and y hold coordinates of nVertex vertices
+    CoordinateGraph(GraphType graphType, DistanceFunction distanceFunction, const double *x, const double *y,
+                    int nVertex);
+
+    ~CoordinateGraph() override;
+
+    CoordinateGraph(const CoordinateGraph &otherGraph) = delete;
+
+    CoordinateGraph &operator=(const CoordinateGraph &otherGraph) = delete;
+
+    void addEdge(int startVertexID, int endVertexID, int edgeParameter) override;
+
+    void removeEdge(int startVertexID, int endVertexID) override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexSuccessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertices() const override;
+
+    // Owning view - costs are computed
+    [[nodiscard]] ArrayView<int> getSuccessorsView(int vertexID) const override;
+
+    [[nodiscard]] ArrayView<int> getPredecessorsView(int vertexID) const override;
+
+    // Owning view - costs are computed with computeCostRow() or copied from the row cache
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override;
+
+    // Writes getVertexCount() costs of edges leaving vertexID to outCosts (the diagonal is
+    // std::numeric_limits<int>::max()), equal to getCost() of every edge
+    void computeCostRow(int vertexID, int *outCosts) const;
+
+    // outCosts[k] = getCost(startVertexIDs[k], endVertexIDs[k]) for k < count, vertex IDs are not checked
+    void computeCosts(const int *startVertexIDs, const int *endVertexIDs, int count, int *outCosts) const;
+
+    // Rows returned by getCostRowView() are kept in a cache of capacity rows, least recently used row is replaced
+    // 0 (default) disables the cache - only Geographic rows take noticeably longer to compute than to copy
+    void setRowCacheCapacity(int capacity);
+
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return getCost(startVertexID, endVertexID);
+    }
+
+    void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
+
+    // Non-virtual, unchecked accessor for hot loops
+    // Switch on the distance function is taken the same way on every call, so it is predicted
+    [[nodiscard]] int getCost(int startVertexID, int endVertexID) const {
+        if (startVertexID == endVertexID) {
+            return std::numeric_limits<int>::max();
+        }
+        switch (distanceFunction) {
+            case Euclidean2D:
+                return static_cast<int>(euclideanDistance(startVertexID, endVertexID) + 0.5);
+            case CeilEuclidean2D:
+                return static_cast<int>(std::ceil(euclideanDistance(startVertexID, endVertexID)));
+            case Geographic:
+                return geographicDistance(startVertexID, endVertexID);
+            default:
+                return pseudoEuclideanDistance(startVertexID, endVertexID);
+        }
+    }
+
+    [[nodiscard]] DistanceFunction getDistanceFunction() const {
+        return distanceFunction;
+    }
+
+    [[nodiscard]] int getVertexCount() const override {
+        return vertexCount;
+    }
+
+    [[nodiscard]] int getEdgeCount() const override;
+
+    [[nodiscard]] double getDensity() const override;
+
+    [[nodiscard]] std::string toString() const override;
+
+    [[nodiscard]] GraphType getGraphType() const override;
+
+    [[nodiscard]] GraphStructure getGraphStructure() const override;
+
+private:
+
+    // Vertex count is fixed - always throws
+    void addVertex() override;
+
+    [[nodiscard]] double euclideanDistance(int startVertexID, int endVertexID) const {
+        const double dx = xs[startVertexID] - xs[endVertexID];
+        const double dy = ys[startVertexID] - ys[endVertexID];
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    // TSPLIB formula, coordinates are already converted to radians (see the constructor)
+    [[nodiscard]] int geographicDistance(int startVertexID, int endVertexID) const {
+        const double q1 = std::cos(ys[startVertexID] - ys[endVertexID]);
+        const double q2 = std::cos(xs[startVertexID] - xs[endVertexID]);
+        const double q3 = std::cos(xs[startVertexID] + xs[endVertexID]);
+        return static_cast<int>(EARTH_RADIUS * std::acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+    }
+
+    // Rounded up if rounding to the nearest integer would lower the distance
+    [[nodiscard]] int pseudoEuclideanDistance(int startVertexID, int endVertexID) const {
+        const double dx = xs[startVertexID] - xs[endVertexID];
+        const double dy = ys[startVertexID] - ys[endVertexID];
+        const double distance = std::sqrt((dx * dx + dy * dy) / 10.0);
+        const int roundedDistance = static_cast<int>(distance + 0.5);
+        return (roundedDistance < distance) ? roundedDistance + 1 : roundedDistance;
+    }
+
+    // Degrees and minutes (DDD.MM) to radians, with the value of pi used by TSPLIB
+    [[nodiscard]] static double geographicToRadians(double coordinate);
+
+    struct CachedRow {
+        int vertexID;
+        // Value of rowCacheClock at the last use
+        unsigned long long lastUse;
+        Table<int> costs;
+    };
+
+    // Set once at startup, from the CPU features
+    static bool useAVX2;
+
+    static constexpr double EARTH_RADIUS = 6378.388;
+
+    const GraphType TYPE;
+
+    const DistanceFunction distanceFunction;
+
+    const int vertexCount;
+
+    // Coordinates, latitude and longitude in radians for Geographic
+    double *xs;
+
+    double *ys;
+
+    int rowCacheCapacity;
+
+    // Guards the row cache, so that const methods stay safe to call from several threads
+    mutable std::mutex rowCacheMutex;
+
+    mutable std::vector<CachedRow> rowCache;
+
+    mutable unsigned long long rowCacheClock;
+
+    friend class TSPLIBInstanceTest;
+};
+
+#endif //PEA_P1_COORDINATEGRAPH_H
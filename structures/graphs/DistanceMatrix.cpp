@@ -0,0 +1,174 @@
+#include "DistanceMatrix.h"
+
+DistanceMatrix::DistanceMatrix(GraphType graphType, int nVertex)
+        : TYPE(graphType), vertexCount(nVertex),
+          rowStride(((static_cast<std::size_t>(nVertex) * sizeof(int) + ALIGNMENT - 1) / ALIGNMENT) *
+                    (ALIGNMENT / sizeof(int))),
+          edgeCount(0), costs(nullptr) {
+    if (nVertex < 1) {
+        throw std::invalid_argument("DistanceMatrix() error: graph must have at least one vertex");
+    }
+    const std::size_t bufferSize = rowStride * vertexCount;
+    costs = static_cast<int *>(::operator new[](bufferSize * sizeof(int), std::align_val_t(ALIGNMENT)));
+    for (std::size_t idx = 0; idx < bufferSize; ++idx) {
+        costs[idx] = std::numeric_limits<int>::max();
+    }
+}
+
+DistanceMatrix::~DistanceMatrix() {
+    ::operator delete[](costs, std::align_val_t(ALIGNMENT));
+}
+
+void DistanceMatrix::addVertex() {
+    throw std::logic_error("addVertex() error: DistanceMatrix has fixed vertex count");
+}
+
+void DistanceMatrix::addEdge(int startVertexID, int endVertexID, int edgeParameter) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("addEdge() error: invalid vertex's index");
+    }
+    if (startVertexID == endVertexID) {
+        throw std::invalid_argument("addEdge() error: loops are disallowed");
+    }
+    // Multiple edges are not represented in this graph's structure
+    if (this->getCost(startVertexID, endVertexID) != std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("addEdge() error: multiple edges are disallowed");
+    }
+
+    costs[static_cast<std::size_t>(startVertexID) * rowStride + endVertexID] = edgeParameter;
+    if (this->TYPE == GraphType::Undirected) {
+        costs[static_cast<std::size_t>(endVertexID) * rowStride + startVertexID] = edgeParameter;
+    }
+    ++edgeCount;
+}
+
+void DistanceMatrix::removeEdge(int startVertexID, int endVertexID) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("removeEdge() error: invalid vertex's index");
+    }
+    if (this->getCost(startVertexID, endVertexID) == std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("removeEdge() error: described edge does not exist");
+    }
+
+    costs[static_cast<std::size_t>(startVertexID) * rowStride + endVertexID] = std::numeric_limits<int>::max();
+    if (this->TYPE == GraphType::Undirected) {
+        costs[static_cast<std::size_t>(endVertexID) * rowStride + startVertexID] = std::numeric_limits<int>::max();
+    }
+    --edgeCount;
+}
+
+DoublyLinkedList<int> DistanceMatrix::getVertices() const {
+    DoublyLinkedList<int> vertexes;
+    for (int i = 0; i < vertexCount; ++i) {
+        vertexes.insertAtEnd(i);
+    }
+    return vertexes;
+}
+
+DoublyLinkedList<int> DistanceMatrix::getVertexSuccessors(int vertexID) const {
+    DoublyLinkedList<int> successors;
+    const int *row = this->getRow(vertexID);
+    for (int j = 0; j < vertexCount; ++j) {
+        if (row[j] != std::numeric_limits<int>::max()) {
+            successors.insertAtEnd(j);
+        }
+    }
+    return successors;
+}
+
+ArrayView<int> DistanceMatrix::getSuccessorsView(int vertexID) const {
+    Table<int> successors;
+    successors.reserve(vertexCount);
+    const int *row = this->getRow(vertexID);
+    for (int j = 0; j < vertexCount; ++j) {
+        if (row[j] != std::numeric_limits<int>::max()) {
+            successors.insertAtEnd(j);
+        }
+    }
+    return ArrayView<int>(std::move(successors));
+}
+
+DoublyLinkedList<int> DistanceMatrix::getVertexPredecessors(int vertexID) const {
+    DoublyLinkedList<int> predecessors;
+    for (int i = 0; i < vertexCount; ++i) {
+        if (this->getCost(i, vertexID) != std::numeric_limits<int>::max()) {
+            predecessors.insertAtEnd(i);
+        }
+    }
+    return predecessors;
+}
+
+void DistanceMatrix::setEdgeParameter(int startVertexID, int endVertexID, int parameter) {
+    costs[static_cast<std::size_t>(startVertexID) * rowStride + endVertexID] = parameter;
+    if (this->TYPE == GraphType::Undirected) {
+        costs[static_cast<std::size_t>(endVertexID) * rowStride + startVertexID] = parameter;
+    }
+}
+
+void DistanceMatrix::assignCosts(const int *costMatrix) {
+    edgeCount = 0;
+    for (int i = 0; i < vertexCount; ++i) {
+        int *row = costs + static_cast<std::size_t>(i) * rowStride;
+        const int *sourceRow = costMatrix + static_cast<std::size_t>(i) * vertexCount;
+        if (this->TYPE == GraphType::Directed) {
+            std::copy(sourceRow, sourceRow + vertexCount, row);
+            row[i] = std::numeric_limits<int>::max();
+            // Every missing edge, the diagonal included, holds the maximum
+            edgeCount += vertexCount - static_cast<int>(std::count(row, row + vertexCount,
+                                                                   std::numeric_limits<int>::max()));
+        } else {
+            row[i] = std::numeric_limits<int>::max();
+            for (int j = i + 1; j < vertexCount; ++j) {
+                row[j] = sourceRow[j];
+                costs[static_cast<std::size_t>(j) * rowStride + i] = sourceRow[j];
+                if (sourceRow[j] != std::numeric_limits<int>::max()) {
+                    ++edgeCount;
+                }
+            }
+        }
+    }
+}
+
+int DistanceMatrix::getEdgeCount() const {
+    return edgeCount;
+}
+
+double DistanceMatrix::getDensity() const {
+    if (this->TYPE == GraphType::Directed) {
+        return static_cast<double>(edgeCount) / (vertexCount * (vertexCount - 1));
+    } else {
+        return static_cast<double>(edgeCount) / ((vertexCount * (vertexCount - 1)) / 2);
+    }
+}
+
+std::string DistanceMatrix::toString() const {
+    const int numberFieldLen = 3;
+    std::stringstream graphString;
+    graphString << std::endl << "Distance matrix:" << std::endl;
+    graphString << "V\\V";
+    for (int j = 0; j < vertexCount; ++j) {
+        graphString << std::setw(numberFieldLen) << j << ',';
+    }
+    graphString << std::endl;
+    for (int i = 0; i < vertexCount; ++i) {
+        graphString << std::setw(2) << std::to_string(i) << "[";
+        for (int j = 0; j < vertexCount; ++j) {
+            graphString << std::setw(numberFieldLen) <<
+                        ((this->getCost(i, j) == std::numeric_limits<int>::max()) ? "*" : std::to_string(
+                                this->getCost(i, j)));
+            if (j != vertexCount - 1) {
+                graphString << ',';
+            }
+        }
+        graphString << ']' << std::endl;
+    }
+    return graphString.str();
+}
+
+IGraph::GraphType DistanceMatrix::getGraphType() const {
+    return TYPE;
+}
+
+IGraph::GraphStructure DistanceMatrix::getGraphStructure() const {
+    return FlatMatrix;
+}
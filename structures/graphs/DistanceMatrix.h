@@ -0,0 +1,103 @@
+#ifndef PEA_P1_DISTANCEMATRIX_H
+#define PEA_P1_DISTANCEMATRIX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "IGraph.h"
+#include "../DoublyLinkedList.h"
+
+// Costs of all edges stored in one aligned, row-major buffer
+// Missing edges (and the diagonal) hold std::numeric_limits<int>::max(), loops and multiple edges are disallowed
+// Vertex count is fixed at construction
+class DistanceMatrix final : public IGraph {
+public:
+
+    DistanceMatrix(GraphType graphType, int nVertex);
+
+    ~DistanceMatrix() override;
+
+    DistanceMatrix(const DistanceMatrix &otherMatrix) = delete;
+
+    DistanceMatrix &operator=(const DistanceMatrix &otherMatrix) = delete;
+
+    void addEdge(int startVertexID, int endVertexID, int edgeParameter) override;
+
+    void removeEdge(int startVertexID, int endVertexID) override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexSuccessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertices() const override;
+
+    [[nodiscard]] ArrayView<int> getSuccessorsView(int vertexID) const override;
+
+    // Borrowed view of the row
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override {
+        return {getRow(vertexID), vertexCount};
+    }
+
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return getCost(startVertexID, endVertexID);
+    }
+
+    // Replaces all edges with costs from row-major getVertexCount() x getVertexCount() costMatrix, without per-edge checks
+    // The diagonal is skipped, undirected graph reads only the upper triangle, std::numeric_limits<int>::max() is no edge
+    void assignCosts(const int *costMatrix);
+
+    void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
+
+    // Non-virtual, unchecked accessor for hot loops
+    [[nodiscard]] int getCost(int startVertexID, int endVertexID) const {
+        return costs[static_cast<std::size_t>(startVertexID) * rowStride + endVertexID];
+    }
+
+    // Pointer to the first of getVertexCount() costs of edges leaving vertexID (row start is ALIGNMENT aligned)
+    [[nodiscard]] const int *getRow(int vertexID) const {
+        return costs + static_cast<std::size_t>(vertexID) * rowStride;
+    }
+
+    [[nodiscard]] int getVertexCount() const override {
+        return vertexCount;
+    }
+
+    [[nodiscard]] int getEdgeCount() const override;
+
+    [[nodiscard]] double getDensity() const override;
+
+    [[nodiscard]] std::string toString() const override;
+
+    [[nodiscard]] GraphType getGraphType() const override;
+
+    [[nodiscard]] GraphStructure getGraphStructure() const override;
+
+    // Alignment (in bytes) of the buffer and of every row
+    static const std::size_t ALIGNMENT = 64;
+
+private:
+
+    // Vertex count is fixed - always throws
+    void addVertex() override;
+
+    const GraphType TYPE;
+
+    const int vertexCount;
+
+    // Number of ints between starts of consecutive rows (vertexCount rounded up to ALIGNMENT)
+    const std::size_t rowStride;
+
+    int edgeCount;
+
+    // Weight or flow, rowStride * vertexCount elements
+    int *costs;
+
+    friend class DistanceMatrixTest;
+};
+
+#endif //PEA_P1_DISTANCEMATRIX_H
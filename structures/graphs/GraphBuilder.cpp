@@ -0,0 +1,400 @@
+#include "GraphBuilder.h"
+
+IGraph *GraphBuilder::build(IGraph::GraphType graphType, int nVertex, const int *costMatrix,
+                            IGraph::GraphStructure graphStructure) {
+    const bool isDirected = graphType == IGraph::GraphType::Directed;
+    switch (graphStructure) {
+        case IGraph::GraphStructure::AdjacencyList: {
+            auto graph = std::make_unique<ListGraph>(graphType, nVertex);
+            fill(*graph, costMatrix);
+            return graph.release();
+        }
+        case IGraph::GraphStructure::IncidenceMatrix: {
+            auto graph = std::make_unique<MatrixGraph>(graphType, nVertex);
+            fill(*graph, costMatrix);
+            return graph.release();
+        }
+        case IGraph::GraphStructure::CompressedSparseRow: {
+            // Rows are built at once, adding edges one by one would shift them
+            Table<Edge> edges;
+            for (int i = 0; i < nVertex; ++i) {
+                const int *costRow = costMatrix + static_cast<std::size_t>(i) * nVertex;
+                for (int j = isDirected ? 0 : i + 1; j < nVertex; ++j) {
+                    if (j != i && costRow[j] != std::numeric_limits<int>::max()) {
+                        edges.emplaceAtEnd(i, j, costRow[j]);
+                    }
+                }
+            }
+            return new SparseGraph(graphType, nVertex, edges);
+        }
+        default:
+            break;
+    }
+
+    // Range of used costs picks width of QuantizedFlatMatrix, min and max are taken without branches
+    int minEdgeParameter = std::numeric_limits<int>::max(), maxEdgeParameter = std::numeric_limits<int>::min();
+    for (int i = 0; i < nVertex; ++i) {
+        const int *costRow = costMatrix + static_cast<std::size_t>(i) * nVertex;
+        // Used entries on both sides of the diagonal, the left side is empty for undirected graphs
+        for (int j = isDirected ? 0 : i; j < i; ++j) {
+            minEdgeParameter = std::min(minEdgeParameter, costRow[j]);
+            maxEdgeParameter = std::max(maxEdgeParameter, costRow[j]);
+        }
+        for (int j = i + 1; j < nVertex; ++j) {
+            minEdgeParameter = std::min(minEdgeParameter, costRow[j]);
+            maxEdgeParameter = std::max(maxEdgeParameter, costRow[j]);
+        }
+    }
+    // Graph of one vertex has no edges
+    if (minEdgeParameter > maxEdgeParameter) {
+        minEdgeParameter = maxEdgeParameter = 0;
+    }
+    std::unique_ptr<IGraph> graph(createGraph(graphType, nVertex, graphStructure, minEdgeParameter,
+                                              maxEdgeParameter));
+    if (!assignCostMatrix(graph.get(), costMatrix)) {
+        throw std::invalid_argument("build() error: unknown graph structure");
+    }
+    return graph.release();
+}
+
+IGraph *GraphBuilder::build(IGraph::GraphType graphType, int nVertex, const Table<Edge> &edges,
+                            IGraph::GraphStructure graphStructure) {
+    switch (graphStructure) {
+        case IGraph::GraphStructure::AdjacencyList: {
+            auto graph = std::make_unique<ListGraph>(graphType, nVertex);
+            fill(*graph, edges);
+            return graph.release();
+        }
+        case IGraph::GraphStructure::IncidenceMatrix: {
+            auto graph = std::make_unique<MatrixGraph>(graphType, nVertex);
+            fill(*graph, edges);
+            return graph.release();
+        }
+        case IGraph::GraphStructure::CompressedSparseRow:
+            return new SparseGraph(graphType, nVertex, edges);
+        default:
+            break;
+    }
+
+    int minEdgeParameter = 0, maxEdgeParameter = 0;
+    for (int k = 0; k < edges.getSize(); ++k) {
+        minEdgeParameter = (k == 0) ? edges[k].parameter : std::min(minEdgeParameter, edges[k].parameter);
+        maxEdgeParameter = (k == 0) ? edges[k].parameter : std::max(maxEdgeParameter, edges[k].parameter);
+    }
+    std::unique_ptr<IGraph> graph(createGraph(graphType, nVertex, graphStructure, minEdgeParameter,
+                                              maxEdgeParameter));
+    validateEdges(nVertex, edges);
+    // Flat matrices store an edge in O(1) without reallocation, only multiple edges are left to be detected
+    for (int k = 0; k < edges.getSize(); ++k) {
+        graph->addEdge(edges[k].startVertexID, edges[k].endVertexID, edges[k].parameter);
+    }
+    return graph.release();
+}
+
+IGraph *GraphBuilder::createGraph(IGraph::GraphType graphType, int nVertex, IGraph::GraphStructure graphStructure,
+                                  int minEdgeParameter, int maxEdgeParameter) {
+    switch (graphStructure) {
+        case IGraph::GraphStructure::IncidenceMatrix:
+            return new MatrixGraph(graphType, nVertex);
+        case IGraph::GraphStructure::AdjacencyList:
+            return new ListGraph(graphType, nVertex);
+        case IGraph::GraphStructure::FlatMatrix:
+            return new DistanceMatrix(graphType, nVertex);
+        case IGraph::GraphStructure::QuantizedFlatMatrix:
+            // Narrowest cost type able to store every edge parameter, int32 costs are kept by DistanceMatrix
+            if (QuantizedMatrix<std::uint8_t>::canStore(minEdgeParameter, maxEdgeParameter)) {
+                return new QuantizedMatrix<std::uint8_t>(graphType, nVertex);
+            }
+            if (QuantizedMatrix<std::uint16_t>::canStore(minEdgeParameter, maxEdgeParameter)) {
+                return new QuantizedMatrix<std::uint16_t>(graphType, nVertex);
+            }
+            return new DistanceMatrix(graphType, nVertex);
+        case IGraph::GraphStructure::PackedTriangular:
+            return new TriangularMatrix(graphType, nVertex);
+        case IGraph::GraphStructure::CompressedSparseRow:
+            return new SparseGraph(graphType, nVertex);
+        case IGraph::GraphStructure::TiledFlatMatrix:
+            return new TiledMatrix(graphType, nVertex, TiledMatrix::Tiles);
+        case IGraph::GraphStructure::MortonFlatMatrix:
+            return new TiledMatrix(graphType, nVertex, TiledMatrix::MortonTiles);
+        case IGraph::GraphStructure::NodeCoordinates:
+            throw std::invalid_argument("createGraph() error: NodeCoordinates graphs are created from coordinates "
+                                        "of TSPLIB instances (see loadTSPLIBInstance())");
+        case IGraph::GraphStructure::MappedFlatMatrix:
+            throw std::invalid_argument("createGraph() error: MappedFlatMatrix graphs are mapped from binary "
+                                        "instance files (see loadTSPInstance())");
+    }
+    throw std::invalid_argument("createGraph() error: unknown graph structure");
+}
+
+bool GraphBuilder::assignCostMatrix(IGraph *graph, const int *costMatrix) {
+    // QuantizedFlatMatrix instance may be DistanceMatrix, so the structure reported by the graph is used
+    switch (graph->getGraphStructure()) {
+        case IGraph::GraphStructure::FlatMatrix:
+            static_cast<DistanceMatrix *>(graph)->assignCosts(costMatrix);
+            return true;
+        case IGraph::GraphStructure::QuantizedFlatMatrix:
+            if (auto *narrowGraph = dynamic_cast<QuantizedMatrix<std::uint8_t> *>(graph)) {
+                narrowGraph->assignCosts(costMatrix);
+            } else {
+                static_cast<QuantizedMatrix<std::uint16_t> *>(graph)->assignCosts(costMatrix);
+            }
+            return true;
+        case IGraph::GraphStructure::PackedTriangular:
+            static_cast<TriangularMatrix *>(graph)->assignCosts(costMatrix);
+            return true;
+        case IGraph::GraphStructure::TiledFlatMatrix:
+        case IGraph::GraphStructure::MortonFlatMatrix:
+            static_cast<TiledMatrix *>(graph)->assignCosts(costMatrix);
+            return true;
+        default:
+            return false;
+    }
+}
+
+void GraphBuilder::fill(ListGraph &graph, const int *costMatrix) {
+    const int nVertex = graph.getVertexCount();
+    const int missingEdge = std::numeric_limits<int>::max();
+    const bool isDirected = graph.TYPE == IGraph::GraphType::Directed;
+
+    // Parameters matrix row by row, undirected graphs mirror the upper triangle into the lower one
+    Table<int> successorCounts, predecessorCounts;
+    successorCounts.resize(nVertex, 0);
+    predecessorCounts.resize(nVertex, 0);
+    int *nSuccessors = successorCounts.getData();
+    int *nPredecessors = predecessorCounts.getData();
+    for (int i = 0; i < nVertex; ++i) {
+        int *parameters = graph.parametersMatrix[i].getData();
+        const int *costRow = costMatrix + static_cast<std::size_t>(i) * nVertex;
+        if (isDirected) {
+            std::copy(costRow, costRow + nVertex, parameters);
+        } else {
+            for (int j = 0; j < i; ++j) {
+                parameters[j] = graph.parametersMatrix[j][i];
+            }
+            std::copy(costRow + i + 1, costRow + nVertex, parameters + i + 1);
+        }
+        parameters[i] = missingEdge;
+        // Counts are summed without branches, so that these loops vectorize
+        int rowCount = 0;
+        for (int j = 0; j < nVertex; ++j) {
+            rowCount += parameters[j] != missingEdge;
+        }
+        nSuccessors[i] = rowCount;
+        if (isDirected) {
+            for (int j = 0; j < nVertex; ++j) {
+                nPredecessors[j] += parameters[j] != missingEdge;
+            }
+        }
+    }
+
+    // Rows get their final sizes and are written through pointers
+    Table<int *> predecessorEnds;
+    predecessorEnds.resize(nVertex, nullptr);
+    int nEntries = 0;
+    for (int v = 0; v < nVertex; ++v) {
+        graph.successorsLists[v].resize(nSuccessors[v]);
+        if (isDirected) {
+            graph.predecessorsLists[v].resize(nPredecessors[v]);
+            predecessorEnds[v] = graph.predecessorsLists[v].getData();
+        }
+        nEntries += nSuccessors[v];
+    }
+    for (int i = 0; i < nVertex; ++i) {
+        const int *parameters = graph.parametersMatrix[i].getData();
+        int *successorIDs = graph.successorsLists[i].getData();
+        if (isDirected) {
+            for (int j = 0; j < nVertex; ++j) {
+                if (parameters[j] != missingEdge) {
+                    *successorIDs++ = j;
+                    *predecessorEnds[j]++ = i;
+                }
+            }
+        } else {
+            for (int j = 0; j < nVertex; ++j) {
+                if (parameters[j] != missingEdge) {
+                    *successorIDs++ = j;
+                }
+            }
+        }
+    }
+    // Undirected edges are listed at both endpoints
+    graph.edgeCount = isDirected ? nEntries : nEntries / 2;
+}
+
+void GraphBuilder::fill(ListGraph &graph, const Table<Edge> &edges) {
+    const int nVertex = graph.getVertexCount();
+    const bool isDirected = graph.TYPE == IGraph::GraphType::Directed;
+    validateEdges(nVertex, edges);
+
+    Table<int> successorCounts, predecessorCounts;
+    successorCounts.resize(nVertex, 0);
+    predecessorCounts.resize(nVertex, 0);
+    for (int k = 0; k < edges.getSize(); ++k) {
+        ++successorCounts[edges[k].startVertexID];
+        ++(isDirected ? predecessorCounts : successorCounts)[edges[k].endVertexID];
+    }
+    reserveRows(graph.successorsLists, successorCounts);
+    if (isDirected) {
+        reserveRows(graph.predecessorsLists, predecessorCounts);
+    }
+
+    for (int k = 0; k < edges.getSize(); ++k) {
+        const Edge &edge = edges[k];
+        int &parameter = graph.parametersMatrix[edge.startVertexID][edge.endVertexID];
+        // Multiple edges are not represented in this graph's structure
+        if (parameter != std::numeric_limits<int>::max()) {
+            throw std::invalid_argument("build() error: multiple edges are disallowed");
+        }
+        parameter = edge.parameter;
+        graph.successorsLists[edge.startVertexID].insertAtEnd(edge.endVertexID);
+        if (isDirected) {
+            graph.predecessorsLists[edge.endVertexID].insertAtEnd(edge.startVertexID);
+        } else {
+            graph.successorsLists[edge.endVertexID].insertAtEnd(edge.startVertexID);
+            graph.parametersMatrix[edge.endVertexID][edge.startVertexID] = edge.parameter;
+        }
+    }
+    graph.edgeCount = edges.getSize();
+}
+
+void GraphBuilder::fill(MatrixGraph &graph, const int *costMatrix) {
+    const int nVertex = graph.getVertexCount();
+    const int missingEdge = std::numeric_limits<int>::max();
+    const bool isDirected = graph.TYPE == IGraph::GraphType::Directed;
+
+    // Row sizes first: edges leaving (or incident to) and entering every vertex
+    Table<int> outgoingCounts, incomingCounts;
+    outgoingCounts.resize(nVertex, 0);
+    incomingCounts.resize(nVertex, 0);
+    int *nOutgoing = outgoingCounts.getData();
+    int *nEndpoint = isDirected ? incomingCounts.getData() : nOutgoing;
+    int edgeCount = 0;
+    for (int i = 0; i < nVertex; ++i) {
+        const int *costRow = costMatrix + static_cast<std::size_t>(i) * nVertex;
+        int rowCount = 0;
+        for (int j = isDirected ? 0 : i + 1; j < nVertex; ++j) {
+            const int isEdge = (costRow[j] != missingEdge) & (j != i);
+            rowCount += isEdge;
+            nEndpoint[j] += isEdge;
+        }
+        nOutgoing[i] += rowCount;
+        edgeCount += rowCount;
+    }
+
+    graph.edgeStarts.resize(edgeCount);
+    graph.edgeEnds.resize(edgeCount);
+    graph.edgeParameters.resize(edgeCount);
+    reserveRows(graph.outgoingEdges, outgoingCounts);
+    if (isDirected) {
+        reserveRows(graph.incomingEdges, incomingCounts);
+    }
+    graph.edgeIndex.reserve(edgeCount);
+    int *starts = graph.edgeStarts.getData();
+    int *ends = graph.edgeEnds.getData();
+    int *parameters = graph.edgeParameters.getData();
+    int edgeID = 0;
+    for (int i = 0; i < nVertex; ++i) {
+        const int *costRow = costMatrix + static_cast<std::size_t>(i) * nVertex;
+        for (int j = isDirected ? 0 : i + 1; j < nVertex; ++j) {
+            if (j == i || costRow[j] == missingEdge) {
+                continue;
+            }
+            starts[edgeID] = i;
+            ends[edgeID] = j;
+            parameters[edgeID] = costRow[j];
+            graph.outgoingEdges[i].insertAtEnd(edgeID);
+            (isDirected ? graph.incomingEdges : graph.outgoingEdges)[j].insertAtEnd(edgeID);
+            graph.edgeIndex.emplace(graph.getEdgeKey(i, j), edgeID);
+            ++edgeID;
+        }
+    }
+}
+
+void GraphBuilder::fill(MatrixGraph &graph, const Table<Edge> &edges) {
+    const int nVertex = graph.getVertexCount();
+    const bool isDirected = graph.TYPE == IGraph::GraphType::Directed;
+    validateEdges(nVertex, edges);
+
+    Table<int> outgoingCounts, incomingCounts;
+    outgoingCounts.resize(nVertex, 0);
+    incomingCounts.resize(nVertex, 0);
+    for (int k = 0; k < edges.getSize(); ++k) {
+        ++outgoingCounts[edges[k].startVertexID];
+        ++(isDirected ? incomingCounts : outgoingCounts)[edges[k].endVertexID];
+    }
+    const int edgeCount = edges.getSize();
+    graph.edgeStarts.resize(edgeCount);
+    graph.edgeEnds.resize(edgeCount);
+    graph.edgeParameters.resize(edgeCount);
+    reserveRows(graph.outgoingEdges, outgoingCounts);
+    if (isDirected) {
+        reserveRows(graph.incomingEdges, incomingCounts);
+    }
+    graph.edgeIndex.reserve(edgeCount);
+
+    for (int edgeID = 0; edgeID < edgeCount; ++edgeID) {
+        const Edge &edge = edges[edgeID];
+        // Multiple edges are not represented in this graph's structure
+        if (!graph.edgeIndex.emplace(graph.getEdgeKey(edge.startVertexID, edge.endVertexID), edgeID).second) {
+            throw std::invalid_argument("build() error: multiple edges are disallowed");
+        }
+        graph.edgeStarts[edgeID] = edge.startVertexID;
+        graph.edgeEnds[edgeID] = edge.endVertexID;
+        graph.edgeParameters[edgeID] = edge.parameter;
+        graph.outgoingEdges[edge.startVertexID].insertAtEnd(edgeID);
+        (isDirected ? graph.incomingEdges : graph.outgoingEdges)[edge.endVertexID].insertAtEnd(edgeID);
+    }
+}
+
+void GraphBuilder::validateEdges(int nVertex, const Table<Edge> &edges) {
+    // Violations are accumulated without branches and reported once, after the whole array is checked
+    // (negative indexes wrap around to large unsigned ones)
+    const auto vertexCount = static_cast<unsigned int>(nVertex);
+    const Edge *edgeData = edges.getData();
+    unsigned int isIndexInvalid = 0, isLoop = 0;
+    for (int k = 0; k < edges.getSize(); ++k) {
+        const auto startVertexID = static_cast<unsigned int>(edgeData[k].startVertexID);
+        const auto endVertexID = static_cast<unsigned int>(edgeData[k].endVertexID);
+        isIndexInvalid |= (startVertexID >= vertexCount) | (endVertexID >= vertexCount);
+        isLoop |= startVertexID == endVertexID;
+    }
+    if (isIndexInvalid) {
+        throw std::invalid_argument("build() error: invalid vertex's index");
+    }
+    if (isLoop) {
+        throw std::invalid_argument("build() error: loops are disallowed");
+    }
+}
+
+void GraphBuilder::reserveRows(Table<Table<int>> &rows, const Table<int> &rowSizes) {
+    for (int v = 0; v < rows.getSize(); ++v) {
+        rows[v].reserve(rowSizes[v]);
+    }
+}
+
+Table<Edge> GraphBuilder::collectEdges(const ListGraph &graph) {
+    const bool isDirected = graph.TYPE == IGraph::GraphType::Directed;
+    Table<Edge> edges;
+    edges.reserve(graph.edgeCount);
+    for (int vertex = 0; vertex < graph.getVertexCount(); ++vertex) {
+        const Table<int> &successors = graph.successorsLists[vertex];
+        for (int k = 0; k < successors.getSize(); ++k) {
+            const int successor = successors[k];
+            // Undirected edge is listed at both endpoints
+            if (isDirected || vertex < successor) {
+                edges.emplaceAtEnd(vertex, successor, graph.parametersMatrix[vertex][successor]);
+            }
+        }
+    }
+    return edges;
+}
+
+Table<Edge> GraphBuilder::collectEdges(const MatrixGraph &graph) {
+    Table<Edge> edges;
+    edges.reserve(graph.getEdgeCount());
+    for (int edgeID = 0; edgeID < graph.getEdgeCount(); ++edgeID) {
+        edges.emplaceAtEnd(graph.edgeStarts[edgeID], graph.edgeEnds[edgeID], graph.edgeParameters[edgeID]);
+    }
+    return edges;
+}
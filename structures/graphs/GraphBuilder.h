@@ -0,0 +1,75 @@
+#ifndef PEA_P1_GRAPHBUILDER_H
+#define PEA_P1_GRAPHBUILDER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "IGraph.h"
+#include "ListGraph.h"
+#include "MatrixGraph.h"
+#include "DistanceMatrix.h"
+#include "QuantizedMatrix.h"
+#include "TriangularMatrix.h"
+#include "SparseGraph.h"
+#include "TiledMatrix.h"
+#include "misc/Edge.h"
+#include "../Table.h"
+
+// Builds whole graphs at once from a cost matrix or an array of edges, instead of edge by edge with addEdge()
+// Input is validated in one pass before anything is stored, then rows of ListGraph and MatrixGraph are
+// allocated to their final size and filled; edges are stored in the same order as by addEdge() calls
+// Invalid input throws std::invalid_argument (vertex's index out of range, loop or multiple edge)
+class GraphBuilder {
+public:
+
+    // costMatrix - row-major nVertex x nVertex; entries off the diagonal other than
+    // std::numeric_limits<int>::max() are edges, undirected graphs are built from the upper triangle
+    [[nodiscard]] static IGraph *build(IGraph::GraphType graphType, int nVertex, const int *costMatrix,
+                                       IGraph::GraphStructure graphStructure);
+
+    // Reversed pair of an undirected edge counts as a multiple edge
+    [[nodiscard]] static IGraph *build(IGraph::GraphType graphType, int nVertex, const Table<Edge> &edges,
+                                       IGraph::GraphStructure graphStructure);
+
+    // Creates empty graph of given structure, able to store edge parameters from [minEdgeParameter, maxEdgeParameter]
+    [[nodiscard]] static IGraph *createGraph(IGraph::GraphType graphType, int nVertex,
+                                             IGraph::GraphStructure graphStructure,
+                                             int minEdgeParameter, int maxEdgeParameter);
+
+    // Writes whole row-major cost matrix to a flat matrix graph (see assignCosts() of matrices)
+    // Returns false, leaving the graph unchanged, for other structures
+    static bool assignCostMatrix(IGraph *graph, const int *costMatrix);
+
+private:
+
+    // Fill empty graphs created with (graphType, nVertex) constructors
+    static void fill(ListGraph &graph, const int *costMatrix);
+
+    static void fill(ListGraph &graph, const Table<Edge> &edges);
+
+    static void fill(MatrixGraph &graph, const int *costMatrix);
+
+    static void fill(MatrixGraph &graph, const Table<Edge> &edges);
+
+    // Checks vertex indexes and loops of all edges, multiple edges are detected while filling
+    static void validateEdges(int nVertex, const Table<Edge> &edges);
+
+    // Pre-sizes rows to exact counts, so that filling them does not reallocate
+    static void reserveRows(Table<Table<int>> &rows, const Table<int> &rowSizes);
+
+    // Edges of the other structure, in the order its rows list them (each undirected edge once)
+    [[nodiscard]] static Table<Edge> collectEdges(const ListGraph &graph);
+
+    [[nodiscard]] static Table<Edge> collectEdges(const MatrixGraph &graph);
+
+    // Converting constructors build from the other structure
+    friend class ListGraph;
+
+    friend class MatrixGraph;
+};
+
+
+#endif //PEA_P1_GRAPHBUILDER_H
@@ -0,0 +1,71 @@
+#ifndef PEA_P1_GRAPHDISPATCHER_H
+#define PEA_P1_GRAPHDISPATCHER_H
+
+#include "IGraph.h"
+#include "ListGraph.h"
+#include "MatrixGraph.h"
+#include "DistanceMatrix.h"
+#include "QuantizedMatrix.h"
+#include "TriangularMatrix.h"
+#include "SparseGraph.h"
+#include "TiledMatrix.h"
+#include "CoordinateGraph.h"
+#include "MappedMatrix.h"
+
+// Resolves the concrete type of an IGraph once, so that templated algorithms called with it
+// can inline edge lookups instead of going through the vtable on every access
+class GraphDispatcher {
+public:
+
+    // Calls function with graph cast to its concrete type (const reference)
+    // Graph structures without a dedicated case are passed as const IGraph &
+    template<class TFunction>
+    static auto dispatch(const IGraph *graph, TFunction &&function) {
+        switch (graph->getGraphStructure()) {
+            case IGraph::GraphStructure::AdjacencyList:
+                return function(static_cast<const ListGraph &>(*graph));
+            case IGraph::GraphStructure::IncidenceMatrix:
+                return function(static_cast<const MatrixGraph &>(*graph));
+            case IGraph::GraphStructure::FlatMatrix:
+                return function(static_cast<const DistanceMatrix &>(*graph));
+            case IGraph::GraphStructure::QuantizedFlatMatrix:
+                if (const auto *narrowGraph = dynamic_cast<const QuantizedMatrix<std::uint8_t> *>(graph)) {
+                    return function(*narrowGraph);
+                }
+                return function(static_cast<const QuantizedMatrix<std::uint16_t> &>(*graph));
+            case IGraph::GraphStructure::PackedTriangular:
+                return function(static_cast<const TriangularMatrix &>(*graph));
+            case IGraph::GraphStructure::CompressedSparseRow:
+                return function(static_cast<const SparseGraph &>(*graph));
+            case IGraph::GraphStructure::TiledFlatMatrix:
+            case IGraph::GraphStructure::MortonFlatMatrix:
+                return function(static_cast<const TiledMatrix &>(*graph));
+            case IGraph::GraphStructure::NodeCoordinates:
+                return function(static_cast<const CoordinateGraph &>(*graph));
+            case IGraph::GraphStructure::MappedFlatMatrix:
+                return function(static_cast<const MappedMatrix &>(*graph));
+            default:
+                return function(*graph);
+        }
+    }
+
+private:
+    GraphDispatcher() = default;
+};
+
+// Expands INSTANTIATE(TGraph) for IGraph and every graph type handled by GraphDispatcher::dispatch()
+// Used for explicit instantiations of templated algorithms
+#define PEA_P1_FOR_EACH_DISPATCHED_GRAPH(INSTANTIATE) \
+    INSTANTIATE(IGraph)                               \
+    INSTANTIATE(ListGraph)                            \
+    INSTANTIATE(MatrixGraph)                          \
+    INSTANTIATE(DistanceMatrix)                       \
+    INSTANTIATE(QuantizedMatrix<std::uint8_t>)        \
+    INSTANTIATE(QuantizedMatrix<std::uint16_t>)       \
+    INSTANTIATE(TriangularMatrix)                     \
+    INSTANTIATE(SparseGraph)                          \
+    INSTANTIATE(TiledMatrix)                          \
+    INSTANTIATE(CoordinateGraph)                      \
+    INSTANTIATE(MappedMatrix)
+
+#endif //PEA_P1_GRAPHDISPATCHER_H
@@ -1,6 +1,37 @@
+#include <limits>
+
 #include "IGraph.h"
 
+// Copies list into a view owning the elements
+static ArrayView<int> toOwningView(const DoublyLinkedList<int> &list) {
+    Table<int> elements;
+    elements.reserve(list.getSize());
+    for (auto it = list.getIterator(); it != list.getEndIt(); ++it) {
+        elements.insertAtEnd(it.getData());
+    }
+    return ArrayView<int>(std::move(elements));
+}
+
+ArrayView<int> IGraph::getSuccessorsView(int vertexID) const {
+    return toOwningView(this->getVertexSuccessors(vertexID));
+}
+
+ArrayView<int> IGraph::getPredecessorsView(int vertexID) const {
+    return toOwningView(this->getVertexPredecessors(vertexID));
+}
+
+ArrayView<int> IGraph::getCostRowView(int vertexID) const {
+    const int vertexCount = this->getVertexCount();
+    Table<int> costs;
+    costs.resize(vertexCount, std::numeric_limits<int>::max());
+    DoublyLinkedList<int> successors = this->getVertexSuccessors(vertexID);
+    for (auto it = successors.getIterator(); it != successors.getEndIt(); ++it) {
+        costs[it.getData()] = this->getEdgeParameter(vertexID, it.getData());
+    }
+    return ArrayView<int>(std::move(costs));
+}
+
 std::ostream &operator<<(std::ostream &ostr, const IGraph &graph) {
     ostr << graph.toString();
     return ostr;
-}
\ No newline at end of file
+}
@@ -2,8 +2,10 @@
 #define PEA_P1_IGRAPH_H
 
 #include <iostream>
+#include <type_traits>
 
 #include "../DoublyLinkedList.h"
+#include "../ArrayView.h"
 #include "misc/Edge.h"
 
 class IGraph {
@@ -14,7 +16,8 @@ public:
     };
 
     enum GraphStructure {
-        IncidenceMatrix, AdjacencyList
+        IncidenceMatrix, AdjacencyList, FlatMatrix, QuantizedFlatMatrix, PackedTriangular, CompressedSparseRow,
+        TiledFlatMatrix, MortonFlatMatrix, NodeCoordinates, MappedFlatMatrix
     };
 
     virtual ~IGraph() = default;
@@ -29,6 +32,18 @@ public:
 
     [[nodiscard]] virtual DoublyLinkedList<int> getVertices() const = 0;
 
+    // Views below don't copy if the structure keeps the elements contiguously, otherwise they own one buffer
+    // Borrowed views are invalidated by any modification of the graph
+    // Default implementations are built from the list-returning methods above
+
+    [[nodiscard]] virtual ArrayView<int> getSuccessorsView(int vertexID) const;
+
+    [[nodiscard]] virtual ArrayView<int> getPredecessorsView(int vertexID) const;
+
+    // getVertexCount() costs of edges leaving vertexID, indexed by end vertex
+    // Missing edges (and the diagonal) are std::numeric_limits<int>::max()
+    [[nodiscard]] virtual ArrayView<int> getCostRowView(int vertexID) const;
+
     [[nodiscard]] virtual int getEdgeParameter(int startVertexID, int endVertexID) const = 0;
 
     virtual void setEdgeParameter(int startVertexID, int endVertexID, int parameter) = 0;
@@ -52,4 +67,9 @@ private:
 
 std::ostream &operator<<(std::ostream &ostr, const IGraph &graph);
 
+// Restricts templated algorithm overloads to graph objects, so that calls with (const) IGraph *
+// keep resolving to the pointer-taking entry points
+template<class TGraph>
+using EnableIfGraph = std::enable_if_t<std::is_base_of_v<IGraph, TGraph>, int>;
+
 #endif //PEA_P1_IGRAPH_H
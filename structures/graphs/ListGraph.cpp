@@ -1,34 +1,31 @@
 #include "ListGraph.h"
+#include "GraphBuilder.h"
 
 ListGraph::ListGraph(ListGraph::GraphType graphType, int nVertex) : TYPE(graphType), edgeCount(0) {
     if (nVertex < 1) {
         throw std::invalid_argument("ListGraph() error: graph must have at least one vertex");
     }
+    // Same result as nVertex calls of addVertex(), but every row is allocated once
+    successorsLists.resize(nVertex);
+    if (this->TYPE == GraphType::Directed) {
+        predecessorsLists.resize(nVertex);
+    }
+    parametersMatrix.resize(nVertex);
     for (int i = 0; i < nVertex; ++i) {
-        this->addVertex();
+        parametersMatrix[i].resize(nVertex, std::numeric_limits<int>::max());
     }
 }
 
-ListGraph::ListGraph(const MatrixGraph *mGraph) : TYPE(mGraph->getGraphType()), edgeCount(0) {
-    auto vertices = mGraph->getVertices();
-    for (int i = 0; i < vertices.getSize(); ++i) {
-        this->addVertex();
-    }
-    DoublyLinkedList<int> successors;
-    for (auto vIt = vertices.getIterator(); vIt != vertices.getEndIt(); ++vIt) {
-        successors = mGraph->getVertexSuccessors(vIt.getData());
-        for (auto sIt = successors.getIterator(); sIt != successors.getEndIt(); ++sIt) {
-            try {
-                this->addEdge(vIt.getData(), sIt.getData(), mGraph->getEdgeParameter(vIt.getData(), sIt.getData()));
-            } catch (const std::invalid_argument &e) {
-                // Skip already added edge
-            }
-        }
-    }
+ListGraph::ListGraph(const MatrixGraph *mGraph) : ListGraph(mGraph->getGraphType(), mGraph->getVertexCount()) {
+    // Every edge of mGraph is stored once, in order of edge IDs
+    GraphBuilder::fill(*this, GraphBuilder::collectEdges(*mGraph));
 }
 
 void ListGraph::addVertex() {
-    successorsLists.insertAtEnd(DoublyLinkedList<int>());
+    successorsLists.emplaceAtEnd();
+    if (this->TYPE == GraphType::Directed) {
+        predecessorsLists.emplaceAtEnd();
+    }
 
     parametersMatrix.insertAtEnd(Table<int>());
     int vertexCount = this->getVertexCount();
@@ -56,7 +53,9 @@ void ListGraph::addEdge(int startVertexID, int endVertexID, int edgeParameter) {
 
     successorsLists[startVertexID].insertAtEnd(endVertexID);
     parametersMatrix[startVertexID][endVertexID] = edgeParameter;
-    if (this->TYPE == GraphType::Undirected) {
+    if (this->TYPE == GraphType::Directed) {
+        predecessorsLists[endVertexID].insertAtEnd(startVertexID);
+    } else {
         successorsLists[endVertexID].insertAtEnd(startVertexID);
         parametersMatrix[endVertexID][startVertexID] = edgeParameter;
     }
@@ -72,10 +71,12 @@ void ListGraph::removeEdge(int startVertexID, int endVertexID) {
         throw std::invalid_argument("addEdge() error: described edge does not exist");
     }
 
-    successorsLists[startVertexID].removeByValue(endVertexID);
+    removeFromList(successorsLists[startVertexID], endVertexID);
     parametersMatrix[startVertexID][endVertexID] = std::numeric_limits<int>::max();
-    if (this->TYPE == GraphType::Undirected) {
-        successorsLists[endVertexID].removeByValue(startVertexID);
+    if (this->TYPE == GraphType::Directed) {
+        removeFromList(predecessorsLists[endVertexID], startVertexID);
+    } else {
+        removeFromList(successorsLists[endVertexID], startVertexID);
         parametersMatrix[endVertexID][startVertexID] = std::numeric_limits<int>::max();
     }
     --edgeCount;
@@ -91,37 +92,29 @@ DoublyLinkedList<int> ListGraph::getVertices() const {
 }
 
 DoublyLinkedList<int> ListGraph::getVertexSuccessors(int vertexID) const {
-    return successorsLists[vertexID];
+    return toList(successorsLists[vertexID]);
 }
 
 DoublyLinkedList<int> ListGraph::getVertexPredecessors(int vertexID) const {
-    if (this->TYPE == GraphType::Directed) {
-        DoublyLinkedList<int> predecessors;
-        int vertexCount = this->getVertexCount();
-        for (int i = 0; i < vertexCount; ++i) {
-            if (successorsLists[i].contains(vertexID)) {
-                predecessors.insertAtEnd(i);
-            }
-        }
-        return predecessors;
-    } else {
-        return successorsLists[vertexID];
+    return toList(getPredecessorsList(vertexID));
+}
+
+DoublyLinkedList<int> ListGraph::toList(const Table<int> &vertices) {
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < vertices.getSize(); ++i) {
+        list.insertAtEnd(vertices[i]);
     }
+    return list;
 }
 
-int ListGraph::getEdgeParameter(int startVertexID, int endVertexID) const {
-    return parametersMatrix[startVertexID][endVertexID];
+void ListGraph::removeFromList(Table<int> &vertices, int vertexID) {
+    vertices.remove(vertices.search(vertexID));
 }
 
 void ListGraph::setEdgeParameter(int startVertexID, int endVertexID, int parameter) {
     parametersMatrix[startVertexID][endVertexID] = parameter;
 }
 
-
-int ListGraph::getVertexCount() const {
-    return successorsLists.getSize();
-}
-
 int ListGraph::getEdgeCount() const {
     return edgeCount;
 }
@@ -143,7 +136,7 @@ std::string ListGraph::toString() const {
     graphString << std::setw(2) << "V" << std::endl;
     for (int i = 0; i < vertexCount; ++i) {
         graphString << std::setw(2) << i << ": ";
-        graphString << successorsLists[i] << std::endl;
+        graphString << toList(successorsLists[i]) << std::endl;
     }
     graphString << std::endl;
 
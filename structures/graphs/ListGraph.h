@@ -14,7 +14,7 @@
 class MatrixGraph;
 
 // Loops and multiple edges disallowed
-class ListGraph : public IGraph {
+class ListGraph final : public IGraph {
 public:
 
     explicit ListGraph(const MatrixGraph *mGraph);
@@ -31,11 +31,32 @@ public:
 
     [[nodiscard]] DoublyLinkedList<int> getVertices() const override;
 
-    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override;
+    // Borrowed view of the successors list
+    [[nodiscard]] ArrayView<int> getSuccessorsView(int vertexID) const override {
+        return {successorsLists[vertexID].getData(), successorsLists[vertexID].getSize()};
+    }
+
+    // Borrowed view of the predecessors list (successors list for undirected graph)
+    [[nodiscard]] ArrayView<int> getPredecessorsView(int vertexID) const override {
+        const Table<int> &predecessors = getPredecessorsList(vertexID);
+        return {predecessors.getData(), predecessors.getSize()};
+    }
+
+    // Borrowed view of the parameters matrix row
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override {
+        return {parametersMatrix[vertexID].getData(), parametersMatrix[vertexID].getSize()};
+    }
+
+    // Defined inline, so that calls on a concrete ListGraph can be devirtualized and inlined
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return parametersMatrix[startVertexID][endVertexID];
+    }
 
     void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
 
-    [[nodiscard]] int getVertexCount() const override;
+    [[nodiscard]] int getVertexCount() const override {
+        return successorsLists.getSize();
+    }
 
     [[nodiscard]] int getEdgeCount() const override;
 
@@ -51,9 +72,21 @@ private:
 
     void addVertex() override;
 
+    [[nodiscard]] const Table<int> &getPredecessorsList(int vertexID) const {
+        return (this->TYPE == GraphType::Directed) ? predecessorsLists[vertexID] : successorsLists[vertexID];
+    }
+
+    [[nodiscard]] static DoublyLinkedList<int> toList(const Table<int> &vertices);
+
+    // vertexID must be in vertices
+    static void removeFromList(Table<int> &vertices, int vertexID);
+
     const GraphType TYPE;
 
-    Table<DoublyLinkedList<int>> successorsLists;
+    Table<Table<int>> successorsLists;
+
+    // Reverse adjacency index, maintained only for directed graphs
+    Table<Table<int>> predecessorsLists;
 
     // Weight or flow
     Table<Table<int>> parametersMatrix;
@@ -61,6 +94,8 @@ private:
     int edgeCount;
 
     friend class ListGraphTest;
+
+    friend class GraphBuilder;
 };
 
 #endif //PEA_P1_LISTGRAPH_H
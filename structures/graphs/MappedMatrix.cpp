@@ -0,0 +1,166 @@
+#include "MappedMatrix.h"
+
+MappedMatrix::MappedMatrix(GraphType graphType, const std::string &path, MappedFile::AccessPattern accessPattern,
+                           bool verifyChecksum)
+        : TYPE(graphType), file(path, MappedFile::Backing::OnDemand), vertexCount(0), costWidth(0), costBias(0),
+          costsOffset(0), costs(nullptr), accessPattern(accessPattern) {
+    BinaryInstance::Layout layout;
+    if (!BinaryInstance::readLayout(file, nullptr, layout)) {
+        throw std::invalid_argument("MappedMatrix() error: " + path + " is not a binary instance");
+    }
+    instanceName = layout.instanceName;
+    vertexCount = layout.vertexCount;
+    costWidth = layout.costWidth;
+    costBias = layout.costBias;
+    costsOffset = layout.costsOffset;
+    costs = reinterpret_cast<const unsigned char *>(file.begin()) + costsOffset;
+    if (graphType == GraphType::Undirected && !layout.isSymmetric) {
+        throw std::invalid_argument("MappedMatrix() error: costs of " + path + " are asymmetric");
+    }
+    if (verifyChecksum) {
+        const std::size_t costsSize = static_cast<std::size_t>(vertexCount) * vertexCount * costWidth;
+        file.adviseAccess(MappedFile::AccessPattern::Sequential);
+        if (BinaryInstance::calculateChecksum(costs, costsSize) != layout.checksum) {
+            throw std::invalid_argument("MappedMatrix() error: " + path + " is damaged");
+        }
+    }
+    file.adviseAccess(accessPattern);
+}
+
+void MappedMatrix::addVertex() {
+    throw std::logic_error("addVertex() error: MappedMatrix has fixed vertex count");
+}
+
+void MappedMatrix::addEdge(int /*startVertexID*/, int /*endVertexID*/, int /*edgeParameter*/) {
+    throw std::logic_error("addEdge() error: MappedMatrix is read-only");
+}
+
+void MappedMatrix::removeEdge(int /*startVertexID*/, int /*endVertexID*/) {
+    throw std::logic_error("removeEdge() error: MappedMatrix is read-only");
+}
+
+void MappedMatrix::setEdgeParameter(int /*startVertexID*/, int /*endVertexID*/, int /*parameter*/) {
+    throw std::logic_error("setEdgeParameter() error: MappedMatrix is read-only");
+}
+
+void MappedMatrix::setAccessPattern(MappedFile::AccessPattern accessPattern) {
+    this->accessPattern = accessPattern;
+    file.adviseAccess(accessPattern);
+}
+
+DoublyLinkedList<int> MappedMatrix::getVertices() const {
+    DoublyLinkedList<int> vertexes;
+    for (int i = 0; i < vertexCount; ++i) {
+        vertexes.insertAtEnd(i);
+    }
+    return vertexes;
+}
+
+DoublyLinkedList<int> MappedMatrix::getVertexSuccessors(int vertexID) const {
+    DoublyLinkedList<int> successors;
+    for (int j = 0; j < vertexCount; ++j) {
+        if (j != vertexID) {
+            successors.insertAtEnd(j);
+        }
+    }
+    return successors;
+}
+
+DoublyLinkedList<int> MappedMatrix::getVertexPredecessors(int vertexID) const {
+    // Graph is complete
+    return getVertexSuccessors(vertexID);
+}
+
+ArrayView<int> MappedMatrix::getSuccessorsView(int vertexID) const {
+    Table<int> successors;
+    successors.resize(vertexCount - 1);
+    int *successorIDs = successors.getData();
+    for (int j = 0, k = 0; j < vertexCount; ++j) {
+        if (j != vertexID) {
+            successorIDs[k++] = j;
+        }
+    }
+    return ArrayView<int>(std::move(successors));
+}
+
+ArrayView<int> MappedMatrix::getPredecessorsView(int vertexID) const {
+    return getSuccessorsView(vertexID);
+}
+
+ArrayView<int> MappedMatrix::getCostRowView(int vertexID) const {
+    Table<int> row;
+    row.resize(vertexCount);
+    readCostRow(vertexID, row.getData());
+    return ArrayView<int>(std::move(row));
+}
+
+void MappedMatrix::readCostRow(int vertexID, int *outCosts) const {
+    const std::size_t rowStart = static_cast<std::size_t>(vertexID) * vertexCount;
+    if (accessPattern == MappedFile::AccessPattern::Random) {
+        file.prefetch(costsOffset + rowStart * costWidth, static_cast<std::size_t>(vertexCount) * costWidth);
+    }
+    // Loops per width, so that widening vectorizes
+    if (costWidth == 1) {
+        const unsigned char *storedRow = costs + rowStart;
+        for (int j = 0; j < vertexCount; ++j) {
+            outCosts[j] = costBias + storedRow[j];
+        }
+    } else if (costWidth == 2) {
+        const unsigned char *storedRow = costs + 2 * rowStart;
+        for (int j = 0; j < vertexCount; ++j) {
+            std::uint16_t storedCost;
+            std::memcpy(&storedCost, storedRow + 2 * j, sizeof(storedCost));
+            outCosts[j] = costBias + storedCost;
+        }
+    } else {
+        const unsigned char *storedRow = costs + 4 * rowStart;
+        for (int j = 0; j < vertexCount; ++j) {
+            std::uint32_t storedCost;
+            std::memcpy(&storedCost, storedRow + 4 * static_cast<std::size_t>(j), sizeof(storedCost));
+            outCosts[j] = static_cast<int>(costBias + storedCost);
+        }
+    }
+    outCosts[vertexID] = std::numeric_limits<int>::max();
+}
+
+int MappedMatrix::getEdgeCount() const {
+    const long long pairCount = static_cast<long long>(vertexCount) * (vertexCount - 1) / 2;
+    const long long edgeCount = (TYPE == GraphType::Directed) ? 2 * pairCount : pairCount;
+    // Complete graphs above ~46k vertices have more edges than int can count
+    return (edgeCount > std::numeric_limits<int>::max()) ? std::numeric_limits<int>::max()
+                                                         : static_cast<int>(edgeCount);
+}
+
+double MappedMatrix::getDensity() const {
+    return (vertexCount > 1) ? 1.0 : 0.0;
+}
+
+std::string MappedMatrix::toString() const {
+    const int numberFieldLen = 3;
+    std::stringstream graphString;
+    graphString << std::endl << "Mapped matrix (" << costWidth << "-byte costs):" << std::endl;
+    graphString << "V\\V";
+    for (int j = 0; j < vertexCount; ++j) {
+        graphString << std::setw(numberFieldLen) << j << ',';
+    }
+    graphString << std::endl;
+    for (int i = 0; i < vertexCount; ++i) {
+        graphString << std::setw(2) << std::to_string(i) << "[";
+        for (int j = 0; j < vertexCount; ++j) {
+            graphString << std::setw(numberFieldLen) << ((i == j) ? "*" : std::to_string(this->getCost(i, j)));
+            if (j != vertexCount - 1) {
+                graphString << ',';
+            }
+        }
+        graphString << ']' << std::endl;
+    }
+    return graphString.str();
+}
+
+IGraph::GraphType MappedMatrix::getGraphType() const {
+    return TYPE;
+}
+
+IGraph::GraphStructure MappedMatrix::getGraphStructure() const {
+    return MappedFlatMatrix;
+}
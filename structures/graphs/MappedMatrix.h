@@ -0,0 +1,150 @@
+#ifndef PEA_P1_MAPPEDMATRIX_H
+#define PEA_P1_MAPPEDMATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+
+#include "IGraph.h"
+#include "../Table.h"
+#include "../DoublyLinkedList.h"
+#include "../../utilities/MappedFile.h"
+#include "../../utilities/BinaryInstance.h"
+
+// Complete graph read in place from a binary instance file (see BinaryInstance), mapped read-only
+// Pages of the matrix are read from disk on first access and dropped by the system under memory pressure,
+// so instances larger than RAM can be solved (30k vertices need 3.6 GB as DistanceMatrix)
+// Costs keep the width of the file (1, 2 or 4 bytes), the diagonal is reported as std::numeric_limits<int>::max()
+// Edges are defined by the file, addEdge(), removeEdge() and setEdgeParameter() always throw
+class MappedMatrix final : public IGraph {
+public:
+
+    // Maps binary instance at path, throws std::invalid_argument if it is not a valid binary instance,
+    // or graphType is Undirected and costs are asymmetric
+    // verifyChecksum reads the whole file once, to detect damaged files
+    MappedMatrix(GraphType graphType, const std::string &path,
+                 MappedFile::AccessPattern accessPattern = MappedFile::AccessPattern::Random,
+                 bool verifyChecksum = false);
+
+    ~MappedMatrix() override = default;
+
+    MappedMatrix(const MappedMatrix &otherMatrix) = delete;
+
+    MappedMatrix &operator=(const MappedMatrix &otherMatrix) = delete;
+
+    void addEdge(int startVertexID, int endVertexID, int edgeParameter) override;
+
+    void removeEdge(int startVertexID, int endVertexID) override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexSuccessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertices() const override;
+
+    [[nodiscard]] ArrayView<int> getSuccessorsView(int vertexID) const override;
+
+    [[nodiscard]] ArrayView<int> getPredecessorsView(int vertexID) const override;
+
+    // Owning view - costs are widened from the file
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override;
+
+    // Writes getVertexCount() costs of edges leaving vertexID to outCosts (the diagonal is
+    // std::numeric_limits<int>::max())
+    // With Random access pattern, pages of the row are requested at once instead of faulting one by one
+    void readCostRow(int vertexID, int *outCosts) const;
+
+    // Hint for paging of the whole matrix - Sequential for scans of rows (nearest neighbour, greedy),
+    // Random for scattered lookups (local search)
+    void setAccessPattern(MappedFile::AccessPattern accessPattern);
+
+    [[nodiscard]] MappedFile::AccessPattern getAccessPattern() const {
+        return accessPattern;
+    }
+
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return getCost(startVertexID, endVertexID);
+    }
+
+    void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
+
+    // Non-virtual, unchecked accessor for hot loops
+    // Switch on the cost width is taken the same way on every call, so it is predicted
+    [[nodiscard]] int getCost(int startVertexID, int endVertexID) const {
+        if (startVertexID == endVertexID) {
+            return std::numeric_limits<int>::max();
+        }
+        const std::size_t idx = static_cast<std::size_t>(startVertexID) * vertexCount + endVertexID;
+        switch (costWidth) {
+            case 1:
+                return costBias + costs[idx];
+            case 2: {
+                std::uint16_t storedCost;
+                std::memcpy(&storedCost, costs + 2 * idx, sizeof(storedCost));
+                return costBias + storedCost;
+            }
+            default: {
+                std::uint32_t storedCost;
+                std::memcpy(&storedCost, costs + 4 * idx, sizeof(storedCost));
+                return static_cast<int>(costBias + storedCost);
+            }
+        }
+    }
+
+    // Bytes per stored cost - 1, 2 or 4
+    [[nodiscard]] int getCostWidth() const {
+        return costWidth;
+    }
+
+    [[nodiscard]] const std::string &getInstanceName() const {
+        return instanceName;
+    }
+
+    [[nodiscard]] int getVertexCount() const override {
+        return vertexCount;
+    }
+
+    [[nodiscard]] int getEdgeCount() const override;
+
+    [[nodiscard]] double getDensity() const override;
+
+    [[nodiscard]] std::string toString() const override;
+
+    [[nodiscard]] GraphType getGraphType() const override;
+
+    [[nodiscard]] GraphStructure getGraphStructure() const override;
+
+private:
+
+    // Vertex count is fixed - always throws
+    void addVertex() override;
+
+    const GraphType TYPE;
+
+    MappedFile file;
+
+    std::string instanceName;
+
+    int vertexCount;
+
+    int costWidth;
+
+    int costBias;
+
+    // Offset of the costs in the file
+    std::size_t costsOffset;
+
+    // Row-major vertexCount x vertexCount stored costs, inside the mapping
+    const unsigned char *costs;
+
+    MappedFile::AccessPattern accessPattern;
+
+    friend class MappedMatrixTest;
+};
+
+#endif //PEA_P1_MAPPEDMATRIX_H
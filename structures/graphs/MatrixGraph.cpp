@@ -1,38 +1,26 @@
 #include "MatrixGraph.h"
+#include "GraphBuilder.h"
 
 MatrixGraph::MatrixGraph(GraphType graphType, int nVertex) : TYPE(graphType) {
     if (nVertex < 1) {
         throw std::invalid_argument("ListGraph() error: graph must have at least one vertex");
     }
-    for (int i = 0; i < nVertex; ++i) {
-        this->addVertex();
+    // Graph has no edges yet, so rows of the incidence structure are empty
+    outgoingEdges.resize(nVertex);
+    if (this->TYPE == GraphType::Directed) {
+        incomingEdges.resize(nVertex);
     }
 }
 
-MatrixGraph::MatrixGraph(const ListGraph *lGraph) : TYPE(lGraph->getGraphType()) {
-    for (int i = 0; i < lGraph->getVertexCount(); ++i) {
-        this->addVertex();
-    }
-    auto vertices = lGraph->getVertices();
-    DoublyLinkedList<int> successors;
-    for (auto vIt = vertices.getIterator(); vIt != vertices.getEndIt(); ++vIt) {
-        successors = lGraph->getVertexSuccessors(vIt.getData());
-        for (auto sIt = successors.getIterator(); sIt != successors.getEndIt(); ++sIt) {
-            try {
-                this->addEdge(vIt.getData(), sIt.getData(), lGraph->getEdgeParameter(vIt.getData(), sIt.getData()));
-            } catch (const std::invalid_argument &e) {
-                // Skip already added edge
-            }
-        }
-    }
+MatrixGraph::MatrixGraph(const ListGraph *lGraph) : MatrixGraph(lGraph->getGraphType(), lGraph->getVertexCount()) {
+    // Undirected edges listed at both endpoints are taken once, from the lower one
+    GraphBuilder::fill(*this, GraphBuilder::collectEdges(*lGraph));
 }
 
 void MatrixGraph::addVertex() {
-    incidenceMatrix.insertAtEnd(Table<int>());
-    int lastVertexIdx = this->getVertexCount() - 1;
-    int edgeCount = this->getEdgeCount();
-    for (int i = 0; i < edgeCount; ++i) {
-        incidenceMatrix[lastVertexIdx].insert(i, 0);
+    outgoingEdges.emplaceAtEnd();
+    if (this->TYPE == GraphType::Directed) {
+        incomingEdges.emplaceAtEnd();
     }
 }
 
@@ -45,22 +33,19 @@ void MatrixGraph::addEdge(int startVertexID, int endVertexID, int edgeParameter)
         throw std::invalid_argument("addEdge() error: loops are disallowed");
     }
     // Multiple edges are not represented in this graph's structure
-    if (this->getEdgeParameter(startVertexID, endVertexID) != std::numeric_limits<int>::max()) {
+    int edgeID = this->getEdgeCount();
+    if (!edgeIndex.emplace(this->getEdgeKey(startVertexID, endVertexID), edgeID).second) {
         throw std::invalid_argument("addEdge() error: multiple edges are disallowed");
     }
 
-    int vertexCount = this->getVertexCount();
-    for (int i = 0; i < vertexCount; ++i) {
-        incidenceMatrix[i].insertAtEnd(0);
-    }
+    edgeStarts.insertAtEnd(startVertexID);
+    edgeEnds.insertAtEnd(endVertexID);
     edgeParameters.insertAtEnd(edgeParameter);
-
-    int lastEdgeIdx = this->getEdgeCount() - 1;
-    incidenceMatrix[startVertexID][lastEdgeIdx] = 1; // beginning of the edge
+    outgoingEdges[startVertexID].insertAtEnd(edgeID); // beginning of the edge
     if (this->TYPE == GraphType::Undirected) { // end of the edge
-        incidenceMatrix[endVertexID][lastEdgeIdx] = 1;
+        outgoingEdges[endVertexID].insertAtEnd(edgeID);
     } else {
-        incidenceMatrix[endVertexID][lastEdgeIdx] = -1;
+        incomingEdges[endVertexID].insertAtEnd(edgeID);
     }
 }
 
@@ -70,11 +55,12 @@ void MatrixGraph::removeEdge(int startVertexID, int endVertexID) {
         throw std::invalid_argument("removeEdge() error: invalid vertex's index");
     }
 
-    if (this->getEdgeParameter(startVertexID, endVertexID) == std::numeric_limits<int>::max()) {
+    int edgeID = this->getEdgeIdFromVertexes(startVertexID, endVertexID);
+    if (edgeID == EDGE_NOT_PRESENT) {
         throw std::invalid_argument("removeEdge() error: described edge does not exist");
     }
 
-    this->removeEdge(this->getEdgeIdFromVertexes(startVertexID, endVertexID));
+    this->removeEdge(edgeID);
 }
 
 void MatrixGraph::removeEdge(int edgeID) {
@@ -82,11 +68,36 @@ void MatrixGraph::removeEdge(int edgeID) {
         throw std::invalid_argument("removeEdge() error: invalid edgeID");
     }
 
-    int vertexCount = this->getVertexCount();
-    for (int i = 0; i < vertexCount; ++i) {
-        incidenceMatrix[i].remove(edgeID);
-    }
+    int startVertexID = edgeStarts[edgeID];
+    int endVertexID = edgeEnds[edgeID];
+    edgeIndex.erase(this->getEdgeKey(startVertexID, endVertexID));
+    Table<int> &startRow = outgoingEdges[startVertexID];
+    startRow.remove(startRow.search(edgeID));
+    Table<int> &endRow = (this->TYPE == GraphType::Undirected) ? outgoingEdges[endVertexID]
+                                                                 : incomingEdges[endVertexID];
+    endRow.remove(endRow.search(edgeID));
+    edgeStarts.remove(edgeID);
+    edgeEnds.remove(edgeID);
     edgeParameters.remove(edgeID);
+
+    // Following edges move one ID down
+    int edgeCount = this->getEdgeCount();
+    for (int j = edgeID; j < edgeCount; ++j) {
+        edgeIndex[this->getEdgeKey(edgeStarts[j], edgeEnds[j])] = j;
+    }
+    shiftEdgeIDs(outgoingEdges, edgeID);
+    shiftEdgeIDs(incomingEdges, edgeID);
+}
+
+void MatrixGraph::shiftEdgeIDs(Table<Table<int>> &rows, int removedEdgeID) {
+    for (int i = 0; i < rows.getSize(); ++i) {
+        int *rowEdgeIDs = rows[i].getData();
+        for (int k = 0; k < rows[i].getSize(); ++k) {
+            if (rowEdgeIDs[k] > removedEdgeID) {
+                --rowEdgeIDs[k];
+            }
+        }
+    }
 }
 
 DoublyLinkedList<int> MatrixGraph::getVertices() const {
@@ -100,56 +111,32 @@ DoublyLinkedList<int> MatrixGraph::getVertices() const {
 
 DoublyLinkedList<int> MatrixGraph::getVertexSuccessors(int vertexID) const {
     DoublyLinkedList<int> outSuccessorsList;
-    int edgeCount = this->getEdgeCount();
-    int vertexCount = this->getVertexCount();
-    for (int j = 0; j < edgeCount; ++j) {
-        if (incidenceMatrix[vertexID][j] == 1) {
-            for (int i = 0; i < vertexCount; ++i) {
-                if (this->TYPE == GraphType::Directed) {
-                    if (incidenceMatrix[i][j] == -1) {
-                        outSuccessorsList.insertAtEnd(i);
-                        break;
-                    }
-                } else {
-                    if (i != vertexID && incidenceMatrix[i][j] == 1) {
-                        outSuccessorsList.insertAtEnd(i);
-                        break;
-                    }
-                }
-            }
-        }
+    for (int successor: this->getSuccessorsView(vertexID)) {
+        outSuccessorsList.insertAtEnd(successor);
     }
     return outSuccessorsList;
 }
 
 DoublyLinkedList<int> MatrixGraph::getVertexPredecessors(int vertexID) const {
     DoublyLinkedList<int> outPredecessorsList;
-    int edgeCount = this->getEdgeCount();
-    int vertexCount = this->getVertexCount();
-    for (int j = 0; j < edgeCount; ++j) {
-        if (this->TYPE == GraphType::Directed) {
-            if (incidenceMatrix[vertexID][j] == -1) {
-                for (int i = 0; i < vertexCount; ++i) {
-                    if (incidenceMatrix[i][j] == 1) {
-                        outPredecessorsList.insertAtEnd(i);
-                        break;
-                    }
-                }
-            }
-        } else {
-            if (incidenceMatrix[vertexID][j] == 1) {
-                for (int i = 0; i < vertexCount; ++i) {
-                    if (i != vertexID && incidenceMatrix[i][j] == 1) {
-                        outPredecessorsList.insertAtEnd(i);
-                        break;
-                    }
-                }
-            }
-        }
+    for (int predecessor: this->getPredecessorsView(vertexID)) {
+        outPredecessorsList.insertAtEnd(predecessor);
     }
     return outPredecessorsList;
 }
 
+ArrayView<int> MatrixGraph::getSuccessorsView(int vertexID) const {
+    return ArrayView<int>(this->getOtherEndpoints(outgoingEdges[vertexID], vertexID));
+}
+
+ArrayView<int> MatrixGraph::getPredecessorsView(int vertexID) const {
+    if (this->TYPE == GraphType::Directed) {
+        return ArrayView<int>(this->getOtherEndpoints(incomingEdges[vertexID], vertexID));
+    } else {
+        return this->getSuccessorsView(vertexID);
+    }
+}
+
 int MatrixGraph::getEdgeParameter(int startVertexID, int endVertexID) const {
     int edgeID = this->getEdgeIdFromVertexes(startVertexID, endVertexID);
     if (edgeID != EDGE_NOT_PRESENT) {
@@ -173,7 +160,7 @@ int MatrixGraph::getEdgeParameter(int edgeID) const {
 }
 
 int MatrixGraph::getVertexCount() const {
-    return incidenceMatrix.getSize();
+    return outgoingEdges.getSize();
 }
 
 int MatrixGraph::getEdgeCount() const {
@@ -203,10 +190,10 @@ std::string MatrixGraph::toString() const {
     for (int i = 0; i < this->getVertexCount(); ++i) {
         graphString << std::setw(2) << std::to_string(i) << "[";
         for (int j = 0; j < this->getEdgeCount() - 1; ++j) {
-            graphString << std::setw(numberFieldLen) << incidenceMatrix[i][j] << ',';
+            graphString << std::setw(numberFieldLen) << this->getIncidence(i, j) << ',';
         }
         if (lastEdgeIdx >= 0) {
-            graphString << std::setw(numberFieldLen) << incidenceMatrix[i][lastEdgeIdx];
+            graphString << std::setw(numberFieldLen) << this->getIncidence(i, lastEdgeIdx);
         }
         graphString << ']' << std::endl;
     }
@@ -234,46 +221,58 @@ std::string MatrixGraph::toString() const {
 }
 
 int MatrixGraph::getEdgeIdFromVertexes(int startVertexID, int endVertexID) const {
-    int edgeCount = this->getEdgeCount();
-    for (int j = 0; j < edgeCount; ++j) {
-        if (incidenceMatrix[startVertexID][j] == 1) {
-            if (this->TYPE == GraphType::Directed) {
-                if (incidenceMatrix[endVertexID][j] == -1)
-                    return j;
-            } else {
-                if (incidenceMatrix[endVertexID][j] == 1 && endVertexID != startVertexID)
-                    return j;
-            }
-        }
+    auto edgeIt = edgeIndex.find(this->getEdgeKey(startVertexID, endVertexID));
+    if (edgeIt != edgeIndex.end()) {
+        return edgeIt->second;
     }
     return EDGE_NOT_PRESENT;
 }
 
 Table<int> MatrixGraph::getVertexIdsFromEdge(int edgeID) const {
     Table<int> vertexes;
-    int vertexValue = VERTEX_NOT_PRESENT;
-    vertexes.insertAtEnd(vertexValue); // startVertexID
-    vertexes.insertAtEnd(vertexValue); // endVertexID
-    int vertexInsertIdx = 0;
-    for (int i = 0; i < this->getVertexCount() &&
-                    (vertexes[0] == VERTEX_NOT_PRESENT || vertexes[1] == VERTEX_NOT_PRESENT); ++i) {
-        if (this->TYPE == GraphType::Directed) {
-            if (incidenceMatrix[i][edgeID] == 1) {
-                vertexes[0] = i;
-            } else if (incidenceMatrix[i][edgeID] == -1) {
-                vertexes[1] = i;
-            }
-        } else {
-            if (incidenceMatrix[i][edgeID] == 1) {
-                vertexes[vertexInsertIdx++] = i;
-            }
-        }
+    vertexes.reserve(2);
+    int startVertexID = edgeStarts[edgeID];
+    int endVertexID = edgeEnds[edgeID];
+    if (this->TYPE == GraphType::Undirected && endVertexID < startVertexID) {
+        // Endpoints of undirected edge are reported in increasing order
+        std::swap(startVertexID, endVertexID);
     }
+    vertexes.insertAtEnd(startVertexID);
+    vertexes.insertAtEnd(endVertexID);
     return vertexes;
 }
 
 bool MatrixGraph::isVertexPartOfEdge(int vertexID, int edgeID) const {
-    return incidenceMatrix[vertexID][edgeID] != 0;
+    return this->getIncidence(vertexID, edgeID) != 0;
+}
+
+int MatrixGraph::getIncidence(int vertexID, int edgeID) const {
+    if (edgeStarts[edgeID] == vertexID) {
+        return 1;
+    } else if (edgeEnds[edgeID] == vertexID) {
+        return (this->TYPE == GraphType::Directed) ? -1 : 1;
+    }
+    return 0;
+}
+
+int MatrixGraph::getOtherEndpoint(int edgeID, int vertexID) const {
+    return (edgeStarts[edgeID] == vertexID) ? edgeEnds[edgeID] : edgeStarts[edgeID];
+}
+
+Table<int> MatrixGraph::getOtherEndpoints(const Table<int> &edgeIDs, int vertexID) const {
+    Table<int> vertexes;
+    vertexes.reserve(edgeIDs.getSize());
+    for (int k = 0; k < edgeIDs.getSize(); ++k) {
+        vertexes.insertAtEnd(this->getOtherEndpoint(edgeIDs[k], vertexID));
+    }
+    return vertexes;
+}
+
+long long MatrixGraph::getEdgeKey(int startVertexID, int endVertexID) const {
+    if (this->TYPE == GraphType::Undirected && endVertexID < startVertexID) {
+        std::swap(startVertexID, endVertexID);
+    }
+    return (static_cast<long long>(startVertexID) << 32) | static_cast<unsigned int>(endVertexID);
 }
 
 IGraph::GraphType MatrixGraph::getGraphType() const {
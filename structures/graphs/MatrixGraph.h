@@ -2,6 +2,7 @@
 #define PEA_P1_MATRIXGRAPH_H
 
 #include <limits>
+#include <unordered_map>
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
@@ -14,7 +15,12 @@
 
 class ListGraph;
 
-class MatrixGraph : public IGraph {
+// Incidence representation - edges are identified by IDs [0, getEdgeCount()) in order of addition,
+// removal of an edge shifts IDs of the following edges down by one
+// Incidence matrix is not stored densely: every edge keeps its endpoints, every vertex keeps a row with IDs of
+// its edges (CSR-style) and (start, end) pairs are hashed to edge IDs, so edge lookups take O(1)
+// and construction takes O(V + E)
+class MatrixGraph final : public IGraph {
 public:
 
     explicit MatrixGraph(const ListGraph *lGraph);
@@ -33,6 +39,10 @@ public:
 
     [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override;
 
+    [[nodiscard]] ArrayView<int> getSuccessorsView(int vertexID) const override;
+
+    [[nodiscard]] ArrayView<int> getPredecessorsView(int vertexID) const override;
+
     [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override;
 
     void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
@@ -68,14 +78,43 @@ private:
 
     void addVertex() override;
 
+    // Element of the incidence matrix: 1 for start of the edge (or any endpoint of undirected edge),
+    // -1 for end of directed edge, 0 if vertex is not part of the edge
+    [[nodiscard]] int getIncidence(int vertexID, int edgeID) const;
+
+    // Endpoint of edgeID other than vertexID
+    [[nodiscard]] int getOtherEndpoint(int edgeID, int vertexID) const;
+
+    // Vertices on the other end of edges from edgeIDs
+    [[nodiscard]] Table<int> getOtherEndpoints(const Table<int> &edgeIDs, int vertexID) const;
+
+    // Decrements IDs greater than removedEdgeID in every row
+    static void shiftEdgeIDs(Table<Table<int>> &rows, int removedEdgeID);
+
+    // Key of edgeIndex, undirected edges are keyed by ordered pair of their endpoints
+    [[nodiscard]] long long getEdgeKey(int startVertexID, int endVertexID) const;
+
     const GraphType TYPE;
 
-    Table<Table<int>> incidenceMatrix;
+    // Endpoints of edges, indexed by edgeID
+    Table<int> edgeStarts;
+    Table<int> edgeEnds;
 
     // Weight or flow
     Table<int> edgeParameters;
 
+    // IDs of edges leaving vertex (of all edges incident to vertex in undirected graph), in increasing order
+    Table<Table<int>> outgoingEdges;
+
+    // IDs of edges entering vertex, in increasing order - maintained only for directed graphs
+    Table<Table<int>> incomingEdges;
+
+    // (start, end) -> edgeID
+    std::unordered_map<long long, int> edgeIndex;
+
     friend class MatrixGraphTest;
+
+    friend class GraphBuilder;
 };
 
 
@@ -0,0 +1,274 @@
+#ifndef PEA_P1_QUANTIZEDMATRIX_H
+#define PEA_P1_QUANTIZEDMATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <type_traits>
+
+#include "IGraph.h"
+#include "../DoublyLinkedList.h"
+
+// Flat, row-major matrix of costs stored in narrow unsigned type TCost (std::uint8_t or std::uint16_t)
+// Maximum value of TCost marks missing edge (and the diagonal), so edge parameters must be in [0, NO_EDGE)
+// Missing edges are reported as std::numeric_limits<int>::max(), same as in other graph structures
+// Loops and multiple edges are disallowed, vertex count is fixed at construction
+template<class TCost>
+class QuantizedMatrix final : public IGraph {
+    static_assert(std::is_unsigned_v<TCost> && sizeof(TCost) < sizeof(int),
+                  "QuantizedMatrix stores costs in unsigned types narrower than int");
+
+public:
+
+    // Value stored in place of missing edges
+    static const TCost NO_EDGE = std::numeric_limits<TCost>::max();
+
+    // Alignment (in bytes) of the buffer and of every row
+    static const std::size_t ALIGNMENT = 64;
+
+    QuantizedMatrix(GraphType graphType, int nVertex)
+            : TYPE(graphType), vertexCount(nVertex),
+              rowStride(((static_cast<std::size_t>(nVertex) * sizeof(TCost) + ALIGNMENT - 1) / ALIGNMENT) *
+                        (ALIGNMENT / sizeof(TCost))),
+              edgeCount(0), costs(nullptr) {
+        if (nVertex < 1) {
+            throw std::invalid_argument("QuantizedMatrix() error: graph must have at least one vertex");
+        }
+        const std::size_t bufferSize = rowStride * vertexCount;
+        costs = static_cast<TCost *>(::operator new[](bufferSize * sizeof(TCost), std::align_val_t(ALIGNMENT)));
+        for (std::size_t idx = 0; idx < bufferSize; ++idx) {
+            costs[idx] = NO_EDGE;
+        }
+    }
+
+    ~QuantizedMatrix() override {
+        ::operator delete[](costs, std::align_val_t(ALIGNMENT));
+    }
+
+    QuantizedMatrix(const QuantizedMatrix &otherMatrix) = delete;
+
+    QuantizedMatrix &operator=(const QuantizedMatrix &otherMatrix) = delete;
+
+    // True if every edge parameter from [minEdgeParameter, maxEdgeParameter] can be stored in TCost
+    [[nodiscard]] static bool canStore(int minEdgeParameter, int maxEdgeParameter) {
+        return minEdgeParameter >= 0 && maxEdgeParameter < NO_EDGE;
+    }
+
+    void addEdge(int startVertexID, int endVertexID, int edgeParameter) override {
+        if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+            throw std::invalid_argument("addEdge() error: invalid vertex's index");
+        }
+        if (startVertexID == endVertexID) {
+            throw std::invalid_argument("addEdge() error: loops are disallowed");
+        }
+        if (!canStore(edgeParameter, edgeParameter)) {
+            throw std::invalid_argument("addEdge() error: edge parameter out of range of cost type");
+        }
+        // Multiple edges are not represented in this graph's structure
+        if (costAt(startVertexID, endVertexID) != NO_EDGE) {
+            throw std::invalid_argument("addEdge() error: multiple edges are disallowed");
+        }
+
+        costAt(startVertexID, endVertexID) = static_cast<TCost>(edgeParameter);
+        if (this->TYPE == GraphType::Undirected) {
+            costAt(endVertexID, startVertexID) = static_cast<TCost>(edgeParameter);
+        }
+        ++edgeCount;
+    }
+
+    void removeEdge(int startVertexID, int endVertexID) override {
+        if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+            throw std::invalid_argument("removeEdge() error: invalid vertex's index");
+        }
+        if (costAt(startVertexID, endVertexID) == NO_EDGE) {
+            throw std::invalid_argument("removeEdge() error: described edge does not exist");
+        }
+
+        costAt(startVertexID, endVertexID) = NO_EDGE;
+        if (this->TYPE == GraphType::Undirected) {
+            costAt(endVertexID, startVertexID) = NO_EDGE;
+        }
+        --edgeCount;
+    }
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexSuccessors(int vertexID) const override {
+        DoublyLinkedList<int> successors;
+        const TCost *row = this->getRow(vertexID);
+        for (int j = 0; j < vertexCount; ++j) {
+            if (row[j] != NO_EDGE) {
+                successors.insertAtEnd(j);
+            }
+        }
+        return successors;
+    }
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override {
+        DoublyLinkedList<int> predecessors;
+        for (int i = 0; i < vertexCount; ++i) {
+            if (costAt(i, vertexID) != NO_EDGE) {
+                predecessors.insertAtEnd(i);
+            }
+        }
+        return predecessors;
+    }
+
+    [[nodiscard]] DoublyLinkedList<int> getVertices() const override {
+        DoublyLinkedList<int> vertexes;
+        for (int i = 0; i < vertexCount; ++i) {
+            vertexes.insertAtEnd(i);
+        }
+        return vertexes;
+    }
+
+    // Owning view - stored costs are widened to int
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override {
+        Table<int> widenedRow;
+        widenedRow.resize(vertexCount);
+        int *widenedCosts = widenedRow.getData();
+        for (int j = 0; j < vertexCount; ++j) {
+            widenedCosts[j] = getCost(vertexID, j);
+        }
+        return ArrayView<int>(std::move(widenedRow));
+    }
+
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return getCost(startVertexID, endVertexID);
+    }
+
+    // Replaces all edges with costs from row-major getVertexCount() x getVertexCount() costMatrix, without per-edge checks
+    // The diagonal is skipped, undirected graph reads only the upper triangle, std::numeric_limits<int>::max() is no edge
+    // Throws std::invalid_argument (leaving the graph unchanged) if other cost is out of range of TCost
+    void assignCosts(const int *costMatrix) {
+        for (int i = 0; i < vertexCount; ++i) {
+            const int *sourceRow = costMatrix + static_cast<std::size_t>(i) * vertexCount;
+            const int firstColumn = (this->TYPE == GraphType::Directed) ? 0 : i + 1;
+            for (int j = firstColumn; j < vertexCount; ++j) {
+                if (j != i && sourceRow[j] != std::numeric_limits<int>::max() && !canStore(sourceRow[j], sourceRow[j])) {
+                    throw std::invalid_argument("assignCosts() error: edge parameter out of range of cost type");
+                }
+            }
+        }
+
+        edgeCount = 0;
+        for (int i = 0; i < vertexCount; ++i) {
+            const int *sourceRow = costMatrix + static_cast<std::size_t>(i) * vertexCount;
+            costAt(i, i) = NO_EDGE;
+            const int firstColumn = (this->TYPE == GraphType::Directed) ? 0 : i + 1;
+            for (int j = firstColumn; j < vertexCount; ++j) {
+                if (j == i) {
+                    continue;
+                }
+                const TCost cost = (sourceRow[j] == std::numeric_limits<int>::max()) ? NO_EDGE
+                                                                                     : static_cast<TCost>(sourceRow[j]);
+                costAt(i, j) = cost;
+                if (this->TYPE == GraphType::Undirected) {
+                    costAt(j, i) = cost;
+                }
+                if (cost != NO_EDGE) {
+                    ++edgeCount;
+                }
+            }
+        }
+    }
+
+    // Parameter must be in [0, NO_EDGE), edge does not have to exist
+    void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override {
+        costAt(startVertexID, endVertexID) = static_cast<TCost>(parameter);
+        if (this->TYPE == GraphType::Undirected) {
+            costAt(endVertexID, startVertexID) = static_cast<TCost>(parameter);
+        }
+    }
+
+    // Non-virtual, unchecked accessor for hot loops - widens stored cost to int
+    [[nodiscard]] int getCost(int startVertexID, int endVertexID) const {
+        const TCost cost = costAt(startVertexID, endVertexID);
+        return (cost == NO_EDGE) ? std::numeric_limits<int>::max() : static_cast<int>(cost);
+    }
+
+    // Pointer to the first of getVertexCount() stored costs of edges leaving vertexID (row start is ALIGNMENT aligned)
+    [[nodiscard]] const TCost *getRow(int vertexID) const {
+        return costs + static_cast<std::size_t>(vertexID) * rowStride;
+    }
+
+    [[nodiscard]] int getVertexCount() const override {
+        return vertexCount;
+    }
+
+    [[nodiscard]] int getEdgeCount() const override {
+        return edgeCount;
+    }
+
+    [[nodiscard]] double getDensity() const override {
+        if (this->TYPE == GraphType::Directed) {
+            return static_cast<double>(edgeCount) / (vertexCount * (vertexCount - 1));
+        } else {
+            return static_cast<double>(edgeCount) / ((vertexCount * (vertexCount - 1)) / 2);
+        }
+    }
+
+    [[nodiscard]] std::string toString() const override {
+        const int numberFieldLen = 3;
+        std::stringstream graphString;
+        graphString << std::endl << "Quantized matrix (" << sizeof(TCost) * 8 << "-bit costs):" << std::endl;
+        graphString << "V\\V";
+        for (int j = 0; j < vertexCount; ++j) {
+            graphString << std::setw(numberFieldLen) << j << ',';
+        }
+        graphString << std::endl;
+        for (int i = 0; i < vertexCount; ++i) {
+            graphString << std::setw(2) << std::to_string(i) << "[";
+            for (int j = 0; j < vertexCount; ++j) {
+                graphString << std::setw(numberFieldLen) <<
+                            ((costAt(i, j) == NO_EDGE) ? "*" : std::to_string(costAt(i, j)));
+                if (j != vertexCount - 1) {
+                    graphString << ',';
+                }
+            }
+            graphString << ']' << std::endl;
+        }
+        return graphString.str();
+    }
+
+    [[nodiscard]] GraphType getGraphType() const override {
+        return TYPE;
+    }
+
+    [[nodiscard]] GraphStructure getGraphStructure() const override {
+        return QuantizedFlatMatrix;
+    }
+
+private:
+
+    // Vertex count is fixed - always throws
+    void addVertex() override {
+        throw std::logic_error("addVertex() error: QuantizedMatrix has fixed vertex count");
+    }
+
+    [[nodiscard]] TCost &costAt(int startVertexID, int endVertexID) {
+        return costs[static_cast<std::size_t>(startVertexID) * rowStride + endVertexID];
+    }
+
+    [[nodiscard]] const TCost &costAt(int startVertexID, int endVertexID) const {
+        return costs[static_cast<std::size_t>(startVertexID) * rowStride + endVertexID];
+    }
+
+    const GraphType TYPE;
+
+    const int vertexCount;
+
+    // Number of costs between starts of consecutive rows (vertexCount rounded up to ALIGNMENT)
+    const std::size_t rowStride;
+
+    int edgeCount;
+
+    // Weight or flow, rowStride * vertexCount elements
+    TCost *costs;
+
+    friend class QuantizedMatrixTest;
+};
+
+#endif //PEA_P1_QUANTIZEDMATRIX_H
@@ -0,0 +1,271 @@
+#include "SparseGraph.h"
+
+#include <utility>
+#include <vector>
+
+SparseGraph::SparseGraph(GraphType graphType, int nVertex) : TYPE(graphType), vertexCount(nVertex), edgeCount(0) {
+    if (nVertex < 1) {
+        throw std::invalid_argument("SparseGraph() error: graph must have at least one vertex");
+    }
+    rowOffsets.resize(nVertex + 1, 0);
+    if (this->TYPE == GraphType::Directed) {
+        predecessorOffsets.resize(nVertex + 1, 0);
+    }
+}
+
+SparseGraph::SparseGraph(GraphType graphType, int nVertex, const Table<Edge> &edges)
+        : TYPE(graphType), vertexCount(nVertex), edgeCount(edges.getSize()) {
+    if (nVertex < 1) {
+        throw std::invalid_argument("SparseGraph() error: graph must have at least one vertex");
+    }
+    // Every row entry as (row, vertex, cost), undirected edges give two entries
+    const int entriesPerEdge = (this->TYPE == GraphType::Undirected) ? 2 : 1;
+    Table<int> entryRows, entryVertices, entryCosts;
+    entryRows.reserve(entriesPerEdge * edges.getSize());
+    entryVertices.reserve(entriesPerEdge * edges.getSize());
+    entryCosts.reserve(entriesPerEdge * edges.getSize());
+    for (int k = 0; k < edges.getSize(); ++k) {
+        const Edge &edge = edges[k];
+        if (edge.startVertexID < 0 || edge.startVertexID >= nVertex || edge.endVertexID < 0 ||
+            edge.endVertexID >= nVertex) {
+            throw std::invalid_argument("SparseGraph() error: invalid vertex's index");
+        }
+        if (edge.startVertexID == edge.endVertexID) {
+            throw std::invalid_argument("SparseGraph() error: loops are disallowed");
+        }
+        entryRows.insertAtEnd(edge.startVertexID);
+        entryVertices.insertAtEnd(edge.endVertexID);
+        entryCosts.insertAtEnd(edge.parameter);
+        if (this->TYPE == GraphType::Undirected) {
+            entryRows.insertAtEnd(edge.endVertexID);
+            entryVertices.insertAtEnd(edge.startVertexID);
+            entryCosts.insertAtEnd(edge.parameter);
+        }
+    }
+    buildRows(nVertex, entryRows, entryVertices, entryCosts, rowOffsets, neighbourIDs, &neighbourCosts);
+    if (this->TYPE == GraphType::Directed) {
+        // Same entries with swapped roles of row and vertex
+        buildRows(nVertex, entryVertices, entryRows, entryCosts, predecessorOffsets, predecessorIDs, nullptr);
+    }
+}
+
+void SparseGraph::buildRows(int nVertex, const Table<int> &entryRows, const Table<int> &entryVertices,
+                            const Table<int> &entryCosts, Table<int> &offsets, Table<int> &vertexIDs,
+                            Table<int> *costs) {
+    const int nEntries = entryRows.getSize();
+
+    // Counting sort of entries by row
+    offsets.resize(nVertex + 1, 0);
+    int *rowStarts = offsets.getData();
+    for (int k = 0; k < nEntries; ++k) {
+        ++rowStarts[entryRows[k] + 1];
+    }
+    for (int v = 0; v < nVertex; ++v) {
+        rowStarts[v + 1] += rowStarts[v];
+    }
+    vertexIDs.resize(nEntries);
+    if (costs != nullptr) {
+        costs->resize(nEntries);
+    }
+    Table<int> nextPositions(offsets);
+    for (int k = 0; k < nEntries; ++k) {
+        const int position = nextPositions[entryRows[k]]++;
+        vertexIDs[position] = entryVertices[k];
+        if (costs != nullptr) {
+            (*costs)[position] = entryCosts[k];
+        }
+    }
+
+    // Rows are sorted by vertex ID
+    int *ids = vertexIDs.getData();
+    std::vector<std::pair<int, int>> rowEntries;
+    for (int v = 0; v < nVertex; ++v) {
+        const int rowStart = rowStarts[v];
+        const int rowEnd = rowStarts[v + 1];
+        if (costs != nullptr) {
+            int *rowCosts = costs->getData();
+            rowEntries.clear();
+            for (int k = rowStart; k < rowEnd; ++k) {
+                rowEntries.emplace_back(ids[k], rowCosts[k]);
+            }
+            std::sort(rowEntries.begin(), rowEntries.end());
+            for (int k = rowStart; k < rowEnd; ++k) {
+                ids[k] = rowEntries[k - rowStart].first;
+                rowCosts[k] = rowEntries[k - rowStart].second;
+            }
+        } else {
+            std::sort(ids + rowStart, ids + rowEnd);
+        }
+        for (int k = rowStart + 1; k < rowEnd; ++k) {
+            if (ids[k] == ids[k - 1]) {
+                throw std::invalid_argument("SparseGraph() error: multiple edges are disallowed");
+            }
+        }
+    }
+}
+
+void SparseGraph::addVertex() {
+    throw std::logic_error("addVertex() error: SparseGraph has fixed vertex count");
+}
+
+void SparseGraph::addEdge(int startVertexID, int endVertexID, int edgeParameter) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("addEdge() error: invalid vertex's index");
+    }
+    if (startVertexID == endVertexID) {
+        throw std::invalid_argument("addEdge() error: loops are disallowed");
+    }
+    if (this->findInRow(startVertexID, endVertexID) != NOT_IN_ROW) {
+        throw std::invalid_argument("addEdge() error: multiple edges are disallowed");
+    }
+
+    insertIntoRow(rowOffsets, neighbourIDs, &neighbourCosts, startVertexID, endVertexID, edgeParameter);
+    if (this->TYPE == GraphType::Undirected) {
+        insertIntoRow(rowOffsets, neighbourIDs, &neighbourCosts, endVertexID, startVertexID, edgeParameter);
+    } else {
+        insertIntoRow(predecessorOffsets, predecessorIDs, nullptr, endVertexID, startVertexID, 0);
+    }
+    ++edgeCount;
+}
+
+void SparseGraph::removeEdge(int startVertexID, int endVertexID) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("removeEdge() error: invalid vertex's index");
+    }
+    if (this->findInRow(startVertexID, endVertexID) == NOT_IN_ROW) {
+        throw std::invalid_argument("removeEdge() error: described edge does not exist");
+    }
+
+    removeFromRow(rowOffsets, neighbourIDs, &neighbourCosts, startVertexID, endVertexID);
+    if (this->TYPE == GraphType::Undirected) {
+        removeFromRow(rowOffsets, neighbourIDs, &neighbourCosts, endVertexID, startVertexID);
+    } else {
+        removeFromRow(predecessorOffsets, predecessorIDs, nullptr, endVertexID, startVertexID);
+    }
+    --edgeCount;
+}
+
+void SparseGraph::insertIntoRow(Table<int> &offsets, Table<int> &vertexIDs, Table<int> *costs, int rowVertexID,
+                                int vertexID, int cost) {
+    const int *rowStart = vertexIDs.getData() + offsets[rowVertexID];
+    const int *rowEnd = vertexIDs.getData() + offsets[rowVertexID + 1];
+    const int position = offsets[rowVertexID] + static_cast<int>(std::lower_bound(rowStart, rowEnd, vertexID) -
+                                                                 rowStart);
+    vertexIDs.insert(position, vertexID);
+    if (costs != nullptr) {
+        costs->insert(position, cost);
+    }
+    int *rowStarts = offsets.getData();
+    for (int v = rowVertexID + 1; v < offsets.getSize(); ++v) {
+        ++rowStarts[v];
+    }
+}
+
+void SparseGraph::removeFromRow(Table<int> &offsets, Table<int> &vertexIDs, Table<int> *costs, int rowVertexID,
+                                int vertexID) {
+    const int *rowStart = vertexIDs.getData() + offsets[rowVertexID];
+    const int *rowEnd = vertexIDs.getData() + offsets[rowVertexID + 1];
+    const int position = offsets[rowVertexID] + static_cast<int>(std::lower_bound(rowStart, rowEnd, vertexID) -
+                                                                 rowStart);
+    vertexIDs.remove(position);
+    if (costs != nullptr) {
+        costs->remove(position);
+    }
+    int *rowStarts = offsets.getData();
+    for (int v = rowVertexID + 1; v < offsets.getSize(); ++v) {
+        --rowStarts[v];
+    }
+}
+
+DoublyLinkedList<int> SparseGraph::getVertices() const {
+    DoublyLinkedList<int> vertexes;
+    for (int i = 0; i < vertexCount; ++i) {
+        vertexes.insertAtEnd(i);
+    }
+    return vertexes;
+}
+
+DoublyLinkedList<int> SparseGraph::getVertexSuccessors(int vertexID) const {
+    DoublyLinkedList<int> successors;
+    for (int successor: this->getSuccessorsView(vertexID)) {
+        successors.insertAtEnd(successor);
+    }
+    return successors;
+}
+
+DoublyLinkedList<int> SparseGraph::getVertexPredecessors(int vertexID) const {
+    DoublyLinkedList<int> predecessors;
+    for (int predecessor: this->getPredecessorsView(vertexID)) {
+        predecessors.insertAtEnd(predecessor);
+    }
+    return predecessors;
+}
+
+ArrayView<int> SparseGraph::getPredecessorsView(int vertexID) const {
+    if (this->TYPE == GraphType::Directed) {
+        return {predecessorIDs.getData() + predecessorOffsets[vertexID],
+                predecessorOffsets[vertexID + 1] - predecessorOffsets[vertexID]};
+    } else {
+        return this->getSuccessorsView(vertexID);
+    }
+}
+
+ArrayView<int> SparseGraph::getCostRowView(int vertexID) const {
+    Table<int> costRow;
+    costRow.resize(vertexCount, std::numeric_limits<int>::max());
+    int *costs = costRow.getData();
+    for (int k = rowOffsets[vertexID]; k < rowOffsets[vertexID + 1]; ++k) {
+        costs[neighbourIDs[k]] = neighbourCosts[k];
+    }
+    return ArrayView<int>(std::move(costRow));
+}
+
+void SparseGraph::setEdgeParameter(int startVertexID, int endVertexID, int parameter) {
+    const int rowPosition = this->findInRow(startVertexID, endVertexID);
+    if (rowPosition == NOT_IN_ROW) {
+        throw std::invalid_argument("setEdgeParameter() error: described edge does not exist");
+    }
+    neighbourCosts[rowPosition] = parameter;
+    if (this->TYPE == GraphType::Undirected) {
+        neighbourCosts[this->findInRow(endVertexID, startVertexID)] = parameter;
+    }
+}
+
+int SparseGraph::getEdgeCount() const {
+    return edgeCount;
+}
+
+double SparseGraph::getDensity() const {
+    // Computed in floating point - vertexCount squared may not fit in int
+    const double maxEdgeCount = static_cast<double>(vertexCount) * (vertexCount - 1);
+    if (this->TYPE == GraphType::Directed) {
+        return edgeCount / maxEdgeCount;
+    } else {
+        return edgeCount / (maxEdgeCount / 2);
+    }
+}
+
+std::string SparseGraph::toString() const {
+    std::stringstream graphString;
+    graphString << std::endl << "Sparse rows (vertex:cost):" << std::endl;
+    graphString << std::setw(2) << "V" << std::endl;
+    for (int i = 0; i < vertexCount; ++i) {
+        graphString << std::setw(2) << i << ": [";
+        for (int k = rowOffsets[i]; k < rowOffsets[i + 1]; ++k) {
+            graphString << neighbourIDs[k] << ':' << neighbourCosts[k];
+            if (k != rowOffsets[i + 1] - 1) {
+                graphString << ", ";
+            }
+        }
+        graphString << ']' << std::endl;
+    }
+    return graphString.str();
+}
+
+IGraph::GraphType SparseGraph::getGraphType() const {
+    return TYPE;
+}
+
+IGraph::GraphStructure SparseGraph::getGraphStructure() const {
+    return CompressedSparseRow;
+}
@@ -0,0 +1,141 @@
+#ifndef PEA_P1_SPARSEGRAPH_H
+#define PEA_P1_SPARSEGRAPH_H
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "IGraph.h"
+#include "misc/Edge.h"
+#include "../Table.h"
+#include "../DoublyLinkedList.h"
+
+// Compressed sparse rows - memory is O(V + E), meant for instances far from complete
+// Row v holds successors of v sorted by vertex ID (both directions of undirected edges are stored),
+// with costs kept in a parallel array; edge lookup is a binary search in the row
+// Directed graphs also keep predecessors rows (without costs)
+// Missing edges are reported as std::numeric_limits<int>::max(), loops and multiple edges are disallowed
+// Build graphs with the bulk constructor - addEdge() and removeEdge() shift the arrays, O(V + E) each
+class SparseGraph final : public IGraph {
+public:
+
+    SparseGraph(GraphType graphType, int nVertex);
+
+    // Builds rows from edges in O(V + E log(max degree)), undirected edges are given once
+    // Throws std::invalid_argument on invalid vertex's index, loop or multiple edge
+    SparseGraph(GraphType graphType, int nVertex, const Table<Edge> &edges);
+
+    void addEdge(int startVertexID, int endVertexID, int edgeParameter) override;
+
+    void removeEdge(int startVertexID, int endVertexID) override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexSuccessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertices() const override;
+
+    // Borrowed view of the row, sorted by vertex ID
+    [[nodiscard]] ArrayView<int> getSuccessorsView(int vertexID) const override {
+        return {neighbourIDs.getData() + rowOffsets[vertexID], getOutDegree(vertexID)};
+    }
+
+    // Borrowed view of costs of edges to getSuccessorsView(vertexID)[k], for every k
+    [[nodiscard]] ArrayView<int> getSuccessorCostsView(int vertexID) const {
+        return {neighbourCosts.getData() + rowOffsets[vertexID], getOutDegree(vertexID)};
+    }
+
+    // Borrowed view of the predecessors row (successors row for undirected graph), sorted by vertex ID
+    [[nodiscard]] ArrayView<int> getPredecessorsView(int vertexID) const override;
+
+    // Owning view - row is expanded to getVertexCount() costs
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override;
+
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return getCost(startVertexID, endVertexID);
+    }
+
+    // Parameter of existing edge is changed, missing edge throws std::invalid_argument
+    void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
+
+    // Non-virtual, unchecked accessor for hot loops - binary search in the row of startVertexID
+    [[nodiscard]] int getCost(int startVertexID, int endVertexID) const {
+        const int rowPosition = findInRow(startVertexID, endVertexID);
+        return (rowPosition == NOT_IN_ROW) ? std::numeric_limits<int>::max()
+                                           : neighbourCosts.getData()[rowPosition];
+    }
+
+    [[nodiscard]] int getOutDegree(int vertexID) const {
+        return rowOffsets[vertexID + 1] - rowOffsets[vertexID];
+    }
+
+    [[nodiscard]] int getVertexCount() const override {
+        return vertexCount;
+    }
+
+    [[nodiscard]] int getEdgeCount() const override;
+
+    [[nodiscard]] double getDensity() const override;
+
+    [[nodiscard]] std::string toString() const override;
+
+    [[nodiscard]] GraphType getGraphType() const override;
+
+    [[nodiscard]] GraphStructure getGraphStructure() const override;
+
+private:
+
+    // Vertex count is fixed - always throws
+    void addVertex() override;
+
+    // Returned by findInRow() if vertex is not in the row
+    static const int NOT_IN_ROW = -1;
+
+    // Position of endVertexID in neighbourIDs (within row of startVertexID) or NOT_IN_ROW
+    [[nodiscard]] int findInRow(int startVertexID, int endVertexID) const {
+        const int *rowStart = neighbourIDs.getData() + rowOffsets.getData()[startVertexID];
+        const int *rowEnd = neighbourIDs.getData() + rowOffsets.getData()[startVertexID + 1];
+        const int *position = std::lower_bound(rowStart, rowEnd, endVertexID);
+        return (position != rowEnd && *position == endVertexID) ? static_cast<int>(position - neighbourIDs.getData())
+                                                                : NOT_IN_ROW;
+    }
+
+    // Inserts vertexID into (sorted) row of rowVertexID, costs are skipped if nullptr
+    static void insertIntoRow(Table<int> &offsets, Table<int> &vertexIDs, Table<int> *costs, int rowVertexID,
+                              int vertexID, int cost);
+
+    // Removes (present) vertexID from row of rowVertexID, costs are skipped if nullptr
+    static void removeFromRow(Table<int> &offsets, Table<int> &vertexIDs, Table<int> *costs, int rowVertexID,
+                              int vertexID);
+
+    // Fills offsets, vertexIDs and costs (if not nullptr) with rows of given (row, vertex, cost) entries
+    // Throws std::invalid_argument if any row contains the same vertex twice
+    static void buildRows(int nVertex, const Table<int> &entryRows, const Table<int> &entryVertices,
+                          const Table<int> &entryCosts, Table<int> &offsets, Table<int> &vertexIDs,
+                          Table<int> *costs);
+
+    const GraphType TYPE;
+
+    const int vertexCount;
+
+    int edgeCount;
+
+    // Row v occupies [rowOffsets[v], rowOffsets[v + 1]) of neighbourIDs and neighbourCosts
+    Table<int> rowOffsets;
+
+    Table<int> neighbourIDs;
+
+    // Weight or flow
+    Table<int> neighbourCosts;
+
+    // Rows of predecessors, maintained only for directed graphs
+    Table<int> predecessorOffsets;
+
+    Table<int> predecessorIDs;
+
+    friend class SparseGraphTest;
+};
+
+#endif //PEA_P1_SPARSEGRAPH_H
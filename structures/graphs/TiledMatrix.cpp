@@ -0,0 +1,208 @@
+#include "TiledMatrix.h"
+
+TiledMatrix::TiledMatrix(GraphType graphType, int nVertex, Layout layout)
+        : TYPE(graphType), LAYOUT(layout), vertexCount(nVertex),
+          paddedVertexCount(((nVertex + ((layout == MortonTiles) ? BLOCK_SIDE : TILE_SIDE) - 1) /
+                             ((layout == MortonTiles) ? BLOCK_SIDE : TILE_SIDE)) *
+                            ((layout == MortonTiles) ? BLOCK_SIDE : TILE_SIDE)),
+          edgeCount(0), costs(nullptr) {
+    if (nVertex < 1) {
+        throw std::invalid_argument("TiledMatrix() error: graph must have at least one vertex");
+    }
+    const std::size_t tileArea = TILE_SIDE * TILE_SIDE;
+    const std::size_t blockArea = BLOCK_SIDE * BLOCK_SIDE;
+    const std::size_t paddedCount = paddedVertexCount;
+    rowOffsets.resize(vertexCount);
+    columnOffsets.resize(vertexCount);
+    for (std::size_t v = 0; v < static_cast<std::size_t>(vertexCount); ++v) {
+        const std::size_t inTileOffset = v % TILE_SIDE;
+        if (LAYOUT == Tiles) {
+            rowOffsets[v] = (v / TILE_SIDE) * paddedCount * TILE_SIDE + inTileOffset * TILE_SIDE;
+            columnOffsets[v] = (v / TILE_SIDE) * tileArea + inTileOffset;
+        } else {
+            // Tile index within a block interleaves bits of tile's row (odd positions) and column (even positions)
+            const std::size_t tileInBlock = (v % BLOCK_SIDE) / TILE_SIDE;
+            rowOffsets[v] = (v / BLOCK_SIDE) * paddedCount * BLOCK_SIDE + (spreadBits(tileInBlock) << 1) * tileArea +
+                            inTileOffset * TILE_SIDE;
+            columnOffsets[v] = (v / BLOCK_SIDE) * blockArea + spreadBits(tileInBlock) * tileArea + inTileOffset;
+        }
+    }
+
+    const std::size_t bufferSize = paddedCount * paddedCount;
+    costs = static_cast<int *>(::operator new[](bufferSize * sizeof(int), std::align_val_t(ALIGNMENT)));
+    for (std::size_t idx = 0; idx < bufferSize; ++idx) {
+        costs[idx] = std::numeric_limits<int>::max();
+    }
+}
+
+TiledMatrix::~TiledMatrix() {
+    ::operator delete[](costs, std::align_val_t(ALIGNMENT));
+}
+
+std::size_t TiledMatrix::spreadBits(std::size_t value) {
+    value = (value | (value << 8)) & 0x00FF00FF;
+    value = (value | (value << 4)) & 0x0F0F0F0F;
+    value = (value | (value << 2)) & 0x33333333;
+    value = (value | (value << 1)) & 0x55555555;
+    return value;
+}
+
+void TiledMatrix::addVertex() {
+    throw std::logic_error("addVertex() error: TiledMatrix has fixed vertex count");
+}
+
+void TiledMatrix::addEdge(int startVertexID, int endVertexID, int edgeParameter) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("addEdge() error: invalid vertex's index");
+    }
+    if (startVertexID == endVertexID) {
+        throw std::invalid_argument("addEdge() error: loops are disallowed");
+    }
+    // Multiple edges are not represented in this graph's structure
+    if (this->getCost(startVertexID, endVertexID) != std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("addEdge() error: multiple edges are disallowed");
+    }
+
+    costAt(startVertexID, endVertexID) = edgeParameter;
+    if (this->TYPE == GraphType::Undirected) {
+        costAt(endVertexID, startVertexID) = edgeParameter;
+    }
+    ++edgeCount;
+}
+
+void TiledMatrix::removeEdge(int startVertexID, int endVertexID) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("removeEdge() error: invalid vertex's index");
+    }
+    if (this->getCost(startVertexID, endVertexID) == std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("removeEdge() error: described edge does not exist");
+    }
+
+    costAt(startVertexID, endVertexID) = std::numeric_limits<int>::max();
+    if (this->TYPE == GraphType::Undirected) {
+        costAt(endVertexID, startVertexID) = std::numeric_limits<int>::max();
+    }
+    --edgeCount;
+}
+
+DoublyLinkedList<int> TiledMatrix::getVertices() const {
+    DoublyLinkedList<int> vertexes;
+    for (int i = 0; i < vertexCount; ++i) {
+        vertexes.insertAtEnd(i);
+    }
+    return vertexes;
+}
+
+DoublyLinkedList<int> TiledMatrix::getVertexSuccessors(int vertexID) const {
+    DoublyLinkedList<int> successors;
+    for (int j = 0; j < vertexCount; ++j) {
+        if (this->getCost(vertexID, j) != std::numeric_limits<int>::max()) {
+            successors.insertAtEnd(j);
+        }
+    }
+    return successors;
+}
+
+ArrayView<int> TiledMatrix::getSuccessorsView(int vertexID) const {
+    Table<int> successors;
+    successors.reserve(vertexCount);
+    for (int j = 0; j < vertexCount; ++j) {
+        if (this->getCost(vertexID, j) != std::numeric_limits<int>::max()) {
+            successors.insertAtEnd(j);
+        }
+    }
+    return ArrayView<int>(std::move(successors));
+}
+
+ArrayView<int> TiledMatrix::getCostRowView(int vertexID) const {
+    Table<int> costRow;
+    costRow.resize(vertexCount);
+    int *rowCosts = costRow.getData();
+    for (int j = 0; j < vertexCount; ++j) {
+        rowCosts[j] = this->getCost(vertexID, j);
+    }
+    return ArrayView<int>(std::move(costRow));
+}
+
+DoublyLinkedList<int> TiledMatrix::getVertexPredecessors(int vertexID) const {
+    DoublyLinkedList<int> predecessors;
+    for (int i = 0; i < vertexCount; ++i) {
+        if (this->getCost(i, vertexID) != std::numeric_limits<int>::max()) {
+            predecessors.insertAtEnd(i);
+        }
+    }
+    return predecessors;
+}
+
+void TiledMatrix::setEdgeParameter(int startVertexID, int endVertexID, int parameter) {
+    costAt(startVertexID, endVertexID) = parameter;
+    if (this->TYPE == GraphType::Undirected) {
+        costAt(endVertexID, startVertexID) = parameter;
+    }
+}
+
+void TiledMatrix::assignCosts(const int *costMatrix) {
+    edgeCount = 0;
+    for (int i = 0; i < vertexCount; ++i) {
+        const int *sourceRow = costMatrix + static_cast<std::size_t>(i) * vertexCount;
+        costAt(i, i) = std::numeric_limits<int>::max();
+        const int firstColumn = (this->TYPE == GraphType::Directed) ? 0 : i + 1;
+        for (int j = firstColumn; j < vertexCount; ++j) {
+            if (j == i) {
+                continue;
+            }
+            costAt(i, j) = sourceRow[j];
+            if (this->TYPE == GraphType::Undirected) {
+                costAt(j, i) = sourceRow[j];
+            }
+            if (sourceRow[j] != std::numeric_limits<int>::max()) {
+                ++edgeCount;
+            }
+        }
+    }
+}
+
+int TiledMatrix::getEdgeCount() const {
+    return edgeCount;
+}
+
+double TiledMatrix::getDensity() const {
+    const double maxEdgeCount = static_cast<double>(vertexCount) * (vertexCount - 1);
+    if (this->TYPE == GraphType::Directed) {
+        return edgeCount / maxEdgeCount;
+    } else {
+        return edgeCount / (maxEdgeCount / 2);
+    }
+}
+
+std::string TiledMatrix::toString() const {
+    const int numberFieldLen = 3;
+    std::stringstream graphString;
+    graphString << std::endl << "Tiled matrix:" << std::endl;
+    graphString << "V\\V";
+    for (int j = 0; j < vertexCount; ++j) {
+        graphString << std::setw(numberFieldLen) << j << ',';
+    }
+    graphString << std::endl;
+    for (int i = 0; i < vertexCount; ++i) {
+        graphString << std::setw(2) << std::to_string(i) << "[";
+        for (int j = 0; j < vertexCount; ++j) {
+            graphString << std::setw(numberFieldLen) <<
+                        ((this->getCost(i, j) == std::numeric_limits<int>::max()) ? "*" : std::to_string(
+                                this->getCost(i, j)));
+            if (j != vertexCount - 1) {
+                graphString << ',';
+            }
+        }
+        graphString << ']' << std::endl;
+    }
+    return graphString.str();
+}
+
+IGraph::GraphType TiledMatrix::getGraphType() const {
+    return TYPE;
+}
+
+IGraph::GraphStructure TiledMatrix::getGraphStructure() const {
+    return (LAYOUT == MortonTiles) ? MortonFlatMatrix : TiledFlatMatrix;
+}
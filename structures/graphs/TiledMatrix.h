@@ -0,0 +1,129 @@
+#ifndef PEA_P1_TILEDMATRIX_H
+#define PEA_P1_TILEDMATRIX_H
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "IGraph.h"
+#include "../Table.h"
+#include "../DoublyLinkedList.h"
+
+// Costs of all edges stored in square TILE_SIDE x TILE_SIDE tiles, every tile row fills one cache line
+// Meant for instances in the thousands of vertices, where a row-major matrix misses cache and TLB
+// on almost every random (i, j) lookup - nearby vertex pairs share a tile (1 KiB, a quarter of a page)
+// Layout Tiles orders tiles row by row, MortonTiles orders them along Z-curve within 128 x 128 vertex blocks
+// Missing edges (and the diagonal) hold std::numeric_limits<int>::max(), loops and multiple edges are disallowed
+// Vertex count is fixed at construction
+class TiledMatrix final : public IGraph {
+public:
+
+    enum Layout {
+        Tiles, MortonTiles
+    };
+
+    // Side of a tile, in vertices
+    static const int TILE_SIDE = 16;
+
+    // Side of a block of Z-ordered tiles (MortonTiles layout), in vertices
+    static const int BLOCK_SIDE = 128;
+
+    // Alignment (in bytes) of the buffer, equal to the length of a tile row
+    static const std::size_t ALIGNMENT = 64;
+
+    TiledMatrix(GraphType graphType, int nVertex, Layout layout = Tiles);
+
+    ~TiledMatrix() override;
+
+    TiledMatrix(const TiledMatrix &otherMatrix) = delete;
+
+    TiledMatrix &operator=(const TiledMatrix &otherMatrix) = delete;
+
+    void addEdge(int startVertexID, int endVertexID, int edgeParameter) override;
+
+    void removeEdge(int startVertexID, int endVertexID) override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexSuccessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertices() const override;
+
+    [[nodiscard]] ArrayView<int> getSuccessorsView(int vertexID) const override;
+
+    // Owning view - row is gathered from getVertexCount() / TILE_SIDE tiles
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override;
+
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return getCost(startVertexID, endVertexID);
+    }
+
+    // Replaces all edges with costs from row-major getVertexCount() x getVertexCount() costMatrix, without per-edge checks
+    // The diagonal is skipped, undirected graph reads only the upper triangle, std::numeric_limits<int>::max() is no edge
+    void assignCosts(const int *costMatrix);
+
+    void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
+
+    // Non-virtual, unchecked accessor for hot loops
+    // Position of the cost is the sum of per-row and per-column offsets, so both layouts cost the same here
+    [[nodiscard]] int getCost(int startVertexID, int endVertexID) const {
+        return costs[rowOffsets.getData()[startVertexID] + columnOffsets.getData()[endVertexID]];
+    }
+
+    [[nodiscard]] int getVertexCount() const override {
+        return vertexCount;
+    }
+
+    [[nodiscard]] Layout getLayout() const {
+        return LAYOUT;
+    }
+
+    [[nodiscard]] int getEdgeCount() const override;
+
+    [[nodiscard]] double getDensity() const override;
+
+    [[nodiscard]] std::string toString() const override;
+
+    [[nodiscard]] GraphType getGraphType() const override;
+
+    // TiledFlatMatrix or MortonFlatMatrix, depending on the layout
+    [[nodiscard]] GraphStructure getGraphStructure() const override;
+
+private:
+
+    // Vertex count is fixed - always throws
+    void addVertex() override;
+
+    // Bits of value moved to even positions (value < 2^16)
+    [[nodiscard]] static std::size_t spreadBits(std::size_t value);
+
+    int &costAt(int startVertexID, int endVertexID) {
+        return costs[rowOffsets.getData()[startVertexID] + columnOffsets.getData()[endVertexID]];
+    }
+
+    const GraphType TYPE;
+
+    const Layout LAYOUT;
+
+    const int vertexCount;
+
+    // vertexCount rounded up to TILE_SIDE (Tiles) or BLOCK_SIDE (MortonTiles), buffer holds its square
+    const int paddedVertexCount;
+
+    int edgeCount;
+
+    // Offsets of vertex's tile row and of vertex's column within a tile row, they add up to the position of a cost
+    Table<std::size_t> rowOffsets;
+
+    Table<std::size_t> columnOffsets;
+
+    // Weight or flow, paddedVertexCount^2 elements
+    int *costs;
+
+    friend class TiledMatrixTest;
+};
+
+#endif //PEA_P1_TILEDMATRIX_H
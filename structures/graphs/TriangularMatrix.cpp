@@ -0,0 +1,146 @@
+#include "TriangularMatrix.h"
+
+TriangularMatrix::TriangularMatrix(GraphType graphType, int nVertex)
+        : vertexCount(nVertex), edgeCount(0), costs(nullptr) {
+    if (graphType != GraphType::Undirected) {
+        throw std::invalid_argument("TriangularMatrix() error: only undirected graphs can be stored");
+    }
+    if (nVertex < 1) {
+        throw std::invalid_argument("TriangularMatrix() error: graph must have at least one vertex");
+    }
+    const std::size_t bufferSize = static_cast<std::size_t>(nVertex) * (nVertex + 1) / 2;
+    costs = new int[bufferSize];
+    std::fill(costs, costs + bufferSize, std::numeric_limits<int>::max());
+}
+
+TriangularMatrix::~TriangularMatrix() {
+    delete[] costs;
+}
+
+void TriangularMatrix::addVertex() {
+    throw std::logic_error("addVertex() error: TriangularMatrix has fixed vertex count");
+}
+
+void TriangularMatrix::addEdge(int startVertexID, int endVertexID, int edgeParameter) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("addEdge() error: invalid vertex's index");
+    }
+    if (startVertexID == endVertexID) {
+        throw std::invalid_argument("addEdge() error: loops are disallowed");
+    }
+    // Multiple edges are not represented in this graph's structure
+    if (this->getCost(startVertexID, endVertexID) != std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("addEdge() error: multiple edges are disallowed");
+    }
+
+    costs[packedIndex(startVertexID, endVertexID)] = edgeParameter;
+    ++edgeCount;
+}
+
+void TriangularMatrix::removeEdge(int startVertexID, int endVertexID) {
+    if (startVertexID < 0 || startVertexID >= vertexCount || endVertexID < 0 || endVertexID >= vertexCount) {
+        throw std::invalid_argument("removeEdge() error: invalid vertex's index");
+    }
+    if (this->getCost(startVertexID, endVertexID) == std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("removeEdge() error: described edge does not exist");
+    }
+
+    costs[packedIndex(startVertexID, endVertexID)] = std::numeric_limits<int>::max();
+    --edgeCount;
+}
+
+DoublyLinkedList<int> TriangularMatrix::getVertices() const {
+    DoublyLinkedList<int> vertexes;
+    for (int i = 0; i < vertexCount; ++i) {
+        vertexes.insertAtEnd(i);
+    }
+    return vertexes;
+}
+
+DoublyLinkedList<int> TriangularMatrix::getVertexSuccessors(int vertexID) const {
+    DoublyLinkedList<int> successors;
+    for (int j = 0; j < vertexCount; ++j) {
+        if (this->getCost(vertexID, j) != std::numeric_limits<int>::max()) {
+            successors.insertAtEnd(j);
+        }
+    }
+    return successors;
+}
+
+DoublyLinkedList<int> TriangularMatrix::getVertexPredecessors(int vertexID) const {
+    // Graph is undirected
+    return getVertexSuccessors(vertexID);
+}
+
+ArrayView<int> TriangularMatrix::getCostRowView(int vertexID) const {
+    Table<int> row;
+    row.resize(vertexCount);
+    int *rowCosts = row.getData();
+    const int *packedRow = costs + packedIndex(vertexID, 0);
+    for (int j = 0; j <= vertexID; ++j) {
+        rowCosts[j] = packedRow[j];
+    }
+    for (int j = vertexID + 1; j < vertexCount; ++j) {
+        rowCosts[j] = costs[packedIndex(j, vertexID)];
+    }
+    return ArrayView<int>(std::move(row));
+}
+
+void TriangularMatrix::setEdgeParameter(int startVertexID, int endVertexID, int parameter) {
+    costs[packedIndex(startVertexID, endVertexID)] = parameter;
+}
+
+void TriangularMatrix::assignCosts(const int *costMatrix) {
+    edgeCount = 0;
+    for (int i = 0; i < vertexCount; ++i) {
+        // Packed row i holds edges {i, j} for j <= i, taken from column i of the upper triangle
+        int *row = costs + packedIndex(i, 0);
+        for (int j = 0; j < i; ++j) {
+            row[j] = costMatrix[static_cast<std::size_t>(j) * vertexCount + i];
+            if (row[j] != std::numeric_limits<int>::max()) {
+                ++edgeCount;
+            }
+        }
+        row[i] = std::numeric_limits<int>::max();
+    }
+}
+
+int TriangularMatrix::getEdgeCount() const {
+    return edgeCount;
+}
+
+double TriangularMatrix::getDensity() const {
+    return static_cast<double>(edgeCount) / ((vertexCount * (vertexCount - 1)) / 2);
+}
+
+std::string TriangularMatrix::toString() const {
+    const int numberFieldLen = 3;
+    std::stringstream graphString;
+    graphString << std::endl << "Triangular matrix:" << std::endl;
+    graphString << "V\\V";
+    for (int j = 0; j < vertexCount; ++j) {
+        graphString << std::setw(numberFieldLen) << j << ',';
+    }
+    graphString << std::endl;
+    for (int i = 0; i < vertexCount; ++i) {
+        graphString << std::setw(2) << std::to_string(i) << "[";
+        for (int j = 0; j <= i; ++j) {
+            graphString << std::setw(numberFieldLen) <<
+                        ((this->getCost(i, j) == std::numeric_limits<int>::max()) ? "*" : std::to_string(
+                                this->getCost(i, j)));
+            if (j != i) {
+                graphString << ',';
+            }
+        }
+        graphString << ']' << std::endl;
+    }
+    return graphString.str();
+}
+
+IGraph::GraphType TriangularMatrix::getGraphType() const {
+    return GraphType::Undirected;
+}
+
+IGraph::GraphStructure TriangularMatrix::getGraphStructure() const {
+    return PackedTriangular;
+}
@@ -0,0 +1,95 @@
+#ifndef PEA_P1_TRIANGULARMATRIX_H
+#define PEA_P1_TRIANGULARMATRIX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "IGraph.h"
+#include "../DoublyLinkedList.h"
+
+// Costs of undirected graph stored once per vertex pair, in packed triangular buffer:
+// row v holds costs of edges {v, 0}, {v, 1}, ..., {v, v} (n * (n + 1) / 2 elements in total)
+// Diagonal is stored as well (always std::numeric_limits<int>::max()), so that lookups need no branches
+// Missing edges hold std::numeric_limits<int>::max(), loops and multiple edges are disallowed
+// Vertex count is fixed at construction, only GraphType::Undirected is supported
+class TriangularMatrix final : public IGraph {
+public:
+
+    TriangularMatrix(GraphType graphType, int nVertex);
+
+    ~TriangularMatrix() override;
+
+    TriangularMatrix(const TriangularMatrix &otherMatrix) = delete;
+
+    TriangularMatrix &operator=(const TriangularMatrix &otherMatrix) = delete;
+
+    void addEdge(int startVertexID, int endVertexID, int edgeParameter) override;
+
+    void removeEdge(int startVertexID, int endVertexID) override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexSuccessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertexPredecessors(int vertexID) const override;
+
+    [[nodiscard]] DoublyLinkedList<int> getVertices() const override;
+
+    // Owning view - row is gathered from the packed row and the column below the diagonal
+    [[nodiscard]] ArrayView<int> getCostRowView(int vertexID) const override;
+
+    [[nodiscard]] int getEdgeParameter(int startVertexID, int endVertexID) const override {
+        return getCost(startVertexID, endVertexID);
+    }
+
+    // Replaces all edges with costs from the upper triangle of row-major getVertexCount() x getVertexCount() costMatrix,
+    // without per-edge checks; std::numeric_limits<int>::max() is no edge
+    void assignCosts(const int *costMatrix);
+
+    void setEdgeParameter(int startVertexID, int endVertexID, int parameter) override;
+
+    // Non-virtual, unchecked accessor for hot loops
+    [[nodiscard]] int getCost(int startVertexID, int endVertexID) const {
+        return costs[packedIndex(startVertexID, endVertexID)];
+    }
+
+    [[nodiscard]] int getVertexCount() const override {
+        return vertexCount;
+    }
+
+    [[nodiscard]] int getEdgeCount() const override;
+
+    [[nodiscard]] double getDensity() const override;
+
+    [[nodiscard]] std::string toString() const override;
+
+    [[nodiscard]] GraphType getGraphType() const override;
+
+    [[nodiscard]] GraphStructure getGraphStructure() const override;
+
+private:
+
+    // Vertex count is fixed - always throws
+    void addVertex() override;
+
+    // Position of cost of edge {startVertexID, endVertexID} in costs (order of vertices does not matter)
+    // std::min/std::max compile to conditional moves
+    [[nodiscard]] static std::size_t packedIndex(int startVertexID, int endVertexID) {
+        const auto row = static_cast<std::size_t>(std::max(startVertexID, endVertexID));
+        const auto column = static_cast<std::size_t>(std::min(startVertexID, endVertexID));
+        return row * (row + 1) / 2 + column;
+    }
+
+    const int vertexCount;
+
+    int edgeCount;
+
+    // Weight or flow, vertexCount * (vertexCount + 1) / 2 elements
+    int *costs;
+
+    friend class TriangularMatrixTest;
+};
+
+#endif //PEA_P1_TRIANGULARMATRIX_H
@@ -0,0 +1,148 @@
+#include "BinaryInstanceTest.h"
+
+#define pStartInfo(method) cout << "##### BinaryInstanceTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% BinaryInstanceTest::" << (method) << "() end %%%%%" << endl << endl
+
+void BinaryInstanceTest::run() {
+    testDirectory = std::filesystem::temp_directory_path() / "pea_p1_binary_instance_test";
+    std::filesystem::remove_all(testDirectory);
+    std::filesystem::create_directories(testDirectory);
+
+    pStartInfo("testWriteRead");
+    testWriteRead();
+    pEndInfo("testWriteRead");
+
+    pStartInfo("testStaleAndDamagedFile");
+    testStaleAndDamagedFile();
+    pEndInfo("testStaleAndDamagedFile");
+
+    pStartInfo("testIsSymmetricMatrix");
+    testIsSymmetricMatrix();
+    pEndInfo("testIsSymmetricMatrix");
+
+    pStartInfo("testInstanceCache");
+    testInstanceCache(TSPUtils::BinaryCache);
+    testInstanceCache(TSPUtils::BinaryCacheHugePages);
+    pEndInfo("testInstanceCache");
+
+    TSPUtils::setInstanceCache(TSPUtils::BinaryCache);
+    std::filesystem::remove_all(testDirectory);
+}
+
+void BinaryInstanceTest::testWriteRead() {
+    const BinaryInstance::SourceStamp stamp{123, 456};
+    // Ranges needing 1, 2 and 4 bytes per cost
+    const std::vector<std::vector<int>> matrices = {{-1, 5, 200, -1},
+                                                    {-1, 60'000, 7, -1},
+                                                    {std::numeric_limits<int>::min(), 0, 0,
+                                                     std::numeric_limits<int>::max()}};
+    for (const auto &matrix : matrices) {
+        const std::string path = (testDirectory / "matrix.bin").string();
+        const bool isWritten = BinaryInstance::write(path, "matrix2", 2, matrix.data(), stamp);
+        assert(isWritten);
+        BinaryInstance::Contents contents;
+        const bool isRead = BinaryInstance::read(path, &stamp, MappedFile::PageCache, contents);
+        assert(isRead);
+        assert(contents.instanceName == "matrix2");
+        assert(contents.vertexCount == 2);
+        assert(contents.costMatrix == matrix);
+        assert(contents.isSymmetric == (matrix[1] == matrix[2]));
+    }
+    BinaryInstance::Contents contents;
+    const bool isMissingRead = BinaryInstance::read((testDirectory / "missing.bin").string(), nullptr,
+                                                    MappedFile::PageCache, contents);
+    assert(!isMissingRead);
+}
+
+void BinaryInstanceTest::testStaleAndDamagedFile() {
+    const BinaryInstance::SourceStamp stamp{123, 456};
+    const std::vector<int> matrix = {-1, 1, 2, 3, -1, 4, 5, 6, -1};
+    const std::string path = (testDirectory / "damaged.bin").string();
+    const bool isWritten = BinaryInstance::write(path, "matrix3", 3, matrix.data(), stamp);
+    assert(isWritten);
+
+    BinaryInstance::Contents contents;
+    const BinaryInstance::SourceStamp otherStamp{123, 457};
+    const bool isStaleRead = BinaryInstance::read(path, &otherStamp, MappedFile::PageCache, contents);
+    assert(!isStaleRead);
+    // Stamp is not checked without the expected one
+    const bool isUnstampedRead = BinaryInstance::read(path, nullptr, MappedFile::PageCache, contents);
+    assert(isUnstampedRead);
+
+    // Last stored cost is changed
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put(static_cast<char>(100));
+    }
+    const bool isChangedRead = BinaryInstance::read(path, nullptr, MappedFile::PageCache, contents);
+    assert(!isChangedRead);
+
+    std::filesystem::resize_file(path, 100);
+    const bool isTruncatedRead = BinaryInstance::read(path, nullptr, MappedFile::PageCache, contents);
+    assert(!isTruncatedRead);
+}
+
+void BinaryInstanceTest::testIsSymmetricMatrix() {
+    const int nVertex = 130;
+    std::vector<int> matrix(nVertex * nVertex);
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            matrix[i * nVertex + j] = (i == j) ? i : i + j;
+        }
+    }
+    // Diagonal does not matter
+    assert(BinaryInstance::isSymmetricMatrix(matrix.data(), nVertex));
+    for (const auto &pair : std::vector<std::pair<int, int>>{{0, 1}, {63, 64}, {5, 129}, {128, 129}, {64, 127}}) {
+        ++matrix[pair.first * nVertex + pair.second];
+        assert(!BinaryInstance::isSymmetricMatrix(matrix.data(), nVertex));
+        --matrix[pair.first * nVertex + pair.second];
+        ++matrix[pair.second * nVertex + pair.first];
+        assert(!BinaryInstance::isSymmetricMatrix(matrix.data(), nVertex));
+        --matrix[pair.second * nVertex + pair.first];
+    }
+    assert(BinaryInstance::isSymmetricMatrix(matrix.data(), 1));
+}
+
+void BinaryInstanceTest::testInstanceCache(TSPUtils::InstanceCache cacheMode) {
+    TSPUtils::setInstanceCache(cacheMode);
+    const std::filesystem::path textPath = testDirectory / "data17.txt";
+    const std::filesystem::path cachePath = testDirectory / "data17.txt.bin";
+    std::filesystem::remove(cachePath);
+    std::filesystem::copy_file("../input_data/ATSP/data17.txt", textPath,
+                               std::filesystem::copy_options::overwrite_existing);
+
+    IGraph *textGraph = nullptr, *cachedGraph = nullptr;
+    const std::string textName = TSPUtils::loadTSPInstanceAbsolutePath(&textGraph, textPath.string(),
+                                                                       TSPUtils::TSPType::Asymmetric);
+    assert(std::filesystem::exists(cachePath));
+    const auto cacheWriteTime = std::filesystem::last_write_time(cachePath);
+    const std::string cachedName = TSPUtils::loadTSPInstanceAbsolutePath(&cachedGraph, textPath.string(),
+                                                                         TSPUtils::TSPType::Asymmetric);
+    assert(std::filesystem::last_write_time(cachePath) == cacheWriteTime);
+    assert(cachedName == textName);
+    assert(cachedGraph->getEdgeCount() == textGraph->getEdgeCount());
+    for (int i = 0; i < textGraph->getVertexCount(); ++i) {
+        for (int j = 0; j < textGraph->getVertexCount(); ++j) {
+            assert(cachedGraph->getEdgeParameter(i, j) == textGraph->getEdgeParameter(i, j));
+        }
+    }
+    delete cachedGraph;
+
+    // Modified text file replaces the cache
+    {
+        std::ofstream file(textPath, std::ios::trunc);
+        file << "changed3\n3\n-1 1 2\n3 -1 4\n5 6 -1\n";
+    }
+    const std::string changedName = TSPUtils::loadTSPInstanceAbsolutePath(&cachedGraph, textPath.string(),
+                                                                          TSPUtils::TSPType::Asymmetric);
+    assert(changedName == "changed3");
+    assert(cachedGraph->getVertexCount() == 3 && cachedGraph->getEdgeParameter(2, 1) == 6);
+    BinaryInstance::Contents contents;
+    const bool isCacheRead = BinaryInstance::read(cachePath.string(), nullptr, MappedFile::PageCache, contents);
+    assert(isCacheRead);
+    assert(contents.instanceName == "changed3" && !contents.isSymmetric);
+
+    delete textGraph;
+    delete cachedGraph;
+}
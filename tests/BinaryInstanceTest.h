@@ -0,0 +1,38 @@
+#ifndef PEA_P1_BINARYINSTANCETEST_H
+#define PEA_P1_BINARYINSTANCETEST_H
+
+
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../utilities/BinaryInstance.h"
+#include "../utilities/TSPUtils.h"
+
+using std::cout;
+using std::endl;
+
+// Files are written to a directory in the system's temporary directory, removed afterwards
+class BinaryInstanceTest {
+public:
+    void run();
+
+private:
+    // Costs are read back unchanged for every cost width
+    void testWriteRead();
+
+    void testStaleAndDamagedFile();
+
+    // Asymmetric pairs at block boundaries of the comparison
+    void testIsSymmetricMatrix();
+
+    // Cache is written on the first load, used by the next ones and rebuilt when the text file changes
+    void testInstanceCache(TSPUtils::InstanceCache cacheMode);
+
+    std::filesystem::path testDirectory;
+};
+
+#endif //PEA_P1_BINARYINSTANCETEST_H
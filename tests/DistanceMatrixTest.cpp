@@ -0,0 +1,207 @@
+#include "DistanceMatrixTest.h"
+
+#define pStartInfo(method) cout << "##### DistanceMatrixTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% DistanceMatrixTest::" << (method) << "() end %%%%%" << endl << endl
+#define directed "--------Directed:\n"
+#define undirected "--------Undirected:\n"
+
+void DistanceMatrixTest::run() {
+    pStartInfo("testDistanceMatrix");
+    testDistanceMatrix();
+    pEndInfo("testDistanceMatrix");
+
+    pStartInfo("testAddEdge");
+    testAddEdge();
+    pEndInfo("testAddEdge");
+
+    pStartInfo("testRemoveEdge");
+    testRemoveEdge();
+    pEndInfo("testRemoveEdge");
+
+    pStartInfo("testGetVertexSuccessors");
+    testGetVertexSuccessors();
+    pEndInfo("testGetVertexSuccessors");
+
+    pStartInfo("testGetVertexPredecessors");
+    testGetVertexPredecessors();
+    pEndInfo("testGetVertexPredecessors");
+
+    pStartInfo("testGetEdgeParameter");
+    testGetEdgeParameter();
+    pEndInfo("testGetEdgeParameter");
+
+    pStartInfo("testGetDensity");
+    testGetDensity();
+    pEndInfo("testGetDensity");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("SMALL/data10.txt");
+    testLoadTSPInstance("TSP/data17.txt");
+    testLoadTSPInstance("ATSP/data443.txt");
+    pEndInfo("testLoadTSPInstance");
+}
+
+void DistanceMatrixTest::testDistanceMatrix() {
+    DistanceMatrix dmd(DistanceMatrix::GraphType::Directed, 5);
+    assert(dmd.vertexCount == 5);
+    assert(dmd.rowStride % (DistanceMatrix::ALIGNMENT / sizeof(int)) == 0);
+    assert(reinterpret_cast<std::size_t>(dmd.getRow(1)) % DistanceMatrix::ALIGNMENT == 0);
+    assert(dmd.edgeCount == 0);
+    cout << directed << endl;
+    cout << dmd << endl;
+
+    DistanceMatrix dmud(DistanceMatrix::GraphType::Undirected, 5);
+    assert(dmud.vertexCount == 5);
+    assert(dmud.edgeCount == 0);
+    cout << undirected << endl;
+    cout << dmud << endl;
+}
+
+void DistanceMatrixTest::testAddEdge() {
+    DistanceMatrix dmd(DistanceMatrix::GraphType::Directed, 5);
+    dmd.addEdge(0, 3, 5);
+    dmd.addEdge(3, 0, 10);
+    dmd.addEdge(0, 1, 15);
+    dmd.addEdge(2, 4, 20);
+    dmd.addEdge(0, 4, 25);
+    assert(dmd.getCost(0, 3) == 5);
+    assert(dmd.getCost(3, 0) == 10);
+    assert(dmd.getCost(4, 2) == std::numeric_limits<int>::max());
+    assert(dmd.edgeCount == 5);
+    cout << directed << endl;
+    cout << dmd << endl;
+
+    DistanceMatrix dmud(DistanceMatrix::GraphType::Undirected, 5);
+    dmud.addEdge(0, 3, 5);
+    dmud.addEdge(3, 2, 10);
+    dmud.addEdge(0, 1, 15);
+    dmud.addEdge(2, 4, 20);
+    dmud.addEdge(0, 4, 25);
+    assert(dmud.getCost(3, 0) == 5);
+    assert(dmud.getCost(2, 3) == 10);
+    assert(dmud.edgeCount == 5);
+    cout << undirected << endl;
+    cout << dmud << endl;
+
+    bool exceptionThrown = false;
+    try {
+        dmud.addEdge(3, 0, 1);
+    } catch (const std::invalid_argument &e) {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+}
+
+void DistanceMatrixTest::testRemoveEdge() {
+    DistanceMatrix dmd(DistanceMatrix::GraphType::Directed, 5);
+    dmd.addEdge(0, 3, 5);
+    dmd.addEdge(3, 0, 10);
+    dmd.addEdge(0, 1, 15);
+    dmd.removeEdge(0, 3);
+    assert(dmd.getCost(0, 3) == std::numeric_limits<int>::max());
+    assert(dmd.getCost(3, 0) == 10);
+    assert(dmd.edgeCount == 2);
+    cout << directed << endl;
+    cout << dmd << endl;
+
+    DistanceMatrix dmud(DistanceMatrix::GraphType::Undirected, 5);
+    dmud.addEdge(0, 3, 5);
+    dmud.addEdge(3, 2, 10);
+    dmud.removeEdge(2, 3);
+    assert(dmud.getCost(3, 2) == std::numeric_limits<int>::max());
+    assert(dmud.getCost(2, 3) == std::numeric_limits<int>::max());
+    assert(dmud.edgeCount == 1);
+    cout << undirected << endl;
+    cout << dmud << endl;
+}
+
+void DistanceMatrixTest::testGetVertexSuccessors() {
+    DistanceMatrix dmd(DistanceMatrix::GraphType::Directed, 5);
+    dmd.addEdge(0, 3, 5);
+    dmd.addEdge(3, 0, 10);
+    dmd.addEdge(0, 1, 15);
+    dmd.addEdge(2, 4, 20);
+    dmd.addEdge(0, 4, 25);
+    assert(dmd.getVertexSuccessors(0).getSize() == 3);
+    assert(dmd.getVertexSuccessors(4).getSize() == 0);
+    auto successors = dmd.getSuccessorsView(0);
+    assert(successors.getSize() == 3);
+    assert(successors[0] == 1 && successors[1] == 3 && successors[2] == 4);
+    auto costRow = dmd.getCostRowView(0);
+    assert(!costRow.isOwning() && costRow.getData() == dmd.getRow(0));
+    assert(costRow.getSize() == 5 && costRow[3] == 5 && costRow[2] == std::numeric_limits<int>::max());
+
+    DistanceMatrix dmud(DistanceMatrix::GraphType::Undirected, 5);
+    dmud.addEdge(0, 3, 5);
+    dmud.addEdge(3, 2, 10);
+    dmud.addEdge(0, 1, 15);
+    dmud.addEdge(2, 4, 20);
+    dmud.addEdge(0, 4, 25);
+    assert(dmud.getVertexSuccessors(0).getSize() == 3);
+    assert(dmud.getVertexSuccessors(3).getSize() == 2);
+}
+
+void DistanceMatrixTest::testGetVertexPredecessors() {
+    DistanceMatrix dmd(DistanceMatrix::GraphType::Directed, 5);
+    dmd.addEdge(0, 3, 5);
+    dmd.addEdge(3, 0, 10);
+    dmd.addEdge(0, 1, 15);
+    dmd.addEdge(2, 4, 20);
+    dmd.addEdge(0, 4, 25);
+    assert(dmd.getVertexPredecessors(0).getSize() == 1);
+    assert(dmd.getVertexPredecessors(4).getSize() == 2);
+
+    DistanceMatrix dmud(DistanceMatrix::GraphType::Undirected, 5);
+    dmud.addEdge(0, 3, 5);
+    dmud.addEdge(3, 2, 10);
+    dmud.addEdge(0, 1, 15);
+    dmud.addEdge(2, 4, 20);
+    dmud.addEdge(0, 4, 25);
+    assert(dmud.getVertexPredecessors(0).getSize() == 3);
+    assert(dmud.getVertexPredecessors(3).getSize() == 2);
+}
+
+void DistanceMatrixTest::testGetEdgeParameter() {
+    DistanceMatrix dmd(DistanceMatrix::GraphType::Directed, 5);
+    dmd.addEdge(0, 3, 5);
+    dmd.addEdge(3, 0, 10);
+    assert(dmd.getEdgeParameter(0, 3) == 5);
+    assert(dmd.getEdgeParameter(3, 0) == 10);
+    dmd.setEdgeParameter(0, 3, 7);
+    assert(dmd.getEdgeParameter(0, 3) == 7);
+    assert(dmd.getEdgeParameter(1, 1) == std::numeric_limits<int>::max());
+}
+
+void DistanceMatrixTest::testGetDensity() {
+    DistanceMatrix dmd(DistanceMatrix::GraphType::Directed, 5);
+    dmd.addEdge(0, 3, 5);
+    dmd.addEdge(3, 0, 10);
+    dmd.addEdge(0, 1, 15);
+    assert(dmd.getDensity() - 3.0 / (5 * 4) < 0.000001);
+
+    DistanceMatrix dmud(DistanceMatrix::GraphType::Undirected, 6);
+    dmud.addEdge(0, 3, 5);
+    dmud.addEdge(3, 2, 10);
+    dmud.addEdge(0, 1, 15);
+    dmud.addEdge(2, 4, 20);
+    assert(dmud.getDensity() - 4.0 / ((6 * 5) / 2) < 0.000001);
+}
+
+void DistanceMatrixTest::testLoadTSPInstance(const std::string &instanceFile) {
+    cout << "Instance \"" << instanceFile << "\"...";
+    IGraph *listGraph = nullptr, *distanceMatrix = nullptr;
+    TSPUtils::TSPType tspType = TSPUtils::getTSPType(instanceFile);
+    TSPUtils::loadTSPInstance(&listGraph, instanceFile, tspType);
+    TSPUtils::loadTSPInstance(&distanceMatrix, instanceFile, tspType, IGraph::GraphStructure::FlatMatrix);
+    assert(distanceMatrix->getGraphStructure() == IGraph::GraphStructure::FlatMatrix);
+    assert(distanceMatrix->getVertexCount() == listGraph->getVertexCount());
+    assert(distanceMatrix->getEdgeCount() == listGraph->getEdgeCount());
+    for (int i = 0; i < listGraph->getVertexCount(); ++i) {
+        for (int j = 0; j < listGraph->getVertexCount(); ++j) {
+            assert(distanceMatrix->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+        }
+    }
+    delete listGraph;
+    delete distanceMatrix;
+    cout << "SUCCESS" << endl;
+}
@@ -0,0 +1,32 @@
+#ifndef PEA_P1_DISTANCEMATRIXTEST_H
+#define PEA_P1_DISTANCEMATRIXTEST_H
+
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include "../structures/graphs/DistanceMatrix.h"
+#include "../utilities/TSPUtils.h"
+
+using std::cout;
+using std::endl;
+
+class DistanceMatrixTest {
+public:
+    void run();
+
+private:
+    void testDistanceMatrix();
+    void testAddEdge();
+    void testRemoveEdge();
+    void testGetVertexSuccessors();
+    void testGetVertexPredecessors();
+    void testGetEdgeParameter();
+    void testGetDensity();
+
+    // Compares every edge parameter with ListGraph loaded from the same file
+    void testLoadTSPInstance(const std::string &instanceFile);
+};
+
+#endif //PEA_P1_DISTANCEMATRIXTEST_H
@@ -0,0 +1,192 @@
+#include "DoublyLinkedListTest.h"
+
+#define pStartInfo(method) cout << "##### DoublyLinkedListTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% DoublyLinkedListTest::" << (method) << "() end %%%%%" << endl << endl
+
+void DoublyLinkedListTest::run() {
+    pStartInfo("testInsertAndRemove");
+    testInsertAndRemove<PooledNodeAllocator<Node<int>>>();
+    testInsertAndRemove<HeapNodeAllocator<Node<int>>>();
+    pEndInfo("testInsertAndRemove");
+
+    pStartInfo("testCopy");
+    testCopy<PooledNodeAllocator<Node<int>>>();
+    testCopy<HeapNodeAllocator<Node<int>>>();
+    pEndInfo("testCopy");
+
+    pStartInfo("testMoveAndSwap");
+    testMoveAndSwap<PooledNodeAllocator<Node<int>>>();
+    testMoveAndSwap<HeapNodeAllocator<Node<int>>>();
+    pEndInfo("testMoveAndSwap");
+
+    pStartInfo("testStringList");
+    testStringList<PooledNodeAllocator<Node<std::string>>>();
+    testStringList<HeapNodeAllocator<Node<std::string>>>();
+    pEndInfo("testStringList");
+
+    pStartInfo("testPooledNodesReuse");
+    testPooledNodesReuse();
+    pEndInfo("testPooledNodesReuse");
+
+    pStartInfo("testStack");
+    testStack();
+    pEndInfo("testStack");
+}
+
+template<class TNodeAllocator>
+void DoublyLinkedListTest::testInsertAndRemove() {
+    DoublyLinkedList<int, TNodeAllocator> list;
+    assert(list.isEmpty());
+    list.insertAtEnd(2);
+    list.insertAtStart(0);
+    list.insert(1, 1);
+    list.insertAfterValue(2, 3);
+    assert(list.getSize() == 4);
+    for (int i = 0; i < 4; ++i) {
+        assert(list.search(i) == i);
+    }
+    assert(list.getLast() == 3);
+
+    assert(list.removeFromStart() == 0);
+    list.removeFromEnd();
+    list.removeByValue(2);
+    assert(list.getSize() == 1);
+    assert(list.contains(1) && !list.contains(2));
+    list.remove(0);
+    assert(list.isEmpty());
+
+    bool hasThrown = false;
+    try {
+        list.removeFromEnd();
+    } catch (const std::out_of_range &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    // Enough nodes to fill several chunks
+    for (int i = 0; i < 5000; ++i) {
+        list.insertAtEnd(i);
+    }
+    assert(list.getSize() == 5000);
+    int expected = 0;
+    for (auto it = list.getIterator(); it != list.getEndIt(); ++it) {
+        assert(it.getData() == expected);
+        ++expected;
+    }
+}
+
+template<class TNodeAllocator>
+void DoublyLinkedListTest::testCopy() {
+    DoublyLinkedList<int, TNodeAllocator> list;
+    for (int i = 0; i < 100; ++i) {
+        list.insertAtEnd(i);
+    }
+    DoublyLinkedList<int, TNodeAllocator> listCopy(list);
+    assert(listCopy == list);
+    listCopy.removeFromStart();
+    assert(listCopy != list);
+    assert(list.getSize() == 100 && listCopy.getSize() == 99);
+
+    DoublyLinkedList<int, TNodeAllocator> assignedList;
+    assignedList.insertAtEnd(-1);
+    assignedList = list;
+    assert(assignedList == list);
+    assignedList = assignedList;
+    assert(assignedList == list);
+
+    // Copy of an empty list
+    DoublyLinkedList<int, TNodeAllocator> emptyList;
+    DoublyLinkedList<int, TNodeAllocator> emptyCopy(emptyList);
+    assert(emptyCopy.isEmpty());
+    emptyCopy.insertAtEnd(1);
+    assert(emptyCopy.getSize() == 1);
+}
+
+template<class TNodeAllocator>
+void DoublyLinkedListTest::testMoveAndSwap() {
+    static_assert(std::is_nothrow_move_constructible_v<DoublyLinkedList<int, TNodeAllocator>>);
+    static_assert(std::is_nothrow_move_assignable_v<DoublyLinkedList<int, TNodeAllocator>>);
+
+    // Empty lists
+    DoublyLinkedList<int, TNodeAllocator> emptyList;
+    DoublyLinkedList<int, TNodeAllocator> movedEmptyList(std::move(emptyList));
+    assert(emptyList.isEmpty() && movedEmptyList.isEmpty());
+    emptyList.swap(movedEmptyList);
+    movedEmptyList.insertAtEnd(3);
+    emptyList.insertAtStart(4);
+    assert(movedEmptyList.getLast() == 3 && emptyList.getLast() == 4);
+
+    DoublyLinkedList<int, TNodeAllocator> list;
+    for (int i = 0; i < 10; ++i) {
+        list.insertAtEnd(i);
+    }
+    DoublyLinkedList<int, TNodeAllocator> movedList(std::move(list));
+    assert(movedList.getSize() == 10 && movedList.getLast() == 9);
+    assert(list.isEmpty());
+    // Moved from list is still usable
+    list.insertAtEnd(42);
+    assert(list.getSize() == 1 && list.getLast() == 42);
+
+    list = std::move(movedList);
+    assert(list.getSize() == 10 && list.getLast() == 9);
+
+    DoublyLinkedList<int, TNodeAllocator> otherList;
+    otherList.insertAtEnd(7);
+    list.swap(otherList);
+    assert(list.getSize() == 1 && list.getLast() == 7);
+    assert(otherList.getSize() == 10 && otherList.getLast() == 9);
+    // Nodes of swapped lists keep working after further insertions and removals
+    list.insertAtEnd(8);
+    otherList.removeFromStart();
+    assert(list.getLast() == 8 && otherList.search(1) == 0);
+}
+
+template<class TNodeAllocator>
+void DoublyLinkedListTest::testStringList() {
+    DoublyLinkedList<std::string, TNodeAllocator> list;
+    for (int i = 0; i < 50; ++i) {
+        list.insertAtEnd("long enough string to be stored on the heap " + std::to_string(i));
+    }
+    DoublyLinkedList<std::string, TNodeAllocator> listCopy(list);
+    list.removeFromStart();
+    list.removeFromEnd();
+    assert(list.getSize() == 48);
+    assert(listCopy.getSize() == 50);
+    assert(listCopy.getLast() == "long enough string to be stored on the heap 49");
+    listCopy = list;
+    assert(listCopy == list);
+}
+
+void DoublyLinkedListTest::testPooledNodesReuse() {
+    PooledNodeAllocator<Node<int>> allocator;
+    allocator.reserve(2);
+    Node<int> *first = allocator.allocate();
+    Node<int> *second = allocator.allocate();
+    assert(first != second);
+    // Deallocated node is handed out again
+    allocator.deallocate(first);
+    assert(allocator.allocate() == first);
+    allocator.deallocate(second);
+    allocator.deallocate(first);
+    assert(allocator.allocate() == first);
+    assert(allocator.allocate() == second);
+    allocator.release();
+}
+
+void DoublyLinkedListTest::testStack() {
+    Stack<int> stack;
+    for (int i = 0; i < 100; ++i) {
+        stack.push(i);
+    }
+    assert(stack.getSize() == 100);
+    for (int i = 99; i >= 0; --i) {
+        assert(stack.pop() == i);
+    }
+    assert(stack.isEmpty());
+
+    Stack<int, HeapNodeAllocator<Node<int>>> heapStack;
+    heapStack.push(1);
+    heapStack.push(2);
+    assert(heapStack.pop() == 2 && heapStack.pop() == 1);
+    assert(heapStack.isEmpty());
+}
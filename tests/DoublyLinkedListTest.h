@@ -0,0 +1,39 @@
+#ifndef PEA_P1_DOUBLYLINKEDLISTTEST_H
+#define PEA_P1_DOUBLYLINKEDLISTTEST_H
+
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include "../structures/DoublyLinkedList.h"
+#include "../structures/Stack.h"
+
+using std::cout;
+using std::endl;
+
+class DoublyLinkedListTest {
+public:
+    void run();
+
+private:
+    // Every test is run with pooled and with heap allocated nodes
+    template<class TNodeAllocator>
+    void testInsertAndRemove();
+
+    template<class TNodeAllocator>
+    void testCopy();
+
+    template<class TNodeAllocator>
+    void testMoveAndSwap();
+
+    // Elements which are not trivially destructible
+    template<class TNodeAllocator>
+    void testStringList();
+
+    void testPooledNodesReuse();
+
+    void testStack();
+};
+
+#endif //PEA_P1_DOUBLYLINKEDLISTTEST_H
@@ -0,0 +1,231 @@
+#include "GraphBuilderTest.h"
+
+#define pStartInfo(method) cout << "##### GraphBuilderTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% GraphBuilderTest::" << (method) << "() end %%%%%" << endl << endl
+
+void GraphBuilderTest::run() {
+    pStartInfo("testBuildFromCostMatrix");
+    testBuildFromCostMatrix();
+    pEndInfo("testBuildFromCostMatrix");
+
+    pStartInfo("testBuildFromEdges");
+    testBuildFromEdges();
+    pEndInfo("testBuildFromEdges");
+
+    pStartInfo("testInvalidEdges");
+    testInvalidEdges();
+    pEndInfo("testInvalidEdges");
+
+    pStartInfo("testConversions");
+    testConversions();
+    pEndInfo("testConversions");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("ATSP/data17.txt", TSPUtils::TSPType::Asymmetric);
+    testLoadTSPInstance("TSP/data120.txt", TSPUtils::TSPType::Symmetric);
+    pEndInfo("testLoadTSPInstance");
+}
+
+void GraphBuilderTest::testBuildFromCostMatrix() {
+    const int missing = std::numeric_limits<int>::max();
+    const int nVertex = 4;
+    // Diagonal as in text files, lower triangle differs from the upper one (ignored for undirected graphs)
+    const int costMatrix[nVertex * nVertex] = {
+            -1, 5, missing, 7,
+            3, -1, 2, missing,
+            4, 9, -1, 1,
+            missing, 6, 8, -1};
+    for (auto graphType: {IGraph::GraphType::Directed, IGraph::GraphType::Undirected}) {
+        const bool isDirected = graphType == IGraph::GraphType::Directed;
+        ListGraph expectedListGraph(graphType, nVertex);
+        MatrixGraph expectedMatrixGraph(graphType, nVertex);
+        for (int i = 0; i < nVertex; ++i) {
+            for (int j = isDirected ? 0 : i + 1; j < nVertex; ++j) {
+                if (i != j && costMatrix[i * nVertex + j] != missing) {
+                    expectedListGraph.addEdge(i, j, costMatrix[i * nVertex + j]);
+                    expectedMatrixGraph.addEdge(i, j, costMatrix[i * nVertex + j]);
+                }
+            }
+        }
+
+        std::unique_ptr<IGraph> listGraph(GraphBuilder::build(graphType, nVertex, costMatrix,
+                                                              IGraph::GraphStructure::AdjacencyList));
+        assert(listGraph->getGraphStructure() == IGraph::GraphStructure::AdjacencyList);
+        assertSameGraphs(*listGraph, expectedListGraph);
+        std::unique_ptr<IGraph> matrixGraph(GraphBuilder::build(graphType, nVertex, costMatrix,
+                                                                IGraph::GraphStructure::IncidenceMatrix));
+        assert(matrixGraph->getGraphStructure() == IGraph::GraphStructure::IncidenceMatrix);
+        assertSameGraphs(*matrixGraph, expectedMatrixGraph);
+        // Edge IDs follow rows of the matrix
+        auto *builtMatrixGraph = static_cast<MatrixGraph *>(matrixGraph.get());
+        for (int edgeID = 0; edgeID < expectedMatrixGraph.getEdgeCount(); ++edgeID) {
+            assert(builtMatrixGraph->getVertexIdsFromEdge(edgeID) == expectedMatrixGraph.getVertexIdsFromEdge(edgeID));
+        }
+        std::unique_ptr<IGraph> sparseGraph(GraphBuilder::build(graphType, nVertex, costMatrix,
+                                                                IGraph::GraphStructure::CompressedSparseRow));
+        assert(sparseGraph->getEdgeCount() == expectedListGraph.getEdgeCount());
+    }
+
+    // One vertex, no edges
+    const int singleVertex[1] = {0};
+    std::unique_ptr<IGraph> singleGraph(GraphBuilder::build(IGraph::GraphType::Directed, 1, singleVertex,
+                                                            IGraph::GraphStructure::AdjacencyList));
+    assert(singleGraph->getEdgeCount() == 0 && singleGraph->getSuccessorsView(0).getSize() == 0);
+}
+
+void GraphBuilderTest::testBuildFromEdges() {
+    const int nVertex = 5;
+    Table<Edge> edges;
+    edges.emplaceAtEnd(0, 3, 5);
+    edges.emplaceAtEnd(3, 0, 10);
+    edges.emplaceAtEnd(0, 1, 15);
+    edges.emplaceAtEnd(2, 4, 20);
+    edges.emplaceAtEnd(0, 4, 25);
+    edges.emplaceAtEnd(4, 1, 30);
+
+    ListGraph expectedListGraph(IGraph::GraphType::Directed, nVertex);
+    MatrixGraph expectedMatrixGraph(IGraph::GraphType::Directed, nVertex);
+    for (int k = 0; k < edges.getSize(); ++k) {
+        expectedListGraph.addEdge(edges[k].startVertexID, edges[k].endVertexID, edges[k].parameter);
+        expectedMatrixGraph.addEdge(edges[k].startVertexID, edges[k].endVertexID, edges[k].parameter);
+    }
+    std::unique_ptr<IGraph> listGraph(GraphBuilder::build(IGraph::GraphType::Directed, nVertex, edges,
+                                                          IGraph::GraphStructure::AdjacencyList));
+    assertSameGraphs(*listGraph, expectedListGraph);
+    std::unique_ptr<IGraph> matrixGraph(GraphBuilder::build(IGraph::GraphType::Directed, nVertex, edges,
+                                                            IGraph::GraphStructure::IncidenceMatrix));
+    assertSameGraphs(*matrixGraph, expectedMatrixGraph);
+    for (auto graphStructure: {IGraph::GraphStructure::FlatMatrix, IGraph::GraphStructure::QuantizedFlatMatrix,
+                               IGraph::GraphStructure::CompressedSparseRow}) {
+        std::unique_ptr<IGraph> graph(GraphBuilder::build(IGraph::GraphType::Directed, nVertex, edges,
+                                                          graphStructure));
+        assert(graph->getEdgeCount() == edges.getSize());
+        for (int k = 0; k < edges.getSize(); ++k) {
+            assert(graph->getEdgeParameter(edges[k].startVertexID, edges[k].endVertexID) == edges[k].parameter);
+        }
+    }
+
+    // Undirected graph lists every edge at both endpoints
+    Table<Edge> undirectedEdges;
+    undirectedEdges.emplaceAtEnd(0, 3, 5);
+    undirectedEdges.emplaceAtEnd(2, 4, 20);
+    undirectedEdges.emplaceAtEnd(4, 0, 25);
+    ListGraph expectedUndirectedGraph(IGraph::GraphType::Undirected, nVertex);
+    for (int k = 0; k < undirectedEdges.getSize(); ++k) {
+        expectedUndirectedGraph.addEdge(undirectedEdges[k].startVertexID, undirectedEdges[k].endVertexID,
+                                        undirectedEdges[k].parameter);
+    }
+    std::unique_ptr<IGraph> undirectedGraph(GraphBuilder::build(IGraph::GraphType::Undirected, nVertex,
+                                                                undirectedEdges,
+                                                                IGraph::GraphStructure::AdjacencyList));
+    assertSameGraphs(*undirectedGraph, expectedUndirectedGraph);
+}
+
+void GraphBuilderTest::testInvalidEdges() {
+    const int nVertex = 4;
+    auto throwsInvalidArgument = [](IGraph::GraphType graphType, const Table<Edge> &edges,
+                                    IGraph::GraphStructure graphStructure) {
+        try {
+            std::unique_ptr<IGraph> graph(GraphBuilder::build(graphType, nVertex, edges, graphStructure));
+        } catch (const std::invalid_argument &e) {
+            return true;
+        }
+        return false;
+    };
+    const IGraph::GraphStructure graphStructures[] = {IGraph::GraphStructure::AdjacencyList,
+                                                      IGraph::GraphStructure::IncidenceMatrix,
+                                                      IGraph::GraphStructure::CompressedSparseRow,
+                                                      IGraph::GraphStructure::FlatMatrix};
+
+    Table<Edge> invalidIndexes, loops, multipleEdges, reversedPair;
+    invalidIndexes.emplaceAtEnd(0, 1, 1);
+    invalidIndexes.emplaceAtEnd(2, nVertex, 1);
+    loops.emplaceAtEnd(0, 1, 1);
+    loops.emplaceAtEnd(2, 2, 1);
+    multipleEdges.emplaceAtEnd(0, 1, 1);
+    multipleEdges.emplaceAtEnd(0, 1, 2);
+    reversedPair.emplaceAtEnd(0, 1, 1);
+    reversedPair.emplaceAtEnd(1, 0, 2);
+    Table<Edge> negativeIndex;
+    negativeIndex.emplaceAtEnd(-1, 1, 1);
+    for (auto graphStructure: graphStructures) {
+        for (auto graphType: {IGraph::GraphType::Directed, IGraph::GraphType::Undirected}) {
+            assert(throwsInvalidArgument(graphType, invalidIndexes, graphStructure));
+            assert(throwsInvalidArgument(graphType, negativeIndex, graphStructure));
+            assert(throwsInvalidArgument(graphType, loops, graphStructure));
+            assert(throwsInvalidArgument(graphType, multipleEdges, graphStructure));
+        }
+        // Reversed pair is a separate edge of directed graph
+        assert(!throwsInvalidArgument(IGraph::GraphType::Directed, reversedPair, graphStructure));
+        assert(throwsInvalidArgument(IGraph::GraphType::Undirected, reversedPair, graphStructure));
+    }
+}
+
+void GraphBuilderTest::testConversions() {
+    for (auto graphType: {IGraph::GraphType::Directed, IGraph::GraphType::Undirected}) {
+        ListGraph listGraph(graphType, 6);
+        listGraph.addEdge(0, 3, 5);
+        listGraph.addEdge(3, 1, 10);
+        listGraph.addEdge(5, 2, 15);
+        listGraph.addEdge(2, 4, 20);
+        listGraph.addEdge(1, 0, 25);
+
+        MatrixGraph matrixGraph(&listGraph);
+        assert(matrixGraph.getEdgeCount() == listGraph.getEdgeCount());
+        ListGraph convertedBack(&matrixGraph);
+        assert(convertedBack.getEdgeCount() == listGraph.getEdgeCount());
+        for (int i = 0; i < listGraph.getVertexCount(); ++i) {
+            for (int j = 0; j < listGraph.getVertexCount(); ++j) {
+                assert(matrixGraph.getEdgeParameter(i, j) == listGraph.getEdgeParameter(i, j));
+                assert(convertedBack.getEdgeParameter(i, j) == listGraph.getEdgeParameter(i, j));
+            }
+            assert(matrixGraph.getSuccessorsView(i).getSize() == listGraph.getSuccessorsView(i).getSize());
+            assert(convertedBack.getPredecessorsView(i).getSize() == listGraph.getPredecessorsView(i).getSize());
+        }
+    }
+}
+
+void GraphBuilderTest::testLoadTSPInstance(const std::string &instanceFile, TSPUtils::TSPType tspType) {
+    IGraph *listGraph = nullptr;
+    TSPUtils::loadTSPInstance(&listGraph, instanceFile, tspType, IGraph::GraphStructure::AdjacencyList);
+    for (auto graphStructure: {IGraph::GraphStructure::IncidenceMatrix, IGraph::GraphStructure::FlatMatrix,
+                               IGraph::GraphStructure::QuantizedFlatMatrix,
+                               IGraph::GraphStructure::PackedTriangular,
+                               IGraph::GraphStructure::CompressedSparseRow,
+                               IGraph::GraphStructure::TiledFlatMatrix}) {
+        if (graphStructure == IGraph::GraphStructure::PackedTriangular && tspType == TSPUtils::TSPType::Asymmetric) {
+            continue;
+        }
+        IGraph *graph = nullptr;
+        TSPUtils::loadTSPInstance(&graph, instanceFile, tspType, graphStructure);
+        assert(graph->getEdgeCount() == listGraph->getEdgeCount());
+        for (int i = 0; i < listGraph->getVertexCount(); ++i) {
+            for (int j = 0; j < listGraph->getVertexCount(); ++j) {
+                assert(graph->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+            }
+        }
+        delete graph;
+    }
+    delete listGraph;
+}
+
+void GraphBuilderTest::assertSameGraphs(const IGraph &graph, const IGraph &expectedGraph) {
+    assert(graph.getGraphType() == expectedGraph.getGraphType());
+    assert(graph.getVertexCount() == expectedGraph.getVertexCount());
+    assert(graph.getEdgeCount() == expectedGraph.getEdgeCount());
+    for (int i = 0; i < expectedGraph.getVertexCount(); ++i) {
+        for (int j = 0; j < expectedGraph.getVertexCount(); ++j) {
+            assert(graph.getEdgeParameter(i, j) == expectedGraph.getEdgeParameter(i, j));
+        }
+        auto successors = graph.getSuccessorsView(i), expectedSuccessors = expectedGraph.getSuccessorsView(i);
+        auto predecessors = graph.getPredecessorsView(i), expectedPredecessors = expectedGraph.getPredecessorsView(i);
+        assert(successors.getSize() == expectedSuccessors.getSize());
+        assert(predecessors.getSize() == expectedPredecessors.getSize());
+        for (int k = 0; k < expectedSuccessors.getSize(); ++k) {
+            assert(successors[k] == expectedSuccessors[k]);
+        }
+        for (int k = 0; k < expectedPredecessors.getSize(); ++k) {
+            assert(predecessors[k] == expectedPredecessors[k]);
+        }
+    }
+}
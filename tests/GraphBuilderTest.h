@@ -0,0 +1,43 @@
+#ifndef PEA_P1_GRAPHBUILDERTEST_H
+#define PEA_P1_GRAPHBUILDERTEST_H
+
+
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../structures/graphs/GraphBuilder.h"
+#include "../utilities/TSPUtils.h"
+
+using std::cout;
+using std::endl;
+
+class GraphBuilderTest {
+public:
+    void run();
+
+private:
+    // Graphs built from a matrix with missing edges equal graphs built with addEdge()
+    void testBuildFromCostMatrix();
+
+    // Graphs built from an edge array equal graphs built with addEdge(), for every edge-based structure
+    void testBuildFromEdges();
+
+    // Invalid vertex's index, loop and multiple edge (reversed pair of undirected edge too) throw
+    void testInvalidEdges();
+
+    // ListGraph and MatrixGraph built from each other keep every edge once
+    void testConversions();
+
+    // Every structure of a loaded instance has the same costs as AdjacencyList
+    void testLoadTSPInstance(const std::string &instanceFile, TSPUtils::TSPType tspType);
+
+    // Same vertex and edge counts, edge parameters and successors, in the same order
+    static void assertSameGraphs(const IGraph &graph, const IGraph &expectedGraph);
+};
+
+#endif //PEA_P1_GRAPHBUILDERTEST_H
@@ -0,0 +1,214 @@
+#include "InstanceParserTest.h"
+
+#define pStartInfo(method) cout << "##### InstanceParserTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% InstanceParserTest::" << (method) << "() end %%%%%" << endl << endl
+
+void InstanceParserTest::run() {
+    pStartInfo("testReadToken");
+    testReadToken();
+    pEndInfo("testReadToken");
+
+    pStartInfo("testParseIntegers");
+    testParseIntegers();
+    pEndInfo("testParseIntegers");
+
+    pStartInfo("testCountIntegers");
+    testCountIntegers();
+    pEndInfo("testCountIntegers");
+
+    pStartInfo("testParseIntegersParallel");
+    testParseIntegersParallel(1);
+    testParseIntegersParallel(3);
+    testParseIntegersParallel(8);
+    pEndInfo("testParseIntegersParallel");
+
+    pStartInfo("testMinusAfterDigits");
+    testMinusAfterDigits();
+    pEndInfo("testMinusAfterDigits");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("ATSP/data443.txt");
+    testLoadTSPInstance("TSP/data120.txt");
+    testLoadTSPInstance("MIE/tsp_6_1.txt");
+    testLoadTSPInstance("SMALL/data10.txt");
+    pEndInfo("testLoadTSPInstance");
+}
+
+void InstanceParserTest::testReadToken() {
+    const std::string contents = " \n rbg443.atsp\n443";
+    std::string token;
+    const char *position = InstanceParser::readToken(contents.data(), contents.data() + contents.size(), token);
+    assert(token == "rbg443.atsp");
+    assert(*position == '\n');
+    int nVertex;
+    InstanceParser::parseIntegers(position, contents.data() + contents.size(), &nVertex, 1);
+    assert(nVertex == 443);
+}
+
+void InstanceParserTest::testParseIntegers() {
+    const std::string contents = "  -1 12\n0\t\t345\r\n2147483647 -2147483648";
+    const char *end = contents.data() + contents.size();
+    int values[6];
+    const char *position = InstanceParser::parseIntegers(contents.data(), end, values, 6);
+    assert(position == end);
+    assert(values[0] == -1 && values[1] == 12 && values[2] == 0 && values[3] == 345);
+    assert(values[4] == std::numeric_limits<int>::max() && values[5] == std::numeric_limits<int>::min());
+
+    bool hasThrown = false;
+    try {
+        int moreValues[7];
+        InstanceParser::parseIntegers(contents.data(), end, moreValues, 7);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    const std::string tooLarge = "1 2147483648";
+    hasThrown = false;
+    try {
+        InstanceParser::parseIntegers(tooLarge.data(), tooLarge.data() + tooLarge.size(), values, 2);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void InstanceParserTest::testCountIntegers() {
+    std::string contents;
+    for (int k = 0; k < 200; ++k) {
+        contents += std::string(k % 7, ' ') + std::to_string(k * 1013 - 5000) + ((k % 3 == 0) ? "\n" : " ");
+    }
+    assert(InstanceParser::countIntegers(contents.data(), contents.data() + contents.size()) == 200);
+    // Every suffix and prefix, so that block boundaries fall inside and between integers
+    for (std::size_t cut = 0; cut < 64; ++cut) {
+        std::istringstream suffixStream(contents.substr(cut));
+        std::size_t expectedCount = 0;
+        std::string token;
+        while (suffixStream >> token) {
+            ++expectedCount;
+        }
+        assert(InstanceParser::countIntegers(contents.data() + cut, contents.data() + contents.size()) ==
+               expectedCount);
+    }
+}
+
+void InstanceParserTest::testParseIntegersParallel(unsigned int nThreads) {
+    cout << "Threads: " << nThreads << "...";
+    // Several times PARALLEL_THRESHOLD, so that the range is split into chunks
+    std::string contents;
+    std::vector<int> expectedValues;
+    while (contents.size() < 4 * InstanceParser::PARALLEL_THRESHOLD) {
+        expectedValues.push_back(Random::getInt(-100'000, 100'000));
+        contents += std::string(Random::getInt(1, 4), ' ') + std::to_string(expectedValues.back());
+        if (Random::getBool(true, 0.05)) {
+            contents += '\n';
+        }
+    }
+    const char *end = contents.data() + contents.size();
+
+    std::vector<int> values(expectedValues.size());
+    InstanceParser::parseIntegersParallel(contents.data(), end, values.data(), values.size(), nThreads);
+    assert(values == expectedValues);
+
+    // Fewer integers than present - the rest is ignored
+    std::vector<int> firstValues(expectedValues.size() / 2);
+    InstanceParser::parseIntegersParallel(contents.data(), end, firstValues.data(), firstValues.size(), nThreads);
+    assert(std::equal(firstValues.begin(), firstValues.end(), expectedValues.begin()));
+
+    bool hasThrown = false;
+    try {
+        std::vector<int> moreValues(expectedValues.size() + 1);
+        InstanceParser::parseIntegersParallel(contents.data(), end, moreValues.data(), moreValues.size(), nThreads);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+    cout << "SUCCESS" << endl;
+}
+
+void InstanceParserTest::testMinusAfterDigits() {
+    const std::string token = "12-34 5";
+    const std::vector<int> tokenValues = {12, -34, 5};
+    // Token is moved through the first blocks, so that it is parsed by the block loop and by the scalar tail
+    for (std::size_t padding = 0; padding < 64; ++padding) {
+        const std::string contents = std::string(padding, ' ') + token + std::string(64 - padding, ' ') + "7";
+        const char *end = contents.data() + contents.size();
+        assert(InstanceParser::countIntegers(contents.data(), end) == 4);
+        int values[4];
+        const char *position = InstanceParser::parseIntegers(contents.data(), end, values, 4);
+        assert(position == end);
+        assert(values[0] == 12 && values[1] == -34 && values[2] == 5 && values[3] == 7);
+        // Integers of the token only - parsing stops within the block
+        assert(InstanceParser::parseIntegers(contents.data(), end, values, 2) ==
+               contents.data() + padding + token.find(' '));
+        assert(values[0] == 12 && values[1] == -34);
+    }
+
+    // Tokens fill the whole range, so that boundaries of parallel chunks fall next to them
+    std::string contents;
+    std::vector<int> expectedValues;
+    while (contents.size() < 4 * InstanceParser::PARALLEL_THRESHOLD) {
+        contents += token + '\n';
+        expectedValues.insert(expectedValues.end(), tokenValues.begin(), tokenValues.end());
+    }
+    const char *end = contents.data() + contents.size();
+    assert(InstanceParser::countIntegers(contents.data(), end) == expectedValues.size());
+    for (unsigned int nThreads : {1u, 3u, 8u}) {
+        std::vector<int> values(expectedValues.size());
+        InstanceParser::parseIntegersParallel(contents.data(), end, values.data(), values.size(), nThreads);
+        assert(values == expectedValues);
+    }
+
+    // '-' not followed by digits
+    for (const char *malformed : {"1--2", "1 - 2", "3-"}) {
+        bool hasThrown = false;
+        try {
+            int values[3];
+            InstanceParser::parseIntegers(malformed, malformed + std::strlen(malformed), values, 3);
+        } catch (const std::invalid_argument &e) {
+            hasThrown = true;
+        }
+        assert(hasThrown);
+    }
+}
+
+void InstanceParserTest::testLoadTSPInstance(const std::string &instanceFile) {
+    cout << "Instance \"" << instanceFile << "\"...";
+    std::ifstream file("../input_data/" + instanceFile);
+    if (!file.is_open()) {
+        cout << "FAIL [File ../input_data/" << instanceFile << " cannot be opened]" << endl;
+        return;
+    }
+    std::string instanceName;
+    int nVertex = 0;
+    file >> instanceName >> nVertex;
+    std::vector<int> expectedCosts(static_cast<std::size_t>(nVertex) * nVertex);
+    for (auto &cost : expectedCosts) {
+        file >> cost;
+    }
+
+    IGraph *distanceMatrix = nullptr;
+    std::string loadedName = TSPUtils::loadTSPInstance(&distanceMatrix, instanceFile, TSPUtils::TSPType::Asymmetric,
+                                                       IGraph::GraphStructure::FlatMatrix);
+    assert(loadedName == instanceName);
+    assert(distanceMatrix->getVertexCount() == nVertex);
+    assert(distanceMatrix->getEdgeCount() == nVertex * (nVertex - 1));
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            if (i != j) {
+                assert(distanceMatrix->getEdgeParameter(i, j) ==
+                       expectedCosts[static_cast<std::size_t>(i) * nVertex + j]);
+            }
+        }
+    }
+    delete distanceMatrix;
+
+    bool hasThrown = false;
+    try {
+        TSPUtils::loadTSPInstance(&distanceMatrix, instanceFile + ".missing", TSPUtils::TSPType::Asymmetric);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+    cout << "SUCCESS" << endl;
+}
@@ -0,0 +1,43 @@
+#ifndef PEA_P1_INSTANCEPARSERTEST_H
+#define PEA_P1_INSTANCEPARSERTEST_H
+
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../utilities/InstanceParser.h"
+#include "../utilities/MappedFile.h"
+#include "../utilities/TSPUtils.h"
+#include "../utilities/Random.h"
+
+using std::cout;
+using std::endl;
+
+class InstanceParserTest {
+public:
+    void run();
+
+private:
+    void testReadToken();
+    void testParseIntegers();
+
+    // Integers crossing 16-byte blocks are counted once
+    void testCountIntegers();
+
+    // Results are the same for any number of threads
+    void testParseIntegersParallel(unsigned int nThreads);
+
+    // '-' right after digits starts a new integer wherever it is - in a 16-byte block, in the scalar tail
+    // and next to a boundary of parallel chunks
+    void testMinusAfterDigits();
+
+    // Every cost of DistanceMatrix loaded from instanceFile is compared with the file read by std::fstream
+    void testLoadTSPInstance(const std::string &instanceFile);
+};
+
+#endif //PEA_P1_INSTANCEPARSERTEST_H
@@ -0,0 +1,131 @@
+#include "InstanceRegistryTest.h"
+
+#define pStartInfo(method) cout << "##### InstanceRegistryTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% InstanceRegistryTest::" << (method) << "() end %%%%%" << endl << endl
+
+void InstanceRegistryTest::run() {
+    pStartInfo("testSharing");
+    testSharing();
+    pEndInfo("testSharing");
+
+    pStartInfo("testEviction");
+    testEviction();
+    pEndInfo("testEviction");
+
+    pStartInfo("testConcurrentAccess");
+    testConcurrentAccess();
+    pEndInfo("testConcurrentAccess");
+
+    pStartInfo("testFailedLoad");
+    testFailedLoad();
+    pEndInfo("testFailedLoad");
+}
+
+void InstanceRegistryTest::testSharing() {
+    InstanceRegistry registry;
+    TSPUtils::TSPType tspType = TSPUtils::Symmetric;
+    auto first = registry.get("SMALL/data10.txt", IGraph::GraphStructure::AdjacencyList, &tspType);
+    auto second = registry.get("SMALL/data10.txt");
+    assert(first != nullptr && first == second);
+    assert(first->getVertexCount() == 10);
+    assert(first->getGraphStructure() == IGraph::GraphStructure::AdjacencyList);
+    assert(tspType == TSPUtils::getTSPType("SMALL/data10.txt"));
+    assert(registry.getInstanceCount() == 1);
+    assert(registry.getMemoryUsage() == InstanceRegistry::estimateMemoryUsage(*first));
+
+    auto flat = registry.get("SMALL/data10.txt", IGraph::GraphStructure::FlatMatrix);
+    assert(flat != first && flat->getGraphStructure() == IGraph::GraphStructure::FlatMatrix);
+    assert(registry.getInstanceCount() == 2);
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            assert(flat->getEdgeParameter(i, j) == first->getEdgeParameter(i, j));
+        }
+    }
+    assert(InstanceRegistry::estimateMemoryUsage(*flat) == 10 * 10 * sizeof(int));
+
+    registry.clear();
+    assert(registry.getInstanceCount() == 0 && registry.getMemoryUsage() == 0);
+    // Graphs handed out outlive the registry's reference
+    assert(first.use_count() == 2 && first->getVertexCount() == 10);
+}
+
+void InstanceRegistryTest::testEviction() {
+    const auto structure = IGraph::GraphStructure::FlatMatrix;
+    // Room for data10 with data11 or data12, not for all three
+    InstanceRegistry registry((10 * 10 + 12 * 12) * sizeof(int));
+
+    auto data10 = registry.get("SMALL/data10.txt", structure);
+    std::weak_ptr<const IGraph> data11 = registry.get("SMALL/data11.txt", structure);
+    assert(registry.getInstanceCount() == 2);
+    // data10 is used again, so data11 is the least recently used one
+    assert(registry.get("SMALL/data10.txt", structure) == data10);
+
+    auto data12 = registry.get("SMALL/data12.txt", structure);
+    assert(registry.getInstanceCount() == 2);
+    assert(registry.getMemoryUsage() == (10 * 10 + 12 * 12) * sizeof(int));
+    assert(registry.getMemoryUsage() <= registry.getMemoryBudget());
+    // Nobody held data11, so it is freed
+    assert(data11.expired());
+    assert(registry.get("SMALL/data10.txt", structure) == data10);
+
+    // Instance alone over the budget is kept until the next one comes
+    registry.setMemoryBudget(sizeof(int));
+    assert(registry.getInstanceCount() == 0 && registry.getMemoryUsage() == 0);
+    assert(data10->getVertexCount() == 10 && data12->getVertexCount() == 12);
+    auto data13 = registry.get("SMALL/data13.txt", structure);
+    assert(registry.getInstanceCount() == 1);
+    assert(registry.get("SMALL/data13.txt", structure) == data13);
+    auto data14 = registry.get("SMALL/data14.txt", structure);
+    assert(registry.getInstanceCount() == 1 && data14->getVertexCount() == 14);
+    assert(registry.get("SMALL/data13.txt", structure) != data13);
+
+    registry.setMemoryBudget(0);
+    assert(registry.getMemoryBudget() == 0);
+    data10 = registry.get("SMALL/data10.txt", structure);
+    auto data11Reloaded = registry.get("SMALL/data11.txt", structure);
+    assert(registry.getInstanceCount() == 3 && data11Reloaded->getVertexCount() == 11);
+}
+
+void InstanceRegistryTest::testConcurrentAccess() {
+    // Without binary caches the first loads parse the text and write the caches concurrently
+    std::error_code errorCode;
+    std::filesystem::remove("../input_data/SMALL/data15.txt.bin", errorCode);
+    std::filesystem::remove("../input_data/SMALL/data16.txt.bin", errorCode);
+
+    InstanceRegistry registry;
+    const int nThreads = 8;
+    std::vector<std::shared_ptr<const IGraph>> graphs(nThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nThreads; ++i) {
+        threads.emplace_back([&registry, &graphs, i]() {
+            const std::string path = (i % 2 == 0) ? "SMALL/data15.txt" : "SMALL/data16.txt";
+            graphs[i] = registry.get(path, IGraph::GraphStructure::FlatMatrix);
+            // Readers share the graph
+            int sum = 0;
+            for (int v = 0; v < graphs[i]->getVertexCount(); ++v) {
+                sum += graphs[i]->getEdgeParameter(v, (v + 1) % graphs[i]->getVertexCount());
+            }
+            assert(sum > 0);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    assert(registry.getInstanceCount() == 2);
+    for (int i = 2; i < nThreads; ++i) {
+        assert(graphs[i] == graphs[i % 2]);
+    }
+    assert(graphs[0]->getVertexCount() == 15 && graphs[1]->getVertexCount() == 16);
+}
+
+void InstanceRegistryTest::testFailedLoad() {
+    InstanceRegistry registry;
+    bool hasThrown = false;
+    try {
+        auto graph = registry.get("SMALL/missing_instance.txt");
+    } catch (const std::exception &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+    assert(registry.getInstanceCount() == 0 && registry.getMemoryUsage() == 0);
+}
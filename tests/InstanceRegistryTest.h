@@ -0,0 +1,37 @@
+#ifndef PEA_P1_INSTANCEREGISTRYTEST_H
+#define PEA_P1_INSTANCEREGISTRYTEST_H
+
+
+#include <cassert>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "../utilities/InstanceRegistry.h"
+
+using std::cout;
+using std::endl;
+
+class InstanceRegistryTest {
+public:
+    void run();
+
+private:
+    // Repeated requests return the same graph, other structure is a separate instance
+    void testSharing();
+
+    // Least recently used instances are dropped over the budget, graphs handed out stay valid
+    void testEviction();
+
+    // Concurrent first requests load the instance once
+    void testConcurrentAccess();
+
+    void testFailedLoad();
+};
+
+#endif //PEA_P1_INSTANCEREGISTRYTEST_H
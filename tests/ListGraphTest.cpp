@@ -26,6 +26,10 @@ void ListGraphTest::run() {
     testGetVertexPredecessors();
     pEndInfo("testGetVertexPredecessors");
 
+    pStartInfo("testViews");
+    testViews();
+    pEndInfo("testViews");
+
     pStartInfo("testGetEdgeParameter");
     testGetEdgeParameter();
     pEndInfo("testGetEdgeParameter");
@@ -233,6 +237,47 @@ void ListGraphTest::testGetVertexPredecessors() {
     cout << lgud << endl;
 }
 
+void ListGraphTest::testViews() {
+    ListGraph lgd(ListGraph::GraphType::Directed,
+    5);
+    lgd.addEdge(0, 3, 5);
+    lgd.addEdge(3, 0, 10);
+    lgd.addEdge(0, 1, 15);
+    lgd.addEdge(2, 4, 20);
+    lgd.addEdge(0, 4, 25);
+    auto successors = lgd.getSuccessorsView(0);
+    assert(!successors.isOwning());
+    assert(successors.getSize() == 3);
+    assert(successors[0] == 3 && successors[1] == 1 && successors[2] == 4);
+    auto predecessors = lgd.getPredecessorsView(4);
+    assert(!predecessors.isOwning());
+    assert(predecessors.getSize() == 2);
+    assert(predecessors[0] == 2 && predecessors[1] == 0);
+    auto costRow = lgd.getCostRowView(0);
+    assert(costRow.getSize() == 5);
+    assert(costRow[0] == std::numeric_limits<int>::max() && costRow[1] == 15 && costRow[4] == 25);
+    // Reverse index follows removals
+    lgd.removeEdge(0, 4);
+    assert(lgd.getPredecessorsView(4).getSize() == 1 && lgd.getPredecessorsView(4)[0] == 2);
+    assert(lgd.getVertexPredecessors(4).getSize() == 1);
+    assert(lgd.getPredecessorsView(0).getSize() == 1 && lgd.getPredecessorsView(0)[0] == 3);
+    int sum = 0;
+    for (int successor: lgd.getSuccessorsView(0)) {
+        sum += successor;
+    }
+    assert(sum == 4);
+
+    ListGraph lgud(ListGraph::GraphType::Undirected,
+    5);
+    lgud.addEdge(0, 3, 5);
+    lgud.addEdge(3, 2, 10);
+    lgud.addEdge(0, 1, 15);
+    assert(lgud.getSuccessorsView(3).getSize() == 2);
+    assert(lgud.getPredecessorsView(3).getData() == lgud.getSuccessorsView(3).getData());
+    lgud.removeEdge(2, 3);
+    assert(lgud.getSuccessorsView(3).getSize() == 1 && lgud.getSuccessorsView(2).isEmpty());
+}
+
 void ListGraphTest::testGetEdgeParameter() {
     ListGraph lgd(ListGraph::GraphType::Directed,
     5);
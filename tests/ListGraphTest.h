@@ -20,6 +20,7 @@ private:
     void testRemoveEdge();
     void testGetVertexSuccessors();
     void testGetVertexPredecessors();
+    void testViews();
     void testGetEdgeParameter();
     void testGetVertexCount();
     void testGetEdgeCount();
@@ -0,0 +1,203 @@
+#include "MappedMatrixTest.h"
+
+#define pStartInfo(method) cout << "##### MappedMatrixTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% MappedMatrixTest::" << (method) << "() end %%%%%" << endl << endl
+
+void MappedMatrixTest::run() {
+    testDirectory = std::filesystem::temp_directory_path() / "pea_p1_mapped_matrix_test";
+    std::filesystem::remove_all(testDirectory);
+    std::filesystem::create_directories(testDirectory);
+
+    pStartInfo("testCostWidths");
+    testCostWidths();
+    pEndInfo("testCostWidths");
+
+    pStartInfo("testReadOnly");
+    testReadOnly();
+    pEndInfo("testReadOnly");
+
+    pStartInfo("testInvalidFiles");
+    testInvalidFiles();
+    pEndInfo("testInvalidFiles");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("ATSP/data443.txt");
+    testLoadTSPInstance("TSP/data120.txt");
+    pEndInfo("testLoadTSPInstance");
+
+    std::filesystem::remove_all(testDirectory);
+}
+
+void MappedMatrixTest::testCostWidths() {
+    const BinaryInstance::SourceStamp stamp{1, 2};
+    // Ranges needing 1, 2 and 4 bytes per cost, the diagonal as in text files
+    const int nVertex = 5;
+    const std::vector<int> widthMaxima = {200, 60'000, 2'000'000'000};
+    for (int width = 0; width < 3; ++width) {
+        std::vector<int> costMatrix(nVertex * nVertex);
+        for (int i = 0; i < nVertex; ++i) {
+            for (int j = 0; j < nVertex; ++j) {
+                costMatrix[i * nVertex + j] = (i == j) ? -1 : (widthMaxima[width] / (i * nVertex + j + 1));
+            }
+        }
+        const std::string path = (testDirectory / "matrix.bin").string();
+        const bool isWritten = BinaryInstance::write(path, "widths", nVertex, costMatrix.data(), stamp);
+        assert(isWritten);
+
+        MappedMatrix matrix(IGraph::GraphType::Directed, path, MappedFile::AccessPattern::Random, true);
+        assert(matrix.getCostWidth() == (width == 0 ? 1 : width == 1 ? 2 : 4));
+        assert(matrix.getInstanceName() == "widths");
+        assert(matrix.getVertexCount() == nVertex);
+        assert(matrix.getEdgeCount() == nVertex * (nVertex - 1) && matrix.getDensity() == 1.0);
+        assert(matrix.getGraphStructure() == IGraph::GraphStructure::MappedFlatMatrix);
+        std::vector<int> row(nVertex);
+        for (int i = 0; i < nVertex; ++i) {
+            matrix.readCostRow(i, row.data());
+            auto rowView = matrix.getCostRowView(i);
+            for (int j = 0; j < nVertex; ++j) {
+                const int expectedCost = (i == j) ? std::numeric_limits<int>::max() : costMatrix[i * nVertex + j];
+                assert(matrix.getCost(i, j) == expectedCost && matrix.getEdgeParameter(i, j) == expectedCost);
+                assert(row[j] == expectedCost && rowView[j] == expectedCost);
+            }
+            assert(matrix.getSuccessorsView(i).getSize() == nVertex - 1);
+            assert(matrix.getVertexPredecessors(i).getSize() == nVertex - 1);
+        }
+        // Hints change paging only
+        matrix.setAccessPattern(MappedFile::AccessPattern::Sequential);
+        assert(matrix.getAccessPattern() == MappedFile::AccessPattern::Sequential);
+        assert(matrix.getCost(nVertex - 1, 0) == costMatrix[(nVertex - 1) * nVertex]);
+    }
+}
+
+void MappedMatrixTest::testReadOnly() {
+    const std::vector<int> costMatrix = {-1, 3, 3, -1};
+    const std::string path = (testDirectory / "read_only.bin").string();
+    const bool isWritten = BinaryInstance::write(path, "readOnly", 2, costMatrix.data(), {1, 2});
+    assert(isWritten);
+    MappedMatrix matrix(IGraph::GraphType::Undirected, path);
+    assert(matrix.getEdgeCount() == 1);
+    cout << matrix << endl;
+
+    int nThrown = 0;
+    try {
+        matrix.setEdgeParameter(0, 1, 7);
+    } catch (const std::logic_error &e) {
+        ++nThrown;
+    }
+    try {
+        matrix.addEdge(0, 1, 7);
+    } catch (const std::logic_error &e) {
+        ++nThrown;
+    }
+    try {
+        matrix.removeEdge(0, 1);
+    } catch (const std::logic_error &e) {
+        ++nThrown;
+    }
+    assert(nThrown == 3 && matrix.getCost(0, 1) == 3);
+}
+
+void MappedMatrixTest::testInvalidFiles() {
+    const std::string textPath = (testDirectory / "text.txt").string();
+    {
+        std::ofstream file(textPath, std::ios::trunc);
+        file << "text3\n3\n-1 1 2\n3 -1 4\n5 6 -1\n";
+    }
+    bool hasThrown = false;
+    try {
+        MappedMatrix matrix(IGraph::GraphType::Directed, textPath);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    // Asymmetric costs cannot form Undirected graph
+    const std::vector<int> costMatrix = {-1, 1, 2, 3, -1, 4, 5, 6, -1};
+    const std::string path = (testDirectory / "asymmetric.bin").string();
+    const bool isWritten = BinaryInstance::write(path, "asymmetric", 3, costMatrix.data(), {1, 2});
+    assert(isWritten);
+    hasThrown = false;
+    try {
+        MappedMatrix matrix(IGraph::GraphType::Undirected, path);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    // Damaged cost is noticed only with verifyChecksum
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put('\x7F');
+    }
+    MappedMatrix uncheckedMatrix(IGraph::GraphType::Directed, path);
+    assert(uncheckedMatrix.getCost(0, 1) == 1);
+    hasThrown = false;
+    try {
+        MappedMatrix matrix(IGraph::GraphType::Directed, path, MappedFile::AccessPattern::Random, true);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void MappedMatrixTest::testLoadTSPInstance(const std::string &instanceFile) {
+    // Text file is copied, so that the binary file is written in the test directory
+    const std::filesystem::path textPath = testDirectory / std::filesystem::path(instanceFile).filename();
+    std::filesystem::copy_file("../input_data/" + instanceFile, textPath,
+                               std::filesystem::copy_options::overwrite_existing);
+
+    IGraph *matrixInstance = nullptr, *mappedInstance = nullptr;
+    TSPUtils::TSPType tspType;
+    const std::string mappedName = TSPUtils::loadTSPInstanceDetectTypeAbsolutePath(
+            &mappedInstance, textPath.string(), tspType, IGraph::GraphStructure::MappedFlatMatrix);
+    assert(std::filesystem::exists(textPath.string() + ".bin"));
+    const std::string matrixName = TSPUtils::loadTSPInstanceAbsolutePath(&matrixInstance, textPath.string(),
+                                                                         tspType, IGraph::GraphStructure::FlatMatrix);
+    assert(mappedName == matrixName);
+    assert(tspType == TSPUtils::getTSPTypeAbsolutePath(textPath.string()));
+    assert(mappedInstance->getGraphStructure() == IGraph::GraphStructure::MappedFlatMatrix);
+    assert(mappedInstance->getGraphType() == matrixInstance->getGraphType());
+    assert(mappedInstance->getEdgeCount() == matrixInstance->getEdgeCount());
+
+    const int nVertex = matrixInstance->getVertexCount();
+    assert(mappedInstance->getVertexCount() == nVertex);
+    for (int i = 0; i < nVertex; ++i) {
+        auto mappedRow = mappedInstance->getCostRowView(i);
+        auto matrixRow = matrixInstance->getCostRowView(i);
+        for (int j = 0; j < nVertex; ++j) {
+            assert(mappedInstance->getEdgeParameter(i, j) == matrixInstance->getEdgeParameter(i, j));
+            assert(mappedRow[j] == matrixRow[j]);
+        }
+    }
+
+    // Algorithms run unchanged
+    std::vector<int> matrixSolution, mappedSolution;
+    const int matrixValue = TSPGreedyAlgorithms::nearestNeighbour(matrixInstance, matrixSolution);
+    const int mappedValue = TSPGreedyAlgorithms::nearestNeighbour(mappedInstance, mappedSolution);
+    assert(mappedValue == matrixValue && mappedSolution == matrixSolution);
+    matrixSolution.clear();
+    mappedSolution.clear();
+    const int matrixGreedyValue = TSPGreedyAlgorithms::greedy(matrixInstance, matrixSolution);
+    const int mappedGreedyValue = TSPGreedyAlgorithms::greedy(mappedInstance, mappedSolution);
+    assert(mappedGreedyValue == matrixGreedyValue);
+
+    LocalSearchParameters parameters;
+    parameters.setSimulatedAnnealingDefaultParameters();
+    parameters.iterationsNumber = 50;
+    mappedSolution.clear();
+    const int annealingValue = TSPLocalSearchAlgorithms::simulatedAnnealing(mappedInstance, parameters,
+                                                                            mappedSolution);
+    assert(TSPUtils::isSolutionValid(mappedInstance, mappedSolution, annealingValue));
+    assert(TSPUtils::isSolutionValid(matrixInstance, mappedSolution, annealingValue));
+
+    // Type given explicitly is kept as with other structures
+    IGraph *directedInstance = nullptr;
+    TSPUtils::loadTSPInstanceAbsolutePath(&directedInstance, textPath.string(), TSPUtils::TSPType::Asymmetric,
+                                          IGraph::GraphStructure::MappedFlatMatrix);
+    assert(directedInstance->getGraphType() == IGraph::GraphType::Directed);
+
+    delete matrixInstance;
+    delete mappedInstance;
+    delete directedInstance;
+}
@@ -0,0 +1,41 @@
+#ifndef PEA_P1_MAPPEDMATRIXTEST_H
+#define PEA_P1_MAPPEDMATRIXTEST_H
+
+
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../structures/graphs/MappedMatrix.h"
+#include "../algorithms/TSPGreedyAlgorithms.h"
+#include "../algorithms/TSPLocalSearchAlgorithms.h"
+#include "../utilities/TSPUtils.h"
+
+using std::cout;
+using std::endl;
+
+// Files are written to a directory in the system's temporary directory, removed afterwards
+class MappedMatrixTest {
+public:
+    void run();
+
+private:
+    // Costs of every width are read in place, the diagonal reads as no edge
+    void testCostWidths();
+
+    void testReadOnly();
+
+    // Not a binary instance, damaged file and asymmetric costs as Undirected graph
+    void testInvalidFiles();
+
+    // Compares every edge parameter and solutions of algorithms with DistanceMatrix loaded from the same file
+    void testLoadTSPInstance(const std::string &instanceFile);
+
+    std::filesystem::path testDirectory;
+};
+
+#endif //PEA_P1_MAPPEDMATRIXTEST_H
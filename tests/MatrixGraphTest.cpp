@@ -69,16 +69,14 @@ void MatrixGraphTest::run() {
 
 void MatrixGraphTest::testMatrixGraph() {
     MatrixGraph mgd(MatrixGraph::GraphType::Directed, 5);
-    assert(mgd.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i)
-        assert(mgd.incidenceMatrix[i].getSize() == 0);
+    assert(mgd.getVertexCount() == 5);
+    assert(mgd.edgeStarts.getSize() == 0 && mgd.edgeEnds.getSize() == 0);
     assert(mgd.edgeParameters.getSize() == 0);
     cout << directed << mgd << endl;
 
     MatrixGraph mgud(MatrixGraph::GraphType::Undirected, 10);
-    assert(mgud.incidenceMatrix.getSize() == 10);
-    for (int i = 0; i < 10; ++i)
-        assert(mgud.incidenceMatrix[i].getSize() == 0);
+    assert(mgud.getVertexCount() == 10);
+    assert(mgud.edgeStarts.getSize() == 0 && mgud.edgeEnds.getSize() == 0);
     assert(mgud.edgeParameters.getSize() == 0);
     cout << undirected << mgud << endl;
 }
@@ -86,35 +84,31 @@ void MatrixGraphTest::testMatrixGraph() {
 void MatrixGraphTest::testAddEdge() {
     MatrixGraph mgd(MatrixGraph::GraphType::Directed, 5);
     mgd.addEdge(0, 1, 10);
-    assert(mgd.incidenceMatrix[0][0] == 1);
-    assert(mgd.incidenceMatrix[1][0] == -1);
+    assert(mgd.getIncidence(0, 0) == 1);
+    assert(mgd.getIncidence(1, 0) == -1);
     mgd.addEdge(2, 1, 11);
-    assert(mgd.incidenceMatrix[2][1] == 1);
-    assert(mgd.incidenceMatrix[1][1] == -1);
+    assert(mgd.getIncidence(2, 1) == 1);
+    assert(mgd.getIncidence(1, 1) == -1);
     mgd.addEdge(2, 3, 12);
     mgd.addEdge(3, 4, 13);
 
-    assert(mgd.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgd.incidenceMatrix[i].getSize() == 4);
-    }
+    assert(mgd.getVertexCount() == 5);
+    assert(mgd.edgeStarts.getSize() == 4 && mgd.edgeEnds.getSize() == 4);
     assert(mgd.edgeParameters.getSize() == 4);
     cout << directed << mgd << endl;
 
     MatrixGraph mgud(MatrixGraph::GraphType::Undirected, 5);
     mgud.addEdge(0, 1, 10);
-    assert(mgud.incidenceMatrix[0][0] == 1);
-    assert(mgud.incidenceMatrix[1][0] == 1);
+    assert(mgud.getIncidence(0, 0) == 1);
+    assert(mgud.getIncidence(1, 0) == 1);
     mgud.addEdge(2, 1, 11);
-    assert(mgud.incidenceMatrix[2][1] == 1);
-    assert(mgud.incidenceMatrix[1][1] == 1);
+    assert(mgud.getIncidence(2, 1) == 1);
+    assert(mgud.getIncidence(1, 1) == 1);
     mgud.addEdge(2, 3, 12);
     mgud.addEdge(3, 4, 13);
 
-    assert(mgud.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgud.incidenceMatrix[i].getSize() == 4);
-    }
+    assert(mgud.getVertexCount() == 5);
+    assert(mgud.edgeStarts.getSize() == 4 && mgud.edgeEnds.getSize() == 4);
     assert(mgud.edgeParameters.getSize() == 4);
     cout << undirected << mgud << endl;
 }
@@ -128,18 +122,20 @@ void MatrixGraphTest::testRemoveEdge() {
     cout << directed << mgd << endl;
 
     mgd.removeEdge(0);
-    assert(mgd.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgd.incidenceMatrix[i].getSize() == 3);
-    }
+    assert(mgd.getVertexCount() == 5);
+    assert(mgd.edgeStarts.getSize() == 3 && mgd.edgeEnds.getSize() == 3);
     assert(mgd.edgeParameters.getSize() == 3);
+    // IDs of following edges are shifted down
+    assert(mgd.getEdgeIdFromVertexes(0, 1) == MatrixGraph::EDGE_NOT_PRESENT);
+    assert(mgd.getEdgeIdFromVertexes(2, 1) == 0 && mgd.getEdgeIdFromVertexes(3, 4) == 2);
+    assert(mgd.getEdgeParameter(2) == 13);
+    assert(mgd.getVertexSuccessors(2).getSize() == 2 && mgd.getVertexPredecessors(1).getSize() == 1);
+    assert(mgd.getIncidence(2, 0) == 1 && mgd.getIncidence(1, 0) == -1);
     cout << directed << mgd << endl;
 
     mgd.removeEdge(2);
-    assert(mgd.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgd.incidenceMatrix[i].getSize() == 2);
-    }
+    assert(mgd.getVertexCount() == 5);
+    assert(mgd.edgeStarts.getSize() == 2 && mgd.edgeEnds.getSize() == 2);
     assert(mgd.edgeParameters.getSize() == 2);
     cout << directed << mgd << endl;
 
@@ -151,18 +147,14 @@ void MatrixGraphTest::testRemoveEdge() {
     cout << undirected << mgud << endl;
 
     mgud.removeEdge(0);
-    assert(mgud.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgud.incidenceMatrix[i].getSize() == 3);
-    }
+    assert(mgud.getVertexCount() == 5);
+    assert(mgud.edgeStarts.getSize() == 3 && mgud.edgeEnds.getSize() == 3);
     assert(mgud.edgeParameters.getSize() == 3);
     cout << undirected << mgud << endl;
 
     mgud.removeEdge(2);
-    assert(mgud.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgud.incidenceMatrix[i].getSize() == 2);
-    }
+    assert(mgud.getVertexCount() == 5);
+    assert(mgud.edgeStarts.getSize() == 2 && mgud.edgeEnds.getSize() == 2);
     assert(mgud.edgeParameters.getSize() == 2);
     cout << undirected << mgud << endl;
 }
@@ -177,26 +169,20 @@ void MatrixGraphTest::testRemoveEdge_vertexID() {
     cout << directed << mgd << endl;
 
     mgd.removeEdge(0, 1);
-    assert(mgd.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgd.incidenceMatrix[i].getSize() == 4);
-    }
+    assert(mgd.getVertexCount() == 5);
+    assert(mgd.edgeStarts.getSize() == 4 && mgd.edgeEnds.getSize() == 4);
     assert(mgd.edgeParameters.getSize() == 4);
     cout << directed << mgd << endl;
 
     mgd.removeEdge(1, 0);
-    assert(mgd.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgd.incidenceMatrix[i].getSize() == 3);
-    }
+    assert(mgd.getVertexCount() == 5);
+    assert(mgd.edgeStarts.getSize() == 3 && mgd.edgeEnds.getSize() == 3);
     assert(mgd.edgeParameters.getSize() == 3);
     cout << directed << mgd << endl;
 
     mgd.removeEdge(1, 4);
-    assert(mgd.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgd.incidenceMatrix[i].getSize() == 2);
-    }
+    assert(mgd.getVertexCount() == 5);
+    assert(mgd.edgeStarts.getSize() == 2 && mgd.edgeEnds.getSize() == 2);
     assert(mgd.edgeParameters.getSize() == 2);
     cout << directed << mgd << endl;
 
@@ -210,18 +196,14 @@ void MatrixGraphTest::testRemoveEdge_vertexID() {
     cout << undirected << mgud << endl;
 
     mgud.removeEdge(0, 1);
-    assert(mgud.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgud.incidenceMatrix[i].getSize() == 4);
-    }
+    assert(mgud.getVertexCount() == 5);
+    assert(mgud.edgeStarts.getSize() == 4 && mgud.edgeEnds.getSize() == 4);
     assert(mgud.edgeParameters.getSize() == 4);
     cout << undirected << mgud << endl;
 
     mgud.removeEdge(1, 3);
-    assert(mgud.incidenceMatrix.getSize() == 5);
-    for (int i = 0; i < 5; ++i) {
-        assert(mgud.incidenceMatrix[i].getSize() == 3);
-    }
+    assert(mgud.getVertexCount() == 5);
+    assert(mgud.edgeStarts.getSize() == 3 && mgud.edgeEnds.getSize() == 3);
     assert(mgud.edgeParameters.getSize() == 3);
     cout << undirected << mgud << endl;
 }
@@ -9,6 +9,12 @@ void MiscellaneousTests::run() const {
     neighbourhoodDesignationTest(TSPLocalSearchAlgorithms::invertNeighbourhood, "SMALL/data10.txt",
                                  "invertNeighbourhood");
     createRandomPermutationTest();
+    targetFunctionValueOverflowTest();
+    detectTSPTypeTest("SMALL/data10.txt");
+    detectTSPTypeTest("TSP/data17.txt");
+    detectTSPTypeTest("TSP/data58.txt");
+    detectTSPTypeTest("ATSP/data17.txt");
+    detectTSPTypeTest("MIE/tsp_6_1.txt");
 }
 
 void MiscellaneousTests::randomNumberGenerationTest() const {
@@ -113,7 +119,8 @@ void MiscellaneousTests::neighbourhoodDesignationTest(TSPLocalSearchAlgorithms::
                                                       const std::string &testName) const {
     cout << "Test \"" << testName << "\" on instance \"" << instanceFileToTest << "\"...";
     IGraph *tspInstance = nullptr;
-    TSPUtils::loadTSPInstance(&tspInstance, instanceFileToTest, TSPUtils::getTSPType(instanceFileToTest));
+    TSPUtils::TSPType tspType;
+    TSPUtils::loadTSPInstanceDetectType(&tspInstance, instanceFileToTest, tspType);
     int instanceSize = tspInstance->getVertexCount();
     TSPLocalSearchAlgorithms::fNeighbourhoodDiff nextNeighbourTFValue;
     if (nextNeighbourFunction == TSPLocalSearchAlgorithms::swapNeighbourhood) {
@@ -152,7 +159,8 @@ void MiscellaneousTests::createRandomPermutationTest() const {
     cout << "createRandomPermutationTest...";
     IGraph *tspInstance = nullptr;
     std::string instanceFilePath = "ATSP/data443.txt";
-    TSPUtils::loadTSPInstance(&tspInstance, instanceFilePath, TSPUtils::getTSPType(instanceFilePath));
+    TSPUtils::TSPType tspType;
+    TSPUtils::loadTSPInstanceDetectType(&tspInstance, instanceFilePath, tspType);
     std::vector<int> randomPermutation;
     int randomPermutationValue;
 
@@ -164,3 +172,55 @@ void MiscellaneousTests::createRandomPermutationTest() const {
     delete tspInstance;
     cout << "FINISHED" << endl;
 }
+
+void MiscellaneousTests::targetFunctionValueOverflowTest() const {
+    cout << "targetFunctionValueOverflowTest...";
+    DistanceMatrix tspInstance(IGraph::GraphType::Undirected, 3);
+    tspInstance.addEdge(0, 1, 1'000'000'000);
+    tspInstance.addEdge(1, 2, 1'000'000'000);
+    tspInstance.addEdge(2, 0, 1'000'000'000);
+    std::vector<int> permutation{0, 1, 2};
+    assert(TSPUtils::calculateTargetFunctionValue(&tspInstance, permutation) == std::numeric_limits<int>::max());
+
+    tspInstance.setEdgeParameter(2, 0, 1);
+    assert(TSPUtils::calculateTargetFunctionValue(&tspInstance, permutation) == 2'000'000'001);
+    cout << "SUCCESS" << endl;
+}
+
+void MiscellaneousTests::detectTSPTypeTest(const std::string &instanceFile) const {
+    cout << "detectTSPTypeTest on instance \"" << instanceFile << "\"...";
+    IGraph *detectedInstance = nullptr, *directedInstance = nullptr;
+    TSPUtils::TSPType tspType;
+    bool isMetric;
+    TSPUtils::loadTSPInstanceDetectType(&detectedInstance, instanceFile, tspType,
+                                        IGraph::GraphStructure::FlatMatrix, &isMetric);
+    TSPUtils::loadTSPInstance(&directedInstance, instanceFile);
+    assert(TSPUtils::getTSPType(instanceFile) == tspType);
+
+    const int nVertex = directedInstance->getVertexCount();
+    bool isSymmetric = true, satisfiesTriangleInequality = true;
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            if (i == j) {
+                continue;
+            }
+            const long long costIJ = directedInstance->getEdgeParameter(i, j);
+            isSymmetric = isSymmetric && costIJ == directedInstance->getEdgeParameter(j, i);
+            for (int k = 0; k < nVertex; ++k) {
+                if (k != i && k != j && directedInstance->getEdgeParameter(i, k) >
+                                        costIJ + directedInstance->getEdgeParameter(j, k)) {
+                    satisfiesTriangleInequality = false;
+                }
+            }
+        }
+    }
+    assert(isSymmetric == (tspType == TSPUtils::TSPType::Symmetric));
+    assert(satisfiesTriangleInequality == isMetric);
+    assert(detectedInstance->getGraphType() ==
+           (isSymmetric ? IGraph::GraphType::Undirected : IGraph::GraphType::Directed));
+
+    delete detectedInstance;
+    delete directedInstance;
+    cout << "SUCCESS (" << (isSymmetric ? "symmetric" : "asymmetric") << ", "
+         << (isMetric ? "metric" : "not metric") << ")" << endl;
+}
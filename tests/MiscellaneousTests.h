@@ -25,6 +25,10 @@ private:
                                       const std::string &instanceFileToTest,
                                       const std::string &testName) const;
     void createRandomPermutationTest() const;
+    // Tour costs exceeding int range must not overflow
+    void targetFunctionValueOverflowTest() const;
+    // Type and metricity detected while loading are compared with edges of the loaded instance
+    void detectTSPTypeTest(const std::string &instanceFile) const;
 };
 
 
@@ -0,0 +1,160 @@
+#include "QuantizedMatrixTest.h"
+
+#define pStartInfo(method) cout << "##### QuantizedMatrixTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% QuantizedMatrixTest::" << (method) << "() end %%%%%" << endl << endl
+
+void QuantizedMatrixTest::run() {
+    pStartInfo("testQuantizedMatrix");
+    testQuantizedMatrix();
+    pEndInfo("testQuantizedMatrix");
+
+    pStartInfo("testAddEdge");
+    testAddEdge();
+    pEndInfo("testAddEdge");
+
+    pStartInfo("testRemoveEdge");
+    testRemoveEdge();
+    pEndInfo("testRemoveEdge");
+
+    pStartInfo("testGetEdgeParameter");
+    testGetEdgeParameter();
+    pEndInfo("testGetEdgeParameter");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("SMALL/data10.txt", sizeof(std::uint8_t));
+    testLoadTSPInstance("ATSP/data443.txt", sizeof(std::uint8_t));
+    testLoadTSPInstance("TSP/data17.txt", sizeof(std::uint16_t));
+    testLoadTSPInstance("TSP/data120.txt", sizeof(std::uint16_t));
+    pEndInfo("testLoadTSPInstance");
+}
+
+void QuantizedMatrixTest::testQuantizedMatrix() {
+    QuantizedMatrix<std::uint8_t> qm(IGraph::GraphType::Directed, 70);
+    assert(qm.getVertexCount() == 70);
+    assert(qm.getEdgeCount() == 0);
+    assert(qm.getGraphStructure() == IGraph::GraphStructure::QuantizedFlatMatrix);
+    // Rows are padded to ALIGNMENT
+    assert(qm.rowStride == 128);
+    assert(reinterpret_cast<std::uintptr_t>(qm.getRow(1)) % QuantizedMatrix<std::uint8_t>::ALIGNMENT == 0);
+
+    QuantizedMatrix<std::uint16_t> qm16(IGraph::GraphType::Undirected, 5);
+    assert(qm16.rowStride == 32);
+
+    assert(QuantizedMatrix<std::uint8_t>::canStore(0, 254));
+    assert(!QuantizedMatrix<std::uint8_t>::canStore(0, 255));
+    assert(!QuantizedMatrix<std::uint8_t>::canStore(-1, 10));
+    assert(QuantizedMatrix<std::uint16_t>::canStore(0, 65534));
+    assert(!QuantizedMatrix<std::uint16_t>::canStore(0, 65535));
+
+    bool hasThrown = false;
+    try {
+        QuantizedMatrix<std::uint8_t> emptyMatrix(IGraph::GraphType::Directed, 0);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void QuantizedMatrixTest::testAddEdge() {
+    QuantizedMatrix<std::uint8_t> qmd(IGraph::GraphType::Directed, 5);
+    qmd.addEdge(0, 3, 5);
+    qmd.addEdge(3, 0, 10);
+    qmd.addEdge(2, 4, 254);
+    assert(qmd.getCost(0, 3) == 5);
+    assert(qmd.getCost(3, 0) == 10);
+    assert(qmd.getCost(2, 4) == 254);
+    assert(qmd.getEdgeCount() == 3);
+    cout << qmd << endl;
+
+    QuantizedMatrix<std::uint16_t> qmud(IGraph::GraphType::Undirected, 5);
+    qmud.addEdge(0, 3, 1000);
+    assert(qmud.getCost(3, 0) == 1000);
+    assert(qmud.getEdgeCount() == 1);
+
+    bool hasThrown = false;
+    try {
+        qmd.addEdge(1, 2, 255);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    hasThrown = false;
+    try {
+        qmd.addEdge(0, 3, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    hasThrown = false;
+    try {
+        qmd.addEdge(1, 1, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+    assert(qmd.getEdgeCount() == 3);
+}
+
+void QuantizedMatrixTest::testRemoveEdge() {
+    QuantizedMatrix<std::uint8_t> qmud(IGraph::GraphType::Undirected, 5);
+    qmud.addEdge(0, 3, 5);
+    qmud.addEdge(1, 2, 7);
+    qmud.removeEdge(3, 0);
+    assert(qmud.getCost(0, 3) == std::numeric_limits<int>::max());
+    assert(qmud.getCost(3, 0) == std::numeric_limits<int>::max());
+    assert(qmud.getEdgeCount() == 1);
+
+    bool hasThrown = false;
+    try {
+        qmud.removeEdge(0, 3);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void QuantizedMatrixTest::testGetEdgeParameter() {
+    QuantizedMatrix<std::uint16_t> qmd(IGraph::GraphType::Directed, 4);
+    qmd.addEdge(0, 1, 0);
+    qmd.addEdge(1, 2, 65534);
+    assert(qmd.getEdgeParameter(0, 1) == 0);
+    assert(qmd.getEdgeParameter(1, 2) == 65534);
+    assert(qmd.getEdgeParameter(2, 1) == std::numeric_limits<int>::max());
+    assert(qmd.getEdgeParameter(3, 3) == std::numeric_limits<int>::max());
+    qmd.setEdgeParameter(0, 1, 12);
+    assert(qmd.getEdgeParameter(0, 1) == 12);
+}
+
+void QuantizedMatrixTest::testLoadTSPInstance(const std::string &instanceFile, std::size_t expectedCostSize) {
+    cout << "Instance \"" << instanceFile << "\"...";
+    IGraph *listGraph = nullptr, *quantizedMatrix = nullptr;
+    TSPUtils::TSPType tspType = TSPUtils::getTSPType(instanceFile);
+    TSPUtils::loadTSPInstance(&listGraph, instanceFile, tspType);
+    TSPUtils::loadTSPInstance(&quantizedMatrix, instanceFile, tspType, IGraph::GraphStructure::QuantizedFlatMatrix);
+    assert(quantizedMatrix->getGraphStructure() == IGraph::GraphStructure::QuantizedFlatMatrix);
+    if (expectedCostSize == sizeof(std::uint8_t)) {
+        assert(dynamic_cast<QuantizedMatrix<std::uint8_t> *>(quantizedMatrix) != nullptr);
+    } else {
+        assert(dynamic_cast<QuantizedMatrix<std::uint16_t> *>(quantizedMatrix) != nullptr);
+    }
+    assert(quantizedMatrix->getVertexCount() == listGraph->getVertexCount());
+    assert(quantizedMatrix->getEdgeCount() == listGraph->getEdgeCount());
+    for (int i = 0; i < listGraph->getVertexCount(); ++i) {
+        for (int j = 0; j < listGraph->getVertexCount(); ++j) {
+            assert(quantizedMatrix->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+        }
+    }
+
+    std::vector<int> listSolution, quantizedSolution;
+    int listSolutionValue = TSPGreedyAlgorithms::nearestNeighbour(listGraph, listSolution);
+    int quantizedSolutionValue = TSPGreedyAlgorithms::nearestNeighbour(quantizedMatrix, quantizedSolution);
+    assert(listSolutionValue == quantizedSolutionValue);
+    assert(TSPUtils::areSolutionsEqual(listSolution, quantizedSolution));
+    assert(TSPUtils::isSolutionValid(quantizedMatrix, quantizedSolution, quantizedSolutionValue));
+
+    delete listGraph;
+    delete quantizedMatrix;
+    cout << "SUCCESS" << endl;
+}
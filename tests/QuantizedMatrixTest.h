@@ -0,0 +1,32 @@
+#ifndef PEA_P1_QUANTIZEDMATRIXTEST_H
+#define PEA_P1_QUANTIZEDMATRIXTEST_H
+
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "../structures/graphs/QuantizedMatrix.h"
+#include "../utilities/TSPUtils.h"
+#include "../algorithms/TSPGreedyAlgorithms.h"
+
+using std::cout;
+using std::endl;
+
+class QuantizedMatrixTest {
+public:
+    void run();
+
+private:
+    void testQuantizedMatrix();
+    void testAddEdge();
+    void testRemoveEdge();
+    void testGetEdgeParameter();
+
+    // Compares every edge parameter and nearest neighbour solution with ListGraph loaded from the same file
+    // expectedCostSize - width (in bytes) of costs the loader is expected to pick
+    void testLoadTSPInstance(const std::string &instanceFile, std::size_t expectedCostSize);
+};
+
+#endif //PEA_P1_QUANTIZEDMATRIXTEST_H
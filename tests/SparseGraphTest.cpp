@@ -0,0 +1,274 @@
+#include "SparseGraphTest.h"
+
+#define pStartInfo(method) cout << "##### SparseGraphTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% SparseGraphTest::" << (method) << "() end %%%%%" << endl << endl
+
+void SparseGraphTest::run() {
+    pStartInfo("testSparseGraph");
+    testSparseGraph();
+    pEndInfo("testSparseGraph");
+
+    pStartInfo("testAddEdge");
+    testAddEdge();
+    pEndInfo("testAddEdge");
+
+    pStartInfo("testRemoveEdge");
+    testRemoveEdge();
+    pEndInfo("testRemoveEdge");
+
+    pStartInfo("testGetVertexSuccessors");
+    testGetVertexSuccessors();
+    pEndInfo("testGetVertexSuccessors");
+
+    pStartInfo("testGetEdgeParameter");
+    testGetEdgeParameter();
+    pEndInfo("testGetEdgeParameter");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("ATSP/data17.txt", TSPUtils::TSPType::Asymmetric);
+    testLoadTSPInstance("TSP/data120.txt", TSPUtils::TSPType::Symmetric);
+    testLoadTSPInstance("SMALL/data10.txt", TSPUtils::TSPType::Asymmetric);
+    pEndInfo("testLoadTSPInstance");
+
+    pStartInfo("testLoadSparseTSPInstance");
+    testLoadSparseTSPInstance();
+    pEndInfo("testLoadSparseTSPInstance");
+
+    pStartInfo("testIncompleteTour");
+    testIncompleteTour();
+    pEndInfo("testIncompleteTour");
+}
+
+void SparseGraphTest::testSparseGraph() {
+    Table<Edge> edges;
+    edges.insertAtEnd(Edge(0, 3, 5));
+    edges.insertAtEnd(Edge(0, 1, 7));
+    edges.insertAtEnd(Edge(2, 0, 4));
+    edges.insertAtEnd(Edge(3, 2, 10));
+    SparseGraph sg(IGraph::GraphType::Directed, 4, edges);
+    assert(sg.getVertexCount() == 4);
+    assert(sg.getEdgeCount() == 4);
+    assert(sg.getGraphStructure() == IGraph::GraphStructure::CompressedSparseRow);
+
+    // Rows are sorted, costs follow their vertices
+    assert(sg.rowOffsets.getSize() == 5);
+    assert(sg.rowOffsets[0] == 0 && sg.rowOffsets[1] == 2 && sg.rowOffsets[2] == 2);
+    assert(sg.rowOffsets[3] == 3 && sg.rowOffsets[4] == 4);
+    assert(sg.neighbourIDs[0] == 1 && sg.neighbourCosts[0] == 7);
+    assert(sg.neighbourIDs[1] == 3 && sg.neighbourCosts[1] == 5);
+    assert(sg.predecessorOffsets[1] == 1 && sg.predecessorIDs[0] == 2);
+
+    SparseGraph undirected(IGraph::GraphType::Undirected, 4, edges);
+    assert(undirected.getEdgeCount() == 4);
+    assert(undirected.neighbourIDs.getSize() == 8);
+    assert(undirected.getCost(3, 0) == 5 && undirected.getCost(0, 2) == 4);
+
+    edges.insertAtEnd(Edge(1, 1, 1));
+    bool hasThrown = false;
+    try {
+        SparseGraph loopGraph(IGraph::GraphType::Directed, 4, edges);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    edges.remove(edges.getSize() - 1);
+    edges.insertAtEnd(Edge(3, 0, 1));
+    hasThrown = false;
+    try {
+        // Directed graph accepts both directions, undirected one does not
+        SparseGraph directedGraph(IGraph::GraphType::Directed, 4, edges);
+        SparseGraph multigraph(IGraph::GraphType::Undirected, 4, edges);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    edges.insertAtEnd(Edge(0, 4, 1));
+    hasThrown = false;
+    try {
+        SparseGraph invalidGraph(IGraph::GraphType::Directed, 4, edges);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void SparseGraphTest::testAddEdge() {
+    SparseGraph sg(IGraph::GraphType::Directed, 5);
+    sg.addEdge(0, 3, 5);
+    sg.addEdge(3, 2, 10);
+    sg.addEdge(0, 1, 25);
+    sg.addEdge(4, 0, 1);
+    assert(sg.getCost(0, 3) == 5);
+    assert(sg.getCost(3, 0) == std::numeric_limits<int>::max());
+    assert(sg.getCost(0, 1) == 25);
+    assert(sg.getEdgeCount() == 4);
+    assert(sg.neighbourIDs[0] == 1 && sg.neighbourIDs[1] == 3);
+    assert(sg.rowOffsets[4] == 3 && sg.rowOffsets[5] == 4);
+    assert(sg.getPredecessorsView(0).getSize() == 1 && sg.getPredecessorsView(0)[0] == 4);
+    cout << sg << endl;
+
+    bool hasThrown = false;
+    try {
+        sg.addEdge(0, 3, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    hasThrown = false;
+    try {
+        sg.addEdge(2, 2, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+    assert(sg.getEdgeCount() == 4);
+}
+
+void SparseGraphTest::testRemoveEdge() {
+    SparseGraph sg(IGraph::GraphType::Undirected, 5);
+    sg.addEdge(0, 3, 5);
+    sg.addEdge(1, 2, 7);
+    sg.addEdge(3, 4, 2);
+    sg.removeEdge(3, 0);
+    assert(sg.getCost(0, 3) == std::numeric_limits<int>::max());
+    assert(sg.getCost(4, 3) == 2);
+    assert(sg.getEdgeCount() == 2);
+    assert(sg.rowOffsets[1] == 0 && sg.rowOffsets[5] == 4);
+
+    bool hasThrown = false;
+    try {
+        sg.removeEdge(0, 3);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void SparseGraphTest::testGetVertexSuccessors() {
+    SparseGraph sg(IGraph::GraphType::Directed, 5);
+    sg.addEdge(3, 4, 25);
+    sg.addEdge(3, 0, 5);
+    sg.addEdge(2, 3, 10);
+    DoublyLinkedList<int> successors = sg.getVertexSuccessors(3);
+    assert(successors.getSize() == 2);
+    assert(successors.contains(0) && successors.contains(4));
+    assert(sg.getVertexPredecessors(3).getSize() == 1 && sg.getVertexPredecessors(3).contains(2));
+
+    // Successors and their costs are borrowed, aligned rows
+    auto successorsView = sg.getSuccessorsView(3);
+    auto costsView = sg.getSuccessorCostsView(3);
+    assert(!successorsView.isOwning() && successorsView.getSize() == 2);
+    assert(successorsView[0] == 0 && costsView[0] == 5);
+    assert(successorsView[1] == 4 && costsView[1] == 25);
+    assert(sg.getSuccessorsView(1).isEmpty());
+
+    auto costRow = sg.getCostRowView(3);
+    assert(costRow.isOwning() && costRow.getSize() == 5);
+    assert(costRow[0] == 5 && costRow[1] == std::numeric_limits<int>::max() && costRow[4] == 25);
+}
+
+void SparseGraphTest::testGetEdgeParameter() {
+    SparseGraph sg(IGraph::GraphType::Undirected, 4);
+    sg.addEdge(0, 1, 0);
+    sg.addEdge(2, 1, 100);
+    assert(sg.getEdgeParameter(1, 0) == 0);
+    assert(sg.getEdgeParameter(1, 2) == 100);
+    assert(sg.getEdgeParameter(3, 1) == std::numeric_limits<int>::max());
+    assert(sg.getEdgeParameter(2, 2) == std::numeric_limits<int>::max());
+    sg.setEdgeParameter(1, 2, 12);
+    assert(sg.getEdgeParameter(2, 1) == 12);
+
+    bool hasThrown = false;
+    try {
+        sg.setEdgeParameter(0, 3, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void SparseGraphTest::testLoadTSPInstance(const std::string &instanceFile, TSPUtils::TSPType tspType) {
+    cout << "Instance \"" << instanceFile << "\"...";
+    IGraph *listGraph = nullptr, *sparseGraph = nullptr;
+    TSPUtils::loadTSPInstance(&listGraph, instanceFile, tspType);
+    TSPUtils::loadTSPInstance(&sparseGraph, instanceFile, tspType, IGraph::GraphStructure::CompressedSparseRow);
+    assert(sparseGraph->getGraphStructure() == IGraph::GraphStructure::CompressedSparseRow);
+    assert(sparseGraph->getVertexCount() == listGraph->getVertexCount());
+    assert(sparseGraph->getEdgeCount() == listGraph->getEdgeCount());
+    for (int i = 0; i < listGraph->getVertexCount(); ++i) {
+        for (int j = 0; j < listGraph->getVertexCount(); ++j) {
+            assert(sparseGraph->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+        }
+    }
+
+    std::vector<int> listSolution, sparseSolution;
+    int listSolutionValue = TSPGreedyAlgorithms::nearestNeighbour(listGraph, listSolution);
+    int sparseSolutionValue = TSPGreedyAlgorithms::nearestNeighbour(sparseGraph, sparseSolution);
+    assert(listSolutionValue == sparseSolutionValue);
+    assert(TSPUtils::isSolutionValid(sparseGraph, sparseSolution, sparseSolutionValue));
+
+    listSolution.clear();
+    sparseSolution.clear();
+    listSolutionValue = TSPGreedyAlgorithms::greedy(listGraph, listSolution);
+    sparseSolutionValue = TSPGreedyAlgorithms::greedy(sparseGraph, sparseSolution);
+    assert(listSolutionValue == sparseSolutionValue);
+    assert(TSPUtils::isSolutionValid(sparseGraph, sparseSolution, sparseSolutionValue));
+
+    delete listGraph;
+    delete sparseGraph;
+    cout << "SUCCESS" << endl;
+}
+
+void SparseGraphTest::testLoadSparseTSPInstance() {
+    // Ring 0-1-...-7-0 of cost 27 with three expensive chords
+    IGraph *sparseGraph = nullptr, *listGraph = nullptr;
+    std::string name = TSPUtils::loadSparseTSPInstance(&sparseGraph, "SPARSE/sparse8.txt",
+                                                       TSPUtils::TSPType::Symmetric);
+    TSPUtils::loadSparseTSPInstance(&listGraph, "SPARSE/sparse8.txt", TSPUtils::TSPType::Symmetric,
+                                    IGraph::GraphStructure::AdjacencyList);
+    assert(name == "sparse8");
+    assert(sparseGraph->getVertexCount() == 8);
+    assert(sparseGraph->getEdgeCount() == 11);
+    assert(sparseGraph->getEdgeParameter(4, 0) == 10 && sparseGraph->getEdgeParameter(0, 4) == 10);
+    assert(sparseGraph->getEdgeParameter(0, 2) == std::numeric_limits<int>::max());
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            assert(sparseGraph->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+        }
+    }
+
+    std::vector<int> solution;
+    int solutionValue = TSPGreedyAlgorithms::nearestNeighbour(sparseGraph, solution);
+    assert(solutionValue == 27);
+    assert(TSPUtils::isSolutionValid(sparseGraph, solution, solutionValue));
+
+    solution.clear();
+    solutionValue = TSPGreedyAlgorithms::greedy(sparseGraph, solution);
+    assert(solutionValue == 27);
+    assert(TSPUtils::isSolutionValid(sparseGraph, solution, solutionValue));
+
+    delete sparseGraph;
+    delete listGraph;
+}
+
+void SparseGraphTest::testIncompleteTour() {
+    Table<Edge> edges;
+    edges.insertAtEnd(Edge(0, 1, 1));
+    edges.insertAtEnd(Edge(1, 2, 1));
+    edges.insertAtEnd(Edge(3, 0, 1));
+    SparseGraph sg(IGraph::GraphType::Directed, 4, edges);
+
+    // Nearest neighbour gets stuck in 2, greedy joins 3-0-1-2 but cannot close the cycle
+    std::vector<int> solution;
+    int solutionValue = TSPGreedyAlgorithms::nearestNeighbour(&sg, solution);
+    assert(solutionValue == std::numeric_limits<int>::max());
+    assert(solution.size() == 4 && solution[0] == 0 && solution[1] == 1 && solution[2] == 2 && solution[3] == 3);
+
+    solution.clear();
+    solutionValue = TSPGreedyAlgorithms::greedy(&sg, solution);
+    assert(solutionValue == std::numeric_limits<int>::max());
+    assert(solution.size() == 4 && solution[0] == 3 && solution[3] == 2);
+}
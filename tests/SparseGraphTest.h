@@ -0,0 +1,37 @@
+#ifndef PEA_P1_SPARSEGRAPHTEST_H
+#define PEA_P1_SPARSEGRAPHTEST_H
+
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include "../structures/graphs/SparseGraph.h"
+#include "../utilities/TSPUtils.h"
+#include "../algorithms/TSPGreedyAlgorithms.h"
+
+using std::cout;
+using std::endl;
+
+class SparseGraphTest {
+public:
+    void run();
+
+private:
+    void testSparseGraph();
+    void testAddEdge();
+    void testRemoveEdge();
+    void testGetVertexSuccessors();
+    void testGetEdgeParameter();
+
+    // Compares every edge parameter and solutions of algorithms with ListGraph loaded from the same file
+    void testLoadTSPInstance(const std::string &instanceFile, TSPUtils::TSPType tspType);
+
+    // Loads edge list instance and checks greedy algorithms visit its edges only
+    void testLoadSparseTSPInstance();
+
+    // Tour which cannot be completed with existing edges is still a permutation, of infinite cost
+    void testIncompleteTour();
+};
+
+#endif //PEA_P1_SPARSEGRAPHTEST_H
@@ -5,7 +5,13 @@ void TSPAlgorithmsTest::run() const {
 //    bruteForceTest();
 //    bruteForceTreeTest();
 //    dynamicProgrammingHeldKarpTest();
+//    dynamicProgrammingHeldKarpParallelTest();
+//    dynamicProgrammingHeldKarpCompactTest();
+//    dynamicProgrammingHeldKarpPrunedTest();
 //    branchAndBoundTest();
+//    branchAndBoundParallelTest();
+//    branchAndBoundNodesTest();
+//    branchAndBoundSearchStrategyTest();
 //
 //    nearestNeighbourTest();
 //    greedyTest();
@@ -256,6 +262,271 @@ void TSPAlgorithmsTest::dynamicProgrammingHeldKarpTest() const {
                                "dynamicProgrammingHeldKarp");
 }
 
+void TSPAlgorithmsTest::dynamicProgrammingHeldKarpParallelTest() const {
+    std::map<std::string, std::vector<std::string>> fileGroups;
+    std::vector<std::string> filePaths;
+
+    // MY
+    filePaths.emplace_back("my_opt.txt");
+    filePaths.emplace_back("mdata2.txt");
+    filePaths.emplace_back("mdata3.txt");
+    filePaths.emplace_back("mdata4.txt");
+    filePaths.emplace_back("mdata5.txt");
+    fileGroups.insert({"MY", filePaths});
+    filePaths.clear();
+
+    // ATSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    fileGroups.insert({"ATSP", filePaths});
+    filePaths.clear();
+
+    // SMALL
+    filePaths.emplace_back("opt.txt");
+    filePaths.emplace_back("data10.txt");
+    filePaths.emplace_back("data11.txt");
+    filePaths.emplace_back("data12.txt");
+    filePaths.emplace_back("data13.txt");
+    filePaths.emplace_back("data14.txt");
+    filePaths.emplace_back("data15.txt");
+    filePaths.emplace_back("data16.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data18.txt");
+    fileGroups.insert({"SMALL", filePaths});
+    filePaths.clear();
+
+    // TSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data21.txt");
+//    filePaths.emplace_back("data24.txt");
+//    filePaths.emplace_back("data26.txt");
+    fileGroups.insert({"TSP", filePaths});
+    filePaths.clear();
+
+    // MIE
+    filePaths.emplace_back("mie_opt.txt");
+    filePaths.emplace_back("tsp_6_1.txt");
+    filePaths.emplace_back("tsp_6_2.txt");
+    filePaths.emplace_back("tsp_10.txt");
+    filePaths.emplace_back("tsp_12.txt");
+    filePaths.emplace_back("tsp_13.txt");
+    filePaths.emplace_back("tsp_14.txt");
+    filePaths.emplace_back("tsp_15.txt");
+    filePaths.emplace_back("tsp_17.txt");
+    fileGroups.insert({"MIE", filePaths});
+    filePaths.clear();
+
+    testExactOrGreedyAlgorithm(fileGroups, TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel, false,
+                               "dynamicProgrammingHeldKarpParallel");
+
+    // Solution cost does not depend on the number of threads splitting the layers
+    IGraph *tspInstance = nullptr;
+    TSPUtils::loadTSPInstance(&tspInstance, "SMALL/data18.txt");
+    std::vector<int> solution;
+    const int expectedSolutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarp(tspInstance, solution);
+    for (unsigned int nThreads : {1u, 2u, 3u, 8u}) {
+        std::cout << "Testing SMALL/data18.txt on " << nThreads << " threads...";
+        solution.clear();
+        const int solutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel(*tspInstance, solution,
+                                                                                         nThreads);
+        if (solutionValue == expectedSolutionValue &&
+            TSPUtils::isSolutionValid(tspInstance, solution, solutionValue)) {
+            std::cout << "SUCCESS" << std::endl;
+        } else {
+            std::cout << "FAIL" << " [Returned solution cost: " << solutionValue << "]" << std::endl;
+        }
+    }
+
+    // Every min-plus kernel supported by the CPU finds the same tour
+    using Kernel = TSPExactAlgorithms::DPMinPlusKernel;
+    const Kernel detectedKernel = TSPExactAlgorithms::dpMinPlusKernel;
+    for (Kernel kernel : {Kernel::Scalar, Kernel::AVX2, Kernel::AVX512}) {
+        if (kernel > detectedKernel) {
+            continue;
+        }
+        TSPExactAlgorithms::dpMinPlusKernel = kernel;
+        std::cout << "Testing SMALL/data18.txt with min-plus kernel " << static_cast<int>(kernel) << "...";
+        solution.clear();
+        const int solutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel(tspInstance, solution);
+        if (solutionValue == expectedSolutionValue &&
+            TSPUtils::isSolutionValid(tspInstance, solution, solutionValue)) {
+            std::cout << "SUCCESS" << std::endl;
+        } else {
+            std::cout << "FAIL" << " [Returned solution cost: " << solutionValue << "]" << std::endl;
+        }
+    }
+    TSPExactAlgorithms::dpMinPlusKernel = detectedKernel;
+    delete tspInstance;
+}
+
+void TSPAlgorithmsTest::dynamicProgrammingHeldKarpCompactTest() const {
+    std::map<std::string, std::vector<std::string>> fileGroups;
+    std::vector<std::string> filePaths;
+
+    // MY
+    filePaths.emplace_back("my_opt.txt");
+    filePaths.emplace_back("mdata2.txt");
+    filePaths.emplace_back("mdata3.txt");
+    filePaths.emplace_back("mdata4.txt");
+    filePaths.emplace_back("mdata5.txt");
+    fileGroups.insert({"MY", filePaths});
+    filePaths.clear();
+
+    // ATSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    fileGroups.insert({"ATSP", filePaths});
+    filePaths.clear();
+
+    // SMALL
+    filePaths.emplace_back("opt.txt");
+    filePaths.emplace_back("data10.txt");
+    filePaths.emplace_back("data11.txt");
+    filePaths.emplace_back("data12.txt");
+    filePaths.emplace_back("data13.txt");
+    filePaths.emplace_back("data14.txt");
+    filePaths.emplace_back("data15.txt");
+    filePaths.emplace_back("data16.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data18.txt");
+    fileGroups.insert({"SMALL", filePaths});
+    filePaths.clear();
+
+    // TSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data21.txt");
+//    filePaths.emplace_back("data24.txt");
+//    filePaths.emplace_back("data26.txt");
+    fileGroups.insert({"TSP", filePaths});
+    filePaths.clear();
+
+    // MIE
+    filePaths.emplace_back("mie_opt.txt");
+    filePaths.emplace_back("tsp_6_1.txt");
+    filePaths.emplace_back("tsp_6_2.txt");
+    filePaths.emplace_back("tsp_10.txt");
+    filePaths.emplace_back("tsp_12.txt");
+    filePaths.emplace_back("tsp_13.txt");
+    filePaths.emplace_back("tsp_14.txt");
+    filePaths.emplace_back("tsp_15.txt");
+    filePaths.emplace_back("tsp_17.txt");
+    fileGroups.insert({"MIE", filePaths});
+    filePaths.clear();
+
+    testExactOrGreedyAlgorithm(fileGroups, TSPExactAlgorithms::dynamicProgrammingHeldKarpCompact, false,
+                               "dynamicProgrammingHeldKarpCompact");
+
+    // Cells are 1, 2 or 4 bytes wide, depending on the upper bound - costs of an instance are scaled, so that
+    // each width is used (nearest neighbour finds a tour of cost 296 in the original instance)
+    IGraph *tspInstance = nullptr;
+    TSPUtils::loadTSPInstance(&tspInstance, "SMALL/data12.txt");
+    const int nVertex = tspInstance->getVertexCount();
+    for (double costScale : {0.25, 1.0, 10000.0}) {
+        std::cout << "Testing SMALL/data12.txt with costs scaled by " << costScale << "...";
+        std::vector<int> scaledCosts(nVertex * nVertex, std::numeric_limits<int>::max());
+        for (int i = 0; i < nVertex; ++i) {
+            for (int j = 0; j < nVertex; ++j) {
+                if (i != j) {
+                    scaledCosts[i * nVertex + j] = static_cast<int>(tspInstance->getEdgeParameter(i, j) * costScale);
+                }
+            }
+        }
+        IGraph *scaledInstance = GraphBuilder::build(IGraph::GraphType::Directed, nVertex, scaledCosts.data(),
+                                                     IGraph::GraphStructure::FlatMatrix);
+        std::vector<int> solution;
+        const int expectedSolutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarp(scaledInstance, solution);
+        solution.clear();
+        const int solutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarpCompact(scaledInstance, solution);
+        if (solutionValue == expectedSolutionValue &&
+            TSPUtils::isSolutionValid(scaledInstance, solution, solutionValue)) {
+            std::cout << "SUCCESS" << std::endl;
+        } else {
+            std::cout << "FAIL" << " [Returned solution cost: " << solutionValue << "]" << std::endl;
+        }
+        delete scaledInstance;
+    }
+    delete tspInstance;
+}
+
+void TSPAlgorithmsTest::dynamicProgrammingHeldKarpPrunedTest() const {
+    std::map<std::string, std::vector<std::string>> fileGroups;
+    std::vector<std::string> filePaths;
+
+    // MY
+    filePaths.emplace_back("my_opt.txt");
+    filePaths.emplace_back("mdata2.txt");
+    filePaths.emplace_back("mdata3.txt");
+    filePaths.emplace_back("mdata4.txt");
+    filePaths.emplace_back("mdata5.txt");
+    fileGroups.insert({"MY", filePaths});
+    filePaths.clear();
+
+    // ATSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data34.txt");
+    filePaths.emplace_back("data36.txt");
+    filePaths.emplace_back("data39.txt");
+    filePaths.emplace_back("data45.txt");
+//    filePaths.emplace_back("data43.txt"); // cycle cover bound is too weak
+//    filePaths.emplace_back("data48.txt");
+    fileGroups.insert({"ATSP", filePaths});
+    filePaths.clear();
+
+    // SMALL
+    filePaths.emplace_back("opt.txt");
+    filePaths.emplace_back("data10.txt");
+    filePaths.emplace_back("data11.txt");
+    filePaths.emplace_back("data12.txt");
+    filePaths.emplace_back("data13.txt");
+    filePaths.emplace_back("data14.txt");
+    filePaths.emplace_back("data15.txt");
+    filePaths.emplace_back("data16.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data18.txt");
+    fileGroups.insert({"SMALL", filePaths});
+    filePaths.clear();
+
+    // TSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data21.txt");
+    filePaths.emplace_back("data24.txt");
+    fileGroups.insert({"TSP", filePaths});
+    filePaths.clear();
+
+    // MIE
+    filePaths.emplace_back("mie_opt.txt");
+    filePaths.emplace_back("tsp_6_1.txt");
+    filePaths.emplace_back("tsp_6_2.txt");
+    filePaths.emplace_back("tsp_10.txt");
+    filePaths.emplace_back("tsp_12.txt");
+    filePaths.emplace_back("tsp_13.txt");
+    filePaths.emplace_back("tsp_14.txt");
+    filePaths.emplace_back("tsp_15.txt");
+    filePaths.emplace_back("tsp_17.txt");
+    fileGroups.insert({"MIE", filePaths});
+    filePaths.clear();
+
+    testExactOrGreedyAlgorithm(fileGroups, TSPExactAlgorithms::dynamicProgrammingHeldKarpPruned, false,
+                               "dynamicProgrammingHeldKarpPruned");
+
+    // Exceeding the limit of states throws instead of returning a tour that may not be optimal
+    IGraph *tspInstance = nullptr;
+    TSPUtils::loadTSPInstance(&tspInstance, "ATSP/data34.txt");
+    std::cout << "Testing ATSP/data34.txt with a limit of 1000 states...";
+    try {
+        std::vector<int> solution;
+        const int solutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarpPruned(*tspInstance, solution, 1000);
+        std::cout << "FAIL" << " [Returned solution cost: " << solutionValue << "]" << std::endl;
+    } catch (const std::invalid_argument &) {
+        std::cout << "SUCCESS" << std::endl;
+    }
+    delete tspInstance;
+}
+
 void TSPAlgorithmsTest::branchAndBoundTest() const {
     std::map<std::string, std::vector<std::string>> fileGroups;
     std::vector<std::string> filePaths;
@@ -339,6 +610,287 @@ void TSPAlgorithmsTest::branchAndBoundTest() const {
 //    testExactOrGreedyAlgorithm(fileGroups, TSPExactAlgorithms::branchAndBound2Heuristics, false, "branchAndBound2Heuristics");
 }
 
+void TSPAlgorithmsTest::branchAndBoundParallelTest() const {
+    std::map<std::string, std::vector<std::string>> fileGroups;
+    std::vector<std::string> filePaths;
+
+    // MY
+    filePaths.emplace_back("my_opt.txt");
+    filePaths.emplace_back("mdata2.txt");
+    filePaths.emplace_back("mdata3.txt");
+    filePaths.emplace_back("mdata4.txt");
+    filePaths.emplace_back("mdata5.txt");
+    fileGroups.insert({"MY", filePaths});
+    filePaths.clear();
+
+    // ATSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data34.txt");
+    filePaths.emplace_back("data36.txt");
+//    filePaths.emplace_back("data39.txt");
+//    filePaths.emplace_back("data43.txt");
+//    filePaths.emplace_back("data45.txt");
+//    filePaths.emplace_back("data48.txt");
+//    filePaths.emplace_back("data53.txt");
+//    filePaths.emplace_back("data56.txt");
+//    filePaths.emplace_back("data65.txt");
+//    filePaths.emplace_back("data70.txt");
+//    filePaths.emplace_back("data71.txt");
+    fileGroups.insert({"ATSP", filePaths});
+    filePaths.clear();
+
+    // SMALL
+    filePaths.emplace_back("opt.txt");
+    filePaths.emplace_back("data10.txt");
+    filePaths.emplace_back("data11.txt");
+    filePaths.emplace_back("data12.txt");
+    filePaths.emplace_back("data13.txt");
+    filePaths.emplace_back("data14.txt");
+    filePaths.emplace_back("data15.txt");
+    filePaths.emplace_back("data16.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data18.txt");
+    fileGroups.insert({"SMALL", filePaths});
+    filePaths.clear();
+
+    // TSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data21.txt");
+    filePaths.emplace_back("data24.txt");
+    fileGroups.insert({"TSP", filePaths});
+    filePaths.clear();
+
+    testExactOrGreedyAlgorithm(fileGroups, TSPExactAlgorithms::branchAndBoundParallel, false,
+                               "branchAndBoundParallel");
+
+    // Solution cost does not depend on the number of workers sharing the nodes
+    IGraph *tspInstance = nullptr;
+    TSPUtils::loadTSPInstance(&tspInstance, "ATSP/data34.txt");
+    std::vector<int> solution;
+    const int expectedSolutionValue = TSPExactAlgorithms::branchAndBound(tspInstance, solution);
+    for (unsigned int nThreads : {1u, 2u, 4u}) {
+        std::cout << "Testing ATSP/data34.txt on " << nThreads << " threads...";
+        solution.clear();
+        const int solutionValue = TSPExactAlgorithms::branchAndBoundParallel(*tspInstance, solution, nThreads);
+        if (solutionValue == expectedSolutionValue &&
+            TSPUtils::isSolutionValid(tspInstance, solution, solutionValue)) {
+            std::cout << "SUCCESS" << std::endl;
+        } else {
+            std::cout << "FAIL" << " [Returned solution cost: " << solutionValue << "]" << std::endl;
+        }
+    }
+    delete tspInstance;
+}
+
+void TSPAlgorithmsTest::branchAndBoundNodesTest() const {
+    // Branching paths - whether the child including the branching edge is followed at the given depth
+    const std::vector<std::pair<std::string, std::function<bool(int)>>> branchingPaths = {
+            {"included edges", [](int) { return true; }},
+            {"excluded edges", [](int) { return false; }},
+            {"alternating edges", [](int depth) { return depth % 2 == 0; }},
+            {"every third edge included", [](int depth) { return depth % 3 == 0; }}};
+    const std::vector<std::string> instancePaths = {"SMALL/data10.txt", "MY/mdata5.txt", "ATSP/data34.txt",
+                                                    "TSP/data17.txt"};
+
+    // Matrices rebuilt by bbRestoreNode() are equal to the matrices derived eagerly from the parents' ones
+    // Only final nodes with n - 1 edges on the path close a tour
+    bool isTourNodeReached = false, isShortFinalNodeReached = false;
+    for (const auto &instancePath : instancePaths) {
+        IGraph *tspInstance = nullptr;
+        TSPUtils::loadTSPInstance(&tspInstance, instancePath);
+        const int instanceSize = tspInstance->getVertexCount();
+        for (const auto &branchingPath : branchingPaths) {
+            std::cout << "Testing replay of " << branchingPath.first << " on " << instancePath << "...";
+            BBWorkspace workspace(instanceSize);
+            std::vector<std::unique_ptr<BBNode>> nodes;
+            nodes.emplace_back(std::make_unique<BBNode>(nullptr, EdgeCities(), false));
+            BBNode *node = nodes.back().get();
+            TSPExactAlgorithms::bbInitRoot(*tspInstance, workspace, *node);
+            std::vector<int> eagerDistances = workspace.rootDistances;
+            std::vector<std::pair<EdgeCities, int>> matrixZeroes;
+
+            bool isNodeValid = true;
+            for (int depth = 0; isNodeValid; ++depth) {
+                TSPExactAlgorithms::bbRestoreNode(node, workspace);
+                if (workspace.distances != eagerDistances) {
+                    isNodeValid = false;
+                    break;
+                }
+                if (node->isFinal) {
+                    std::vector<int> tour;
+                    TSPExactAlgorithms::bbRestoreTour(workspace, tour);
+                    if (node->edgesOnPath == instanceSize - 1) {
+                        isTourNodeReached = true;
+                        isNodeValid = TSPUtils::isSolutionValid(
+                                tspInstance, tour, TSPUtils::calculateTargetFunctionValue(tspInstance, tour));
+                    } else {
+                        isShortFinalNodeReached = true;
+                        isNodeValid = static_cast<int>(tour.size()) < instanceSize;
+                    }
+                    break;
+                }
+
+                const EdgeCities edge = node->highestZeroPenaltiesIndexes;
+                const bool isEdgeIncluded = branchingPath.second(depth);
+                BBNode eagerChild(node, edge, isEdgeIncluded);
+                if (isEdgeIncluded) {
+                    TSPExactAlgorithms::bbIncludeEdge(eagerDistances, instanceSize, edge,
+                                                      TSPExactAlgorithms::bbProhibitedEdge(workspace, edge));
+                } else {
+                    TSPExactAlgorithms::bbExcludeEdge(eagerDistances, instanceSize, edge);
+                }
+                TSPExactAlgorithms::bbCalculateLowerBoundAndDesignateHighestZeroPenalties(eagerDistances, instanceSize,
+                                                                                          eagerChild, matrixZeroes);
+
+                nodes.emplace_back(std::make_unique<BBNode>(node, edge, isEdgeIncluded));
+                BBNode *child = nodes.back().get();
+                TSPExactAlgorithms::bbEvaluateChild(workspace, *child);
+                isNodeValid = child->lowerBound == eagerChild.lowerBound && child->isFinal == eagerChild.isFinal &&
+                              (child->isFinal ||
+                               (child->highestZeroPenaltiesIndexes.i == eagerChild.highestZeroPenaltiesIndexes.i &&
+                                child->highestZeroPenaltiesIndexes.j == eagerChild.highestZeroPenaltiesIndexes.j));
+                node = child;
+            }
+            if (isNodeValid) {
+                std::cout << "SUCCESS" << " [Depth: " << nodes.size() - 1 << "]" << std::endl;
+            } else {
+                std::cout << "FAIL" << " [Depth: " << nodes.size() - 1 << "]" << std::endl;
+            }
+        }
+        delete tspInstance;
+    }
+    std::cout << "Testing final nodes with n - 1 and fewer edges on the path reached...";
+    if (isTourNodeReached && isShortFinalNodeReached) {
+        std::cout << "SUCCESS" << std::endl;
+    } else {
+        std::cout << "FAIL" << std::endl;
+    }
+
+    // Every node allocated by a search is released by it, also when the search stops with open nodes
+    using Strategy = TSPExactAlgorithms::BBSearchStrategy;
+    for (const auto &instancePath : instancePaths) {
+        IGraph *tspInstance = nullptr;
+        TSPUtils::loadTSPInstance(&tspInstance, instancePath);
+        std::cout << "Testing release of nodes on " << instancePath << "...";
+        TSPExactAlgorithms::bbUnreleasedNodes = 0;
+        std::vector<int> solution;
+        TSPExactAlgorithms::branchAndBound(tspInstance, solution);
+        solution.clear();
+        TSPExactAlgorithms::branchAndBound0Heuristics(tspInstance, solution);
+        solution.clear();
+        TSPExactAlgorithms::branchAndBound(tspInstance, solution, Strategy::DepthFirst);
+        solution.clear();
+        TSPExactAlgorithms::branchAndBound(tspInstance, solution, Strategy::Hybrid, 0);
+        solution.clear();
+        TSPExactAlgorithms::branchAndBoundParallel(*tspInstance, solution, 2);
+        // Search stopped at once, by an upper bound which no node can beat
+        solution.clear();
+        TSPExactAlgorithms::bbSearch(*tspInstance, 0, solution);
+        if (TSPExactAlgorithms::bbUnreleasedNodes == 0) {
+            std::cout << "SUCCESS" << std::endl;
+        } else {
+            std::cout << "FAIL" << " [Unreleased nodes: " << TSPExactAlgorithms::bbUnreleasedNodes << "]"
+                      << std::endl;
+        }
+        delete tspInstance;
+    }
+}
+
+void TSPAlgorithmsTest::branchAndBoundSearchStrategyTest() const {
+    std::map<std::string, std::vector<std::string>> fileGroups;
+    std::vector<std::string> filePaths;
+
+    // MY
+    filePaths.emplace_back("my_opt.txt");
+    filePaths.emplace_back("mdata2.txt");
+    filePaths.emplace_back("mdata3.txt");
+    filePaths.emplace_back("mdata4.txt");
+    filePaths.emplace_back("mdata5.txt");
+    fileGroups.insert({"MY", filePaths});
+    filePaths.clear();
+
+    // ATSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data34.txt");
+    filePaths.emplace_back("data36.txt");
+    fileGroups.insert({"ATSP", filePaths});
+    filePaths.clear();
+
+    // SMALL
+    filePaths.emplace_back("opt.txt");
+    filePaths.emplace_back("data10.txt");
+    filePaths.emplace_back("data11.txt");
+    filePaths.emplace_back("data12.txt");
+    filePaths.emplace_back("data13.txt");
+    filePaths.emplace_back("data14.txt");
+    filePaths.emplace_back("data15.txt");
+    filePaths.emplace_back("data16.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data18.txt");
+    fileGroups.insert({"SMALL", filePaths});
+    filePaths.clear();
+
+    // TSP
+    filePaths.emplace_back("best.txt");
+    filePaths.emplace_back("data17.txt");
+    filePaths.emplace_back("data21.txt");
+    filePaths.emplace_back("data24.txt");
+    fileGroups.insert({"TSP", filePaths});
+    filePaths.clear();
+
+    testExactOrGreedyAlgorithm(fileGroups, TSPExactAlgorithms::branchAndBoundDepthFirst, false,
+                               "branchAndBoundDepthFirst");
+    testExactOrGreedyAlgorithm(fileGroups, TSPExactAlgorithms::branchAndBoundHybrid, false, "branchAndBoundHybrid");
+
+    // Hybrid search dives whenever open nodes exceed the budget, the optimum does not depend on it
+    using Strategy = TSPExactAlgorithms::BBSearchStrategy;
+    IGraph *tspInstance = nullptr;
+    TSPUtils::loadTSPInstance(&tspInstance, "ATSP/data34.txt");
+    std::vector<int> solution;
+    const int expectedSolutionValue = TSPExactAlgorithms::branchAndBound(tspInstance, solution);
+    for (std::size_t memoryBudget : {std::size_t(0), std::size_t(1) << 12, std::size_t(1) << 16}) {
+        std::cout << "Testing ATSP/data34.txt with memory budget of " << memoryBudget << " B...";
+        solution.clear();
+        const int solutionValue = TSPExactAlgorithms::branchAndBound(tspInstance, solution, Strategy::Hybrid,
+                                                                     memoryBudget);
+        if (solutionValue == expectedSolutionValue &&
+            TSPUtils::isSolutionValid(tspInstance, solution, solutionValue)) {
+            std::cout << "SUCCESS" << std::endl;
+        } else {
+            std::cout << "FAIL" << " [Returned solution cost: " << solutionValue << "]" << std::endl;
+        }
+    }
+    delete tspInstance;
+
+    // Started without a tour, the search outgrows small budgets before any tour is known - tours found in dives
+    // prune the open list below the budget again, which ends the dives before their subtrees are searched
+    for (const char *instancePath : {"SMALL/data14.txt", "TSP/data17.txt", "ATSP/data34.txt"}) {
+        std::cout << "Testing dives ended by pruning on " << instancePath << "...";
+        TSPUtils::loadTSPInstance(&tspInstance, instancePath);
+        solution.clear();
+        const int instanceSolutionValue = TSPExactAlgorithms::branchAndBound(tspInstance, solution);
+        bool areSolutionsOptimal = true;
+        TSPExactAlgorithms::bbInterruptedDives = 0;
+        for (std::size_t nBudgetNodes = 8; nBudgetNodes <= 1024; nBudgetNodes *= 2) {
+            solution.clear();
+            const int solutionValue = TSPExactAlgorithms::bbSearch(*tspInstance, std::numeric_limits<int>::max(),
+                                                                   solution, Strategy::Hybrid,
+                                                                   nBudgetNodes * (sizeof(BBNode) + sizeof(BBNode *)));
+            areSolutionsOptimal = areSolutionsOptimal && solutionValue == instanceSolutionValue &&
+                                  TSPUtils::isSolutionValid(tspInstance, solution, solutionValue);
+        }
+        if (areSolutionsOptimal && TSPExactAlgorithms::bbInterruptedDives > 0) {
+            std::cout << "SUCCESS" << " [Interrupted dives: " << TSPExactAlgorithms::bbInterruptedDives << "]"
+                      << std::endl;
+        } else {
+            std::cout << "FAIL" << " [Interrupted dives: " << TSPExactAlgorithms::bbInterruptedDives << "]"
+                      << std::endl;
+        }
+        delete tspInstance;
+    }
+}
+
 void TSPAlgorithmsTest::testExactOrGreedyAlgorithm(const std::map<std::string, std::vector<std::string>> &instanceFiles,
                                                    int (*tspAlgorithm)(const IGraph *, std::vector<int> &),
                                                    bool isSolutionApproximated, const std::string &testName) const {
@@ -2,6 +2,8 @@
 #define PEA_P1_TSPALGORITHMSTEST_H
 
 #include <vector>
+#include <functional>
+#include <memory>
 
 #include "../utilities/TSPUtils.h"
 #include "../algorithms/TSPExactAlgorithms.h"
@@ -22,7 +24,13 @@ private:
     void bruteForceTest() const;
     void bruteForceTreeTest() const;
     void dynamicProgrammingHeldKarpTest() const;
+    void dynamicProgrammingHeldKarpParallelTest() const;
+    void dynamicProgrammingHeldKarpCompactTest() const;
+    void dynamicProgrammingHeldKarpPrunedTest() const;
     void branchAndBoundTest() const;
+    void branchAndBoundParallelTest() const;
+    void branchAndBoundNodesTest() const;
+    void branchAndBoundSearchStrategyTest() const;
 
     //endregion
 
@@ -0,0 +1,298 @@
+#include "TSPLIBInstanceTest.h"
+
+#define pStartInfo(method) cout << "##### TSPLIBInstanceTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% TSPLIBInstanceTest::" << (method) << "() end %%%%%" << endl << endl
+
+void TSPLIBInstanceTest::run() {
+    pStartInfo("testCoordinateGraph");
+    testCoordinateGraph();
+    pEndInfo("testCoordinateGraph");
+
+    pStartInfo("testCostBatches");
+    testCostBatches();
+    pEndInfo("testCostBatches");
+
+    pStartInfo("testRowCache");
+    testRowCache();
+    pEndInfo("testRowCache");
+
+    pStartInfo("testInvalidFiles");
+    testInvalidFiles();
+    pEndInfo("testInvalidFiles");
+
+    pStartInfo("testLoadExplicitInstance");
+    testLoadExplicitInstance("TSPLIB/gr17.tsp", "TSP/data17.txt", TSPUtils::TSPType::Symmetric);
+    testLoadExplicitInstance("TSPLIB/gr21.tsp", "TSP/data21.txt", TSPUtils::TSPType::Symmetric);
+    testLoadExplicitInstance("TSPLIB/gr21.tsp", "TSP/data21.txt", TSPUtils::TSPType::Asymmetric);
+    testLoadExplicitInstance("TSPLIB/br17.atsp", "ATSP/data17.txt", TSPUtils::TSPType::Asymmetric);
+    pEndInfo("testLoadExplicitInstance");
+
+    pStartInfo("testLoadCoordinateInstance");
+    testLoadCoordinateInstance();
+    pEndInfo("testLoadCoordinateInstance");
+
+    pStartInfo("testLoadLargeCoordinateInstance");
+    testLoadLargeCoordinateInstance();
+    pEndInfo("testLoadLargeCoordinateInstance");
+}
+
+void TSPLIBInstanceTest::testCoordinateGraph() {
+    const double x[] = {0, 3, 1, 30};
+    const double y[] = {0, 4, 1, 40};
+    CoordinateGraph euclidean(IGraph::GraphType::Undirected, CoordinateGraph::Euclidean2D, x, y, 4);
+    assert(euclidean.getVertexCount() == 4);
+    assert(euclidean.getEdgeCount() == 6);
+    assert(euclidean.getGraphStructure() == IGraph::GraphStructure::NodeCoordinates);
+    assert(euclidean.getCost(0, 1) == 5 && euclidean.getCost(1, 0) == 5);
+    assert(euclidean.getCost(0, 2) == 1);
+    assert(euclidean.getCost(2, 2) == std::numeric_limits<int>::max());
+    cout << euclidean << endl;
+
+    CoordinateGraph ceiling(IGraph::GraphType::Directed, CoordinateGraph::CeilEuclidean2D, x, y, 4);
+    assert(ceiling.getEdgeCount() == 12);
+    assert(ceiling.getCost(0, 1) == 5 && ceiling.getCost(0, 2) == 2);
+
+    // sqrt(2500 / 10) = 15.8 and sqrt(25 / 10) = 1.58 are rounded up
+    CoordinateGraph pseudoEuclidean(IGraph::GraphType::Undirected, CoordinateGraph::PseudoEuclidean, x, y, 4);
+    assert(pseudoEuclidean.getCost(0, 3) == 16);
+    assert(pseudoEuclidean.getCost(0, 1) == 2);
+
+    auto costRow = euclidean.getCostRowView(0);
+    assert(costRow.getSize() == 4 && costRow[0] == std::numeric_limits<int>::max());
+    assert(costRow[1] == 5 && costRow[2] == 1 && costRow[3] == 50);
+    auto successors = euclidean.getSuccessorsView(2);
+    assert(successors.getSize() == 3 && successors[0] == 0 && successors[1] == 1 && successors[2] == 3);
+    assert(euclidean.getVertexPredecessors(1).getSize() == 3);
+
+    bool hasThrown = false;
+    try {
+        euclidean.setEdgeParameter(0, 1, 7);
+    } catch (const std::logic_error &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown && euclidean.getCost(0, 1) == 5);
+}
+
+void TSPLIBInstanceTest::testCostBatches() {
+    // Odd count, so that every kernel leaves a tail
+    const int nVertex = 37;
+    std::vector<double> x(nVertex), y(nVertex);
+    for (int i = 0; i < nVertex; ++i) {
+        x[i] = Random::getReal(-90, 90);
+        y[i] = Random::getReal(-180, 180);
+    }
+    // Integer coordinates put many distances exactly between two integers
+    x[1] = 0, y[1] = 0, x[2] = 3, y[2] = 4, x[3] = 30, y[3] = 40;
+
+    const bool isAVX2Used = CoordinateGraph::useAVX2;
+    for (const bool useAVX2 : {false, isAVX2Used}) {
+        CoordinateGraph::useAVX2 = useAVX2;
+        for (const auto distanceFunction : {CoordinateGraph::Euclidean2D, CoordinateGraph::CeilEuclidean2D,
+                                            CoordinateGraph::Geographic, CoordinateGraph::PseudoEuclidean}) {
+            CoordinateGraph graph(IGraph::GraphType::Directed, distanceFunction, x.data(), y.data(), nVertex);
+            std::vector<int> row(nVertex);
+            for (int i = 0; i < nVertex; ++i) {
+                graph.computeCostRow(i, row.data());
+                for (int j = 0; j < nVertex; ++j) {
+                    assert(row[j] == graph.getCost(i, j));
+                }
+            }
+
+            std::vector<int> starts(2 * nVertex + 1), ends(2 * nVertex + 1), costs(2 * nVertex + 1);
+            for (std::size_t k = 0; k < starts.size(); ++k) {
+                starts[k] = Random::getInt(0, nVertex - 1);
+                // Some pairs are loops
+                ends[k] = (k % 5 == 0) ? starts[k] : Random::getInt(0, nVertex - 1);
+            }
+            graph.computeCosts(starts.data(), ends.data(), static_cast<int>(starts.size()), costs.data());
+            for (std::size_t k = 0; k < starts.size(); ++k) {
+                assert(costs[k] == graph.getCost(starts[k], ends[k]));
+            }
+
+            std::vector<int> tour(nVertex);
+            long long tourCost = graph.getCost(nVertex - 1, 0);
+            for (int i = 0; i < nVertex; ++i) {
+                tour[i] = i;
+                tourCost += (i + 1 < nVertex) ? graph.getCost(i, i + 1) : 0;
+            }
+            assert(TSPUtils::calculateTargetFunctionValue(graph, tour) == tourCost);
+        }
+    }
+    CoordinateGraph::useAVX2 = isAVX2Used;
+}
+
+void TSPLIBInstanceTest::testRowCache() {
+    const double x[] = {0, 3, 1, 30};
+    const double y[] = {0, 4, 1, 40};
+    CoordinateGraph graph(IGraph::GraphType::Undirected, CoordinateGraph::Euclidean2D, x, y, 4);
+    graph.setRowCacheCapacity(2);
+    auto cachedRowIDs = [&graph]() {
+        std::vector<int> vertexIDs;
+        for (const auto &row : graph.rowCache) {
+            vertexIDs.push_back(row.vertexID);
+        }
+        std::sort(vertexIDs.begin(), vertexIDs.end());
+        return vertexIDs;
+    };
+
+    for (const int vertexID : {0, 1, 0, 2}) {
+        auto costRow = graph.getCostRowView(vertexID);
+        for (int j = 0; j < 4; ++j) {
+            assert(costRow[j] == graph.getCost(vertexID, j));
+        }
+    }
+    // Row 1 was used least recently
+    assert((cachedRowIDs() == std::vector<int>{0, 2}));
+    auto costRow = graph.getCostRowView(1);
+    assert(costRow.isOwning() && costRow[0] == 5 && costRow[3] == 45);
+    assert((cachedRowIDs() == std::vector<int>{1, 2}));
+
+    graph.setRowCacheCapacity(0);
+    assert(graph.rowCache.empty() && graph.getCostRowView(2)[3] == 49);
+}
+
+void TSPLIBInstanceTest::testInvalidFiles() {
+    const std::vector<std::string> invalidFiles = {
+            // Unsupported type
+            "NAME: a\nTYPE: HCP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n1 0 0\n2 1 1\nEOF\n",
+            "NAME: a\nTYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: MAN_2D\nNODE_COORD_SECTION\n1 0 0\n2 1 1\nEOF\n",
+            // Repeated and missing vertex
+            "NAME: a\nTYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n1 0 0\n1 1 1\nEOF\n",
+            // Too few costs
+            "NAME: a\nTYPE: ATSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EXPLICIT\nEDGE_WEIGHT_FORMAT: FULL_MATRIX\n"
+            "EDGE_WEIGHT_SECTION\n0 1 2\nEOF\n",
+            // No section with costs
+            "NAME: a\nTYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_2D\nEOF\n"};
+    for (const auto &file : invalidFiles) {
+        TSPLIBInstance::Contents contents;
+        bool hasThrown = false;
+        try {
+            TSPLIBInstance::parse(file.data(), file.data() + file.size(), contents);
+        } catch (const std::invalid_argument &e) {
+            hasThrown = true;
+        }
+        assert(hasThrown);
+    }
+
+    // Costs are followed by other section, coordinates may be real numbers in any order
+    const std::string validFile = "NAME: b\nTYPE: TSP\nDIMENSION: 3\nEDGE_WEIGHT_TYPE: EXPLICIT\n"
+                                  "EDGE_WEIGHT_FORMAT: UPPER_DIAG_ROW\nEDGE_WEIGHT_SECTION\n0 1 2\n0 3\n0\n"
+                                  "DISPLAY_DATA_SECTION\n 3 1.5e1 -2.25\n 1 0 0\n 2 +1 1\nEOF\n";
+    TSPLIBInstance::Contents contents;
+    TSPLIBInstance::parse(validFile.data(), validFile.data() + validFile.size(), contents);
+    assert(contents.instanceName == "b" && contents.vertexCount == 3 && contents.isSymmetric);
+    assert((contents.costMatrix == std::vector<int>{-1, 1, 2, 1, -1, 3, 2, 3, -1}));
+
+    const std::string coordinateFile = "NAME: c\nTYPE: TSP\nDIMENSION: 3\nEDGE_WEIGHT_TYPE: CEIL_2D\n"
+                                       "NODE_COORD_SECTION\n 3 1.5e1 -2.25\n 1 0 0\n 2 +1 1\n";
+    TSPLIBInstance::parse(coordinateFile.data(), coordinateFile.data() + coordinateFile.size(), contents);
+    assert(!contents.isExplicit && contents.distanceFunction == CoordinateGraph::CeilEuclidean2D);
+    assert((contents.x == std::vector<double>{0, 1, 15}) && (contents.y == std::vector<double>{0, 1, -2.25}));
+}
+
+void TSPLIBInstanceTest::testLoadExplicitInstance(const std::string &tsplibFile, const std::string &textFile,
+                                                  TSPUtils::TSPType tspType) {
+    cout << "Instance \"" << tsplibFile << "\"...";
+    IGraph *listGraph = nullptr, *tsplibListGraph = nullptr, *tsplibMatrix = nullptr;
+    TSPUtils::loadTSPInstance(&listGraph, textFile, tspType);
+    const std::string instanceName = TSPUtils::loadTSPLIBInstance(&tsplibListGraph, tsplibFile, tspType,
+                                                                  IGraph::GraphStructure::AdjacencyList);
+    assert(instanceName == std::filesystem::path(tsplibFile).stem().string());
+    // Explicit instance has no coordinates
+    TSPUtils::loadTSPLIBInstance(&tsplibMatrix, tsplibFile, tspType);
+    assert(tsplibMatrix->getGraphStructure() == IGraph::GraphStructure::FlatMatrix);
+    for (const IGraph *graph : {tsplibListGraph, tsplibMatrix}) {
+        assert(graph->getVertexCount() == listGraph->getVertexCount());
+        assert(graph->getEdgeCount() == listGraph->getEdgeCount());
+        for (int i = 0; i < listGraph->getVertexCount(); ++i) {
+            for (int j = 0; j < listGraph->getVertexCount(); ++j) {
+                assert(graph->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+            }
+        }
+    }
+
+    if (tspType == TSPUtils::TSPType::Asymmetric) {
+        IGraph *symmetricGraph = nullptr;
+        bool hasThrown = false;
+        try {
+            TSPUtils::loadTSPLIBInstance(&symmetricGraph, tsplibFile, TSPUtils::TSPType::Symmetric);
+        } catch (const std::invalid_argument &e) {
+            hasThrown = true;
+        }
+        // Only ATSP files cannot be loaded as symmetric
+        assert(hasThrown == (tsplibFile.find(".atsp") != std::string::npos));
+        delete symmetricGraph;
+    }
+
+    delete listGraph;
+    delete tsplibListGraph;
+    delete tsplibMatrix;
+    cout << "SUCCESS" << endl;
+}
+
+void TSPLIBInstanceTest::testLoadCoordinateInstance() {
+    IGraph *coordinateGraph = nullptr, *flatMatrix = nullptr;
+    TSPUtils::loadTSPLIBInstance(&coordinateGraph, "TSPLIB/ulysses16.tsp", TSPUtils::TSPType::Symmetric);
+    TSPUtils::loadTSPLIBInstance(&flatMatrix, "TSPLIB/ulysses16.tsp", TSPUtils::TSPType::Asymmetric,
+                                 IGraph::GraphStructure::FlatMatrix);
+    assert(coordinateGraph->getGraphStructure() == IGraph::GraphStructure::NodeCoordinates);
+    assert(coordinateGraph->getVertexCount() == 16);
+    for (int i = 0; i < 16; ++i) {
+        for (int j = 0; j < 16; ++j) {
+            assert(flatMatrix->getEdgeParameter(i, j) == coordinateGraph->getEdgeParameter(i, j));
+        }
+    }
+
+    // Optimal tour listed in TSPLIB (vertices numbered from 1)
+    std::vector<int> optimalTour = {1, 14, 13, 12, 7, 6, 15, 5, 11, 9, 10, 16, 3, 2, 4, 8};
+    for (auto &vertex : optimalTour) {
+        --vertex;
+    }
+    assert(TSPUtils::calculateTargetFunctionValue(coordinateGraph, optimalTour) == 6859);
+    std::vector<int> solution, flatMatrixSolution;
+    assert(TSPExactAlgorithms::dynamicProgrammingHeldKarp(coordinateGraph, solution) == 6859);
+    solution.clear();
+    assert(TSPGreedyAlgorithms::nearestNeighbour(coordinateGraph, solution) ==
+           TSPGreedyAlgorithms::nearestNeighbour(flatMatrix, flatMatrixSolution));
+    assert(TSPUtils::areSolutionsEqual(solution, flatMatrixSolution));
+
+    delete coordinateGraph;
+    delete flatMatrix;
+}
+
+void TSPLIBInstanceTest::testLoadLargeCoordinateInstance() {
+    const int nVertex = 100'000;
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "pea_p1_tsplib_test.tsp";
+    std::vector<int> x(nVertex), y(nVertex);
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "NAME: random100k\nTYPE: TSP\nDIMENSION: " << nVertex << "\nEDGE_WEIGHT_TYPE: EUC_2D\n"
+             << "NODE_COORD_SECTION\n";
+        for (int i = 0; i < nVertex; ++i) {
+            x[i] = Random::getInt(0, 10'000);
+            y[i] = Random::getInt(0, 10'000);
+            file << i + 1 << ' ' << x[i] << ' ' << y[i] << '\n';
+        }
+        file << "EOF\n";
+    }
+
+    IGraph *graph = nullptr;
+    const std::string instanceName = TSPUtils::loadTSPLIBInstanceAbsolutePath(&graph, path.string(),
+                                                                             TSPUtils::TSPType::Symmetric);
+    assert(instanceName == "random100k");
+    assert(graph->getVertexCount() == nVertex);
+    // Tour visiting vertices in order of their IDs
+    std::vector<int> tour(nVertex);
+    long long expectedTourCost = 0;
+    for (int i = 0; i < nVertex; ++i) {
+        tour[i] = i;
+        const int next = (i + 1) % nVertex;
+        const double dx = x[i] - x[next], dy = y[i] - y[next];
+        expectedTourCost += static_cast<int>(std::sqrt(dx * dx + dy * dy) + 0.5);
+    }
+    assert(expectedTourCost < std::numeric_limits<int>::max());
+    assert(TSPUtils::calculateTargetFunctionValue(graph, tour) == expectedTourCost);
+
+    delete graph;
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,51 @@
+#ifndef PEA_P1_TSPLIBINSTANCETEST_H
+#define PEA_P1_TSPLIBINSTANCETEST_H
+
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../structures/graphs/CoordinateGraph.h"
+#include "../utilities/TSPLIBInstance.h"
+#include "../utilities/TSPUtils.h"
+#include "../utilities/Random.h"
+#include "../algorithms/TSPExactAlgorithms.h"
+#include "../algorithms/TSPGreedyAlgorithms.h"
+
+using std::cout;
+using std::endl;
+
+class TSPLIBInstanceTest {
+public:
+    void run();
+
+private:
+    // Costs of every distance function, computed by hand
+    void testCoordinateGraph();
+
+    // Batch methods against getCost(), with every available instruction set
+    void testCostBatches();
+
+    // Least recently used row is replaced
+    void testRowCache();
+
+    void testInvalidFiles();
+
+    // Compares every edge parameter with ListGraph loaded from the instance in the text format
+    void testLoadExplicitInstance(const std::string &tsplibFile, const std::string &textFile,
+                                  TSPUtils::TSPType tspType);
+
+    // ulysses16 (GEO), optimal tour cost is 6859
+    void testLoadCoordinateInstance();
+
+    // 100k vertices, far beyond any matrix structure
+    void testLoadLargeCoordinateInstance();
+};
+
+#endif //PEA_P1_TSPLIBINSTANCETEST_H
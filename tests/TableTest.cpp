@@ -0,0 +1,204 @@
+#include "TableTest.h"
+
+#define pStartInfo(method) cout << "##### TableTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% TableTest::" << (method) << "() end %%%%%" << endl << endl
+
+void TableTest::run() {
+    pStartInfo("testInsert");
+    testInsert();
+    pEndInfo("testInsert");
+
+    pStartInfo("testRemove");
+    testRemove();
+    pEndInfo("testRemove");
+
+    pStartInfo("testCopy");
+    testCopy();
+    pEndInfo("testCopy");
+
+    pStartInfo("testMove");
+    testMove();
+    pEndInfo("testMove");
+
+    pStartInfo("testReserveAndResize");
+    testReserveAndResize();
+    pEndInfo("testReserveAndResize");
+
+    pStartInfo("testEmplace");
+    testEmplace();
+    pEndInfo("testEmplace");
+
+    pStartInfo("testNestedTables");
+    testNestedTables();
+    pEndInfo("testNestedTables");
+}
+
+void TableTest::testInsert() {
+    Table<int> table;
+    table.insertAtEnd(2);
+    table.insertAtStart(0);
+    table.insert(1, 1);
+    table.insertAtEnd(3);
+    assert(table.getSize() == 4);
+    assert(table.getCapacity() == 4);
+    for (int i = 0; i < 4; ++i) {
+        assert(table[i] == i);
+    }
+    // Inserted value refers to element of the full table
+    table.insertAtEnd(table[0]);
+    assert(table.getSize() == 5);
+    assert(table.getCapacity() == 8);
+    assert(table[4] == 0);
+    table.insert(0, table[3]);
+    assert(table[0] == 3 && table[1] == 0 && table[4] == 3);
+
+    bool hasThrown = false;
+    try {
+        table.insert(7, 1);
+    } catch (const std::out_of_range &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void TableTest::testRemove() {
+    Table<int> table;
+    for (int i = 0; i < 8; ++i) {
+        table.insertAtEnd(i);
+    }
+    table.remove(3);
+    table.removeFromStart();
+    table.removeFromEnd();
+    assert(table.getSize() == 5);
+    assert(table[0] == 1 && table[2] == 4 && table[4] == 6);
+    table.remove(0);
+    table.remove(0);
+    table.remove(0);
+    assert(table.getSize() == 2);
+    assert(table.getCapacity() == 8);
+    assert(table[0] == 5 && table[1] == 6);
+    // Table is reduced once it gets sparse
+    table.removeFromEnd();
+    assert(table.getSize() == 1);
+    assert(table.getCapacity() == 4);
+    assert(table[0] == 5);
+    table.removeFromEnd();
+    assert(table.getSize() == 0);
+    assert(table.getCapacity() == 0);
+    assert(table.getData() == nullptr);
+
+    bool hasThrown = false;
+    try {
+        table.removeFromEnd();
+    } catch (const std::out_of_range &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void TableTest::testCopy() {
+    Table<int> table;
+    for (int i = 0; i < 5; ++i) {
+        table.insertAtEnd(i);
+    }
+    Table<int> tableCopy(table);
+    assert(tableCopy == table);
+    assert(tableCopy.getCapacity() == 5);
+    assert(tableCopy.getData() != table.getData());
+    tableCopy[0] = 10;
+    assert(table[0] == 0);
+
+    Table<int> assignedTable;
+    assignedTable.insertAtEnd(7);
+    assignedTable = table;
+    assert(assignedTable == table);
+    assignedTable = assignedTable;
+    assert(assignedTable == table);
+}
+
+void TableTest::testMove() {
+    Table<int> table;
+    for (int i = 0; i < 5; ++i) {
+        table.insertAtEnd(i);
+    }
+    const int *data = table.getData();
+    Table<int> movedTable(std::move(table));
+    assert(movedTable.getData() == data);
+    assert(movedTable.getSize() == 5);
+    assert(table.getSize() == 0 && table.getCapacity() == 0 && table.getData() == nullptr);
+
+    Table<int> assignedTable;
+    assignedTable.insertAtEnd(7);
+    assignedTable = std::move(movedTable);
+    assert(assignedTable.getData() == data);
+    assert(assignedTable[4] == 4);
+    assert(movedTable.getSize() == 0);
+}
+
+void TableTest::testReserveAndResize() {
+    Table<int> table;
+    table.reserve(100);
+    assert(table.getCapacity() == 100);
+    assert(table.getSize() == 0);
+    const int *data = table.getData();
+    for (int i = 0; i < 100; ++i) {
+        table.insertAtEnd(i);
+    }
+    assert(table.getData() == data);
+    table.reserve(10);
+    assert(table.getCapacity() == 100);
+
+    table.resize(120, -1);
+    assert(table.getSize() == 120);
+    assert(table[99] == 99 && table[100] == -1 && table[119] == -1);
+    table.resize(50);
+    assert(table.getSize() == 50);
+    assert(table.getCapacity() == 120);
+    table.resize(52);
+    assert(table[50] == 0 && table[51] == 0);
+    // Fill value refers to element of the table
+    table.resize(200, table[49]);
+    assert(table[199] == 49);
+}
+
+void TableTest::testEmplace() {
+    Table<Table<int>> table;
+    table.emplaceAtEnd().insertAtEnd(1);
+    table.emplaceAtEnd(table[0]).insertAtEnd(2);
+    assert(table.getSize() == 2);
+    assert(table[0].getSize() == 1);
+    assert(table[1].getSize() == 2 && table[1][1] == 2);
+
+    Table<int> row;
+    row.insertAtEnd(5);
+    table.insertAtEnd(std::move(row));
+    assert(table[2][0] == 5);
+    assert(row.getSize() == 0);
+}
+
+void TableTest::testNestedTables() {
+    Table<DoublyLinkedList<int>> lists;
+    for (int i = 0; i < 10; ++i) {
+        lists.insertAtStart(DoublyLinkedList<int>());
+        lists[0].insertAtEnd(i);
+    }
+    assert(lists[0].getLast() == 9 && lists[9].getLast() == 0);
+    lists.remove(4);
+    assert(lists.getSize() == 9);
+    assert(lists[4].getLast() == 4);
+
+    Table<Table<int>> matrix;
+    matrix.resize(10);
+    for (int i = 0; i < 10; ++i) {
+        matrix[i].resize(10, i);
+    }
+    Table<Table<int>> matrixCopy(matrix);
+    assert(matrixCopy == matrix);
+    for (int i = 0; i < 9; ++i) {
+        matrix.removeFromStart();
+    }
+    assert(matrix.getSize() == 1 && matrix[0][0] == 9);
+    assert(matrixCopy[0][9] == 0);
+    matrix.clear();
+    assert(matrix.getSize() == 0);
+}
@@ -0,0 +1,30 @@
+#ifndef PEA_P1_TABLETEST_H
+#define PEA_P1_TABLETEST_H
+
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include "../structures/Table.h"
+#include "../structures/DoublyLinkedList.h"
+
+using std::cout;
+using std::endl;
+
+class TableTest {
+public:
+    void run();
+
+private:
+    void testInsert();
+    void testRemove();
+    void testCopy();
+    void testMove();
+    void testReserveAndResize();
+    void testEmplace();
+    // Elements which are not trivially copyable
+    void testNestedTables();
+};
+
+#endif //PEA_P1_TABLETEST_H
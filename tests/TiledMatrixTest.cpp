@@ -0,0 +1,149 @@
+#include "TiledMatrixTest.h"
+
+#define pStartInfo(method) cout << "##### TiledMatrixTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% TiledMatrixTest::" << (method) << "() end %%%%%" << endl << endl
+
+void TiledMatrixTest::run() {
+    pStartInfo("testTiledMatrix");
+    testTiledMatrix(5, TiledMatrix::Tiles);
+    testTiledMatrix(37, TiledMatrix::Tiles);
+    testTiledMatrix(37, TiledMatrix::MortonTiles);
+    testTiledMatrix(300, TiledMatrix::MortonTiles);
+    pEndInfo("testTiledMatrix");
+
+    pStartInfo("testAddEdge");
+    testAddEdge();
+    pEndInfo("testAddEdge");
+
+    pStartInfo("testRemoveEdge");
+    testRemoveEdge();
+    pEndInfo("testRemoveEdge");
+
+    pStartInfo("testGetVertexSuccessors");
+    testGetVertexSuccessors();
+    pEndInfo("testGetVertexSuccessors");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("ATSP/data17.txt", IGraph::GraphStructure::TiledFlatMatrix);
+    testLoadTSPInstance("ATSP/data443.txt", IGraph::GraphStructure::TiledFlatMatrix);
+    testLoadTSPInstance("ATSP/data443.txt", IGraph::GraphStructure::MortonFlatMatrix);
+    pEndInfo("testLoadTSPInstance");
+}
+
+void TiledMatrixTest::testTiledMatrix(int nVertex, TiledMatrix::Layout layout) {
+    TiledMatrix tm(IGraph::GraphType::Directed, nVertex, layout);
+    assert(tm.getVertexCount() == nVertex);
+    assert(tm.getEdgeCount() == 0);
+    assert(tm.getLayout() == layout);
+    assert(tm.paddedVertexCount >= nVertex && tm.paddedVertexCount % TiledMatrix::TILE_SIDE == 0);
+
+    const std::size_t bufferSize = static_cast<std::size_t>(tm.paddedVertexCount) * tm.paddedVertexCount;
+    std::vector<int> positionUses(bufferSize, 0);
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            const std::size_t position = tm.rowOffsets[i] + tm.columnOffsets[j];
+            assert(position < bufferSize);
+            ++positionUses[position];
+        }
+    }
+    for (int i = 0; i < nVertex; ++i) {
+        for (int j = 0; j < nVertex; ++j) {
+            assert(positionUses[tm.rowOffsets[i] + tm.columnOffsets[j]] == 1);
+        }
+    }
+    // Vertices of one tile row share a cache line
+    if (nVertex > TiledMatrix::TILE_SIDE) {
+        assert(tm.columnOffsets[TiledMatrix::TILE_SIDE - 1] - tm.columnOffsets[0] == TiledMatrix::TILE_SIDE - 1);
+    }
+}
+
+void TiledMatrixTest::testAddEdge() {
+    TiledMatrix tm(IGraph::GraphType::Undirected, 40, TiledMatrix::MortonTiles);
+    tm.addEdge(0, 33, 5);
+    tm.addEdge(33, 2, 10);
+    tm.addEdge(17, 0, 25);
+    assert(tm.getCost(0, 33) == 5);
+    assert(tm.getCost(33, 0) == 5);
+    assert(tm.getCost(2, 33) == 10);
+    assert(tm.getCost(0, 17) == 25);
+    assert(tm.getCost(1, 2) == std::numeric_limits<int>::max());
+    assert(tm.getEdgeCount() == 3);
+    assert(tm.getGraphStructure() == IGraph::GraphStructure::MortonFlatMatrix);
+
+    bool hasThrown = false;
+    try {
+        tm.addEdge(33, 0, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    hasThrown = false;
+    try {
+        tm.addEdge(2, 2, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+    assert(tm.getEdgeCount() == 3);
+}
+
+void TiledMatrixTest::testRemoveEdge() {
+    TiledMatrix tm(IGraph::GraphType::Directed, 5);
+    tm.addEdge(0, 3, 5);
+    tm.addEdge(3, 0, 7);
+    tm.removeEdge(0, 3);
+    assert(tm.getCost(0, 3) == std::numeric_limits<int>::max());
+    assert(tm.getCost(3, 0) == 7);
+    assert(tm.getEdgeCount() == 1);
+    cout << tm << endl;
+
+    bool hasThrown = false;
+    try {
+        tm.removeEdge(0, 3);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void TiledMatrixTest::testGetVertexSuccessors() {
+    TiledMatrix tm(IGraph::GraphType::Directed, 20);
+    tm.addEdge(3, 0, 5);
+    tm.addEdge(3, 19, 10);
+    tm.addEdge(4, 3, 25);
+    DoublyLinkedList<int> successors = tm.getVertexSuccessors(3);
+    assert(successors.getSize() == 2);
+    assert(successors.contains(0) && successors.contains(19));
+    assert(tm.getVertexPredecessors(3).getSize() == 1 && tm.getVertexPredecessors(3).contains(4));
+    // Row is gathered from two tiles
+    auto costRow = tm.getCostRowView(3);
+    assert(costRow.isOwning() && costRow.getSize() == 20);
+    assert(costRow[0] == 5 && costRow[19] == 10 && costRow[4] == std::numeric_limits<int>::max());
+    assert(tm.getSuccessorsView(3).getSize() == 2);
+}
+
+void TiledMatrixTest::testLoadTSPInstance(const std::string &instanceFile, IGraph::GraphStructure graphStructure) {
+    cout << "Instance \"" << instanceFile << "\"...";
+    IGraph *listGraph = nullptr, *tiledMatrix = nullptr;
+    TSPUtils::loadTSPInstance(&listGraph, instanceFile, TSPUtils::TSPType::Asymmetric);
+    TSPUtils::loadTSPInstance(&tiledMatrix, instanceFile, TSPUtils::TSPType::Asymmetric, graphStructure);
+    assert(tiledMatrix->getGraphStructure() == graphStructure);
+    assert(tiledMatrix->getVertexCount() == listGraph->getVertexCount());
+    assert(tiledMatrix->getEdgeCount() == listGraph->getEdgeCount());
+    for (int i = 0; i < listGraph->getVertexCount(); ++i) {
+        for (int j = 0; j < listGraph->getVertexCount(); ++j) {
+            assert(tiledMatrix->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+        }
+    }
+
+    std::vector<int> listSolution, tiledSolution;
+    int listSolutionValue = TSPGreedyAlgorithms::greedy(listGraph, listSolution);
+    int tiledSolutionValue = TSPGreedyAlgorithms::greedy(tiledMatrix, tiledSolution);
+    assert(listSolutionValue == tiledSolutionValue);
+    assert(TSPUtils::isSolutionValid(tiledMatrix, tiledSolution, tiledSolutionValue));
+
+    delete listGraph;
+    delete tiledMatrix;
+    cout << "SUCCESS" << endl;
+}
@@ -0,0 +1,32 @@
+#ifndef PEA_P1_TILEDMATRIXTEST_H
+#define PEA_P1_TILEDMATRIXTEST_H
+
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../structures/graphs/TiledMatrix.h"
+#include "../utilities/TSPUtils.h"
+#include "../algorithms/TSPGreedyAlgorithms.h"
+
+using std::cout;
+using std::endl;
+
+class TiledMatrixTest {
+public:
+    void run();
+
+private:
+    // Every vertex pair has its own place in the buffer, for both layouts
+    void testTiledMatrix(int nVertex, TiledMatrix::Layout layout);
+    void testAddEdge();
+    void testRemoveEdge();
+    void testGetVertexSuccessors();
+
+    // Compares every edge parameter and solutions of algorithms with ListGraph loaded from the same file
+    void testLoadTSPInstance(const std::string &instanceFile, IGraph::GraphStructure graphStructure);
+};
+
+#endif //PEA_P1_TILEDMATRIXTEST_H
@@ -0,0 +1,171 @@
+#include "TriangularMatrixTest.h"
+
+#define pStartInfo(method) cout << "##### TriangularMatrixTest::" << (method) << "() start #####" << endl
+#define pEndInfo(method) cout << "%%%%% TriangularMatrixTest::" << (method) << "() end %%%%%" << endl << endl
+
+void TriangularMatrixTest::run() {
+    pStartInfo("testTriangularMatrix");
+    testTriangularMatrix();
+    pEndInfo("testTriangularMatrix");
+
+    pStartInfo("testAddEdge");
+    testAddEdge();
+    pEndInfo("testAddEdge");
+
+    pStartInfo("testRemoveEdge");
+    testRemoveEdge();
+    pEndInfo("testRemoveEdge");
+
+    pStartInfo("testGetVertexSuccessors");
+    testGetVertexSuccessors();
+    pEndInfo("testGetVertexSuccessors");
+
+    pStartInfo("testGetEdgeParameter");
+    testGetEdgeParameter();
+    pEndInfo("testGetEdgeParameter");
+
+    pStartInfo("testLoadTSPInstance");
+    testLoadTSPInstance("TSP/data17.txt");
+    testLoadTSPInstance("TSP/data120.txt");
+    testLoadTSPInstance("SMALL/data10.txt");
+    pEndInfo("testLoadTSPInstance");
+}
+
+void TriangularMatrixTest::testTriangularMatrix() {
+    TriangularMatrix tm(IGraph::GraphType::Undirected, 5);
+    assert(tm.getVertexCount() == 5);
+    assert(tm.getEdgeCount() == 0);
+    assert(tm.getGraphType() == IGraph::GraphType::Undirected);
+    assert(tm.getGraphStructure() == IGraph::GraphStructure::PackedTriangular);
+
+    // Every vertex pair (and diagonal) has its own, unique place in the buffer
+    std::vector<int> indexUses(5 * 6 / 2, 0);
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j <= i; ++j) {
+            assert(TriangularMatrix::packedIndex(i, j) == TriangularMatrix::packedIndex(j, i));
+            ++indexUses[TriangularMatrix::packedIndex(i, j)];
+        }
+    }
+    for (const auto &uses : indexUses) {
+        assert(uses == 1);
+    }
+
+    bool hasThrown = false;
+    try {
+        TriangularMatrix directedMatrix(IGraph::GraphType::Directed, 5);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void TriangularMatrixTest::testAddEdge() {
+    TriangularMatrix tm(IGraph::GraphType::Undirected, 5);
+    tm.addEdge(0, 3, 5);
+    tm.addEdge(3, 2, 10);
+    tm.addEdge(4, 0, 25);
+    assert(tm.getCost(0, 3) == 5);
+    assert(tm.getCost(3, 0) == 5);
+    assert(tm.getCost(2, 3) == 10);
+    assert(tm.getCost(0, 4) == 25);
+    assert(tm.getEdgeCount() == 3);
+    cout << tm << endl;
+
+    bool hasThrown = false;
+    try {
+        tm.addEdge(3, 0, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+
+    hasThrown = false;
+    try {
+        tm.addEdge(2, 2, 1);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+    assert(tm.getEdgeCount() == 3);
+}
+
+void TriangularMatrixTest::testRemoveEdge() {
+    TriangularMatrix tm(IGraph::GraphType::Undirected, 5);
+    tm.addEdge(0, 3, 5);
+    tm.addEdge(1, 2, 7);
+    tm.removeEdge(3, 0);
+    assert(tm.getCost(0, 3) == std::numeric_limits<int>::max());
+    assert(tm.getEdgeCount() == 1);
+
+    bool hasThrown = false;
+    try {
+        tm.removeEdge(0, 3);
+    } catch (const std::invalid_argument &e) {
+        hasThrown = true;
+    }
+    assert(hasThrown);
+}
+
+void TriangularMatrixTest::testGetVertexSuccessors() {
+    TriangularMatrix tm(IGraph::GraphType::Undirected, 5);
+    tm.addEdge(0, 3, 5);
+    tm.addEdge(3, 2, 10);
+    tm.addEdge(4, 3, 25);
+    DoublyLinkedList<int> successors = tm.getVertexSuccessors(3);
+    assert(successors.getSize() == 3);
+    assert(successors.contains(0) && successors.contains(2) && successors.contains(4));
+    assert(tm.getVertexPredecessors(1).getSize() == 0);
+    // Row is gathered from packed row 3 and column 3
+    auto costRow = tm.getCostRowView(3);
+    assert(costRow.isOwning() && costRow.getSize() == 5);
+    assert(costRow[0] == 5 && costRow[1] == std::numeric_limits<int>::max() && costRow[2] == 10);
+    assert(costRow[3] == std::numeric_limits<int>::max() && costRow[4] == 25);
+    assert(tm.getSuccessorsView(3).getSize() == 3);
+}
+
+void TriangularMatrixTest::testGetEdgeParameter() {
+    TriangularMatrix tm(IGraph::GraphType::Undirected, 4);
+    tm.addEdge(0, 1, 0);
+    tm.addEdge(2, 1, 100);
+    assert(tm.getEdgeParameter(1, 0) == 0);
+    assert(tm.getEdgeParameter(1, 2) == 100);
+    assert(tm.getEdgeParameter(3, 1) == std::numeric_limits<int>::max());
+    assert(tm.getEdgeParameter(2, 2) == std::numeric_limits<int>::max());
+    tm.setEdgeParameter(1, 2, 12);
+    assert(tm.getEdgeParameter(2, 1) == 12);
+}
+
+void TriangularMatrixTest::testLoadTSPInstance(const std::string &instanceFile) {
+    cout << "Instance \"" << instanceFile << "\"...";
+    IGraph *listGraph = nullptr, *triangularMatrix = nullptr;
+    TSPUtils::loadTSPInstance(&listGraph, instanceFile, TSPUtils::TSPType::Symmetric);
+    TSPUtils::loadTSPInstance(&triangularMatrix, instanceFile, TSPUtils::TSPType::Symmetric,
+                              IGraph::GraphStructure::PackedTriangular);
+    assert(triangularMatrix->getGraphStructure() == IGraph::GraphStructure::PackedTriangular);
+    assert(triangularMatrix->getVertexCount() == listGraph->getVertexCount());
+    assert(triangularMatrix->getEdgeCount() == listGraph->getEdgeCount());
+    for (int i = 0; i < listGraph->getVertexCount(); ++i) {
+        for (int j = 0; j < listGraph->getVertexCount(); ++j) {
+            assert(triangularMatrix->getEdgeParameter(i, j) == listGraph->getEdgeParameter(i, j));
+        }
+    }
+
+    std::vector<int> listSolution, triangularSolution;
+    int listSolutionValue = TSPGreedyAlgorithms::greedy(listGraph, listSolution);
+    int triangularSolutionValue = TSPGreedyAlgorithms::greedy(triangularMatrix, triangularSolution);
+    assert(listSolutionValue == triangularSolutionValue);
+    assert(TSPUtils::isSolutionValid(triangularMatrix, triangularSolution, triangularSolutionValue));
+
+    if (listGraph->getVertexCount() <= 17) {
+        listSolution.clear();
+        triangularSolution.clear();
+        listSolutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarp(listGraph, listSolution);
+        triangularSolutionValue = TSPExactAlgorithms::dynamicProgrammingHeldKarp(triangularMatrix,
+                                                                                 triangularSolution);
+        assert(listSolutionValue == triangularSolutionValue);
+    }
+
+    delete listGraph;
+    delete triangularMatrix;
+    cout << "SUCCESS" << endl;
+}
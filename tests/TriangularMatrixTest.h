@@ -0,0 +1,32 @@
+#ifndef PEA_P1_TRIANGULARMATRIXTEST_H
+#define PEA_P1_TRIANGULARMATRIXTEST_H
+
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include "../structures/graphs/TriangularMatrix.h"
+#include "../utilities/TSPUtils.h"
+#include "../algorithms/TSPGreedyAlgorithms.h"
+#include "../algorithms/TSPExactAlgorithms.h"
+
+using std::cout;
+using std::endl;
+
+class TriangularMatrixTest {
+public:
+    void run();
+
+private:
+    void testTriangularMatrix();
+    void testAddEdge();
+    void testRemoveEdge();
+    void testGetVertexSuccessors();
+    void testGetEdgeParameter();
+
+    // Compares every edge parameter and solutions of algorithms with ListGraph loaded from the same file
+    void testLoadTSPInstance(const std::string &instanceFile);
+};
+
+#endif //PEA_P1_TRIANGULARMATRIXTEST_H
@@ -0,0 +1,510 @@
+#include "PerformanceBenchmark.h"
+
+void PerformanceBenchmark::run() const {
+    benchmarkSwapMoves("ATSP/data443.txt");
+    benchmarkSwapMoves("TSP/data120.txt");
+    benchmarkTable(10'000'000, 2'000);
+    benchmarkDoublyLinkedList(2'000, 443);
+    benchmarkNeighbourIteration("ATSP/data443.txt");
+    benchmarkMatrixLayouts(1'000);
+    benchmarkMatrixLayouts(5'000);
+    benchmarkMatrixLayouts(10'000);
+    benchmarkMappedMatrix(5'000);
+    benchmarkMappedMatrix(10'000);
+}
+
+void PerformanceBenchmark::benchmarkSwapMoves(const std::string &instancePath) const {
+    IGraph *listInstance = nullptr;
+    IGraph *matrixInstance = nullptr;
+    IGraph *quantizedInstance = nullptr;
+    TSPUtils::loadTSPInstance(&listInstance, instancePath, TSPUtils::TSPType::Asymmetric,
+                              IGraph::GraphStructure::AdjacencyList);
+    TSPUtils::loadTSPInstance(&matrixInstance, instancePath, TSPUtils::TSPType::Asymmetric,
+                              IGraph::GraphStructure::FlatMatrix);
+    TSPUtils::loadTSPInstance(&quantizedInstance, instancePath, TSPUtils::TSPType::Asymmetric,
+                              IGraph::GraphStructure::QuantizedFlatMatrix);
+
+    const int nVertex = listInstance->getVertexCount();
+    std::vector<std::pair<int, int>> moves;
+    moves.reserve(MOVES_NUMBER);
+    while (moves.size() < MOVES_NUMBER) {
+        int i = Random::getInt(0, nVertex - 1);
+        int j = Random::getInt(0, nVertex - 1);
+        if (i != j) {
+            moves.emplace_back(i, j);
+        }
+    }
+
+    cout << std::string(10, '-') << "Swap moves/s on \"" + instancePath + "\" (n = " << nVertex << ")"
+         << std::string(10, '-') << endl;
+
+    // Every variant evaluates the same moves, so checksums have to be equal
+    long long checksums[5];
+    const double virtualListMoves = measureSwapMoves<IGraph>(*listInstance, moves, checksums[0]);
+    const double listMoves = measureSwapMoves(*dynamic_cast<const ListGraph *>(listInstance), moves, checksums[1]);
+    const double matrixMoves = measureSwapMoves(*dynamic_cast<const DistanceMatrix *>(matrixInstance), moves,
+                                                checksums[2]);
+    const double dispatchedMoves = measureDispatchedSwapMoves(matrixInstance, moves, checksums[3]);
+    const double quantizedMoves = GraphDispatcher::dispatch(quantizedInstance, [&](const auto &graph) {
+        return measureSwapMoves(graph, moves, checksums[4]);
+    });
+
+    printResult("IGraph (virtual, ListGraph)", virtualListMoves, virtualListMoves);
+    printResult("ListGraph", listMoves, virtualListMoves);
+    printResult("DistanceMatrix", matrixMoves, virtualListMoves);
+    printResult("const IGraph * (dispatched per move)", dispatchedMoves, virtualListMoves);
+    std::string quantizedName = "QuantizedMatrix (32-bit, DistanceMatrix)";
+    if (dynamic_cast<const QuantizedMatrix<std::uint8_t> *>(quantizedInstance) != nullptr) {
+        quantizedName = "QuantizedMatrix (8-bit)";
+    } else if (dynamic_cast<const QuantizedMatrix<std::uint16_t> *>(quantizedInstance) != nullptr) {
+        quantizedName = "QuantizedMatrix (16-bit)";
+    }
+    printResult(quantizedName, quantizedMoves, virtualListMoves);
+    if (checksums[0] != checksums[1] || checksums[0] != checksums[2] || checksums[0] != checksums[3]
+        || checksums[0] != checksums[4]) {
+        cout << "Warning: variants computed different target function values" << endl;
+    }
+
+    delete listInstance;
+    delete matrixInstance;
+    delete quantizedInstance;
+}
+
+template<class TGraph>
+double PerformanceBenchmark::measureSwapMoves(const TGraph &tspInstance, const std::vector<std::pair<int, int>> &moves,
+                                              long long &outChecksum) const {
+    std::vector<int> naturalSolution;
+    TSPGreedyAlgorithms::createNaturalPermutation(tspInstance, naturalSolution);
+    return measureSwapMoves(tspInstance, moves, naturalSolution, outChecksum);
+}
+
+template<class TGraph>
+double PerformanceBenchmark::measureSwapMoves(const TGraph &tspInstance, const std::vector<std::pair<int, int>> &moves,
+                                              const std::vector<int> &initialSolution, long long &outChecksum) const {
+    const std::vector<int> &currentSolution = initialSolution;
+    const int currentSolutionValue = TSPUtils::calculateTargetFunctionValue(tspInstance, currentSolution);
+    std::vector<int> nextSolution = currentSolution;
+
+    double bestTime = std::numeric_limits<double>::max();
+    for (int nRepeats = 0; nRepeats < REPETITIONS_NUMBER; ++nRepeats) {
+        outChecksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const auto &move : moves) {
+            std::swap(nextSolution[move.first], nextSolution[move.second]);
+            outChecksum += TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue(tspInstance, move.first, move.second,
+                                                                              currentSolution, nextSolution,
+                                                                              currentSolutionValue);
+            std::swap(nextSolution[move.first], nextSolution[move.second]);
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        bestTime = std::min(bestTime, std::chrono::duration<double>(finish - start).count());
+    }
+    return static_cast<double>(moves.size()) / bestTime;
+}
+
+double PerformanceBenchmark::measureDispatchedSwapMoves(const IGraph *tspInstance,
+                                                        const std::vector<std::pair<int, int>> &moves,
+                                                        long long &outChecksum) const {
+    std::vector<int> currentSolution;
+    const int currentSolutionValue = TSPGreedyAlgorithms::createNaturalPermutation(tspInstance, currentSolution);
+    std::vector<int> nextSolution = currentSolution;
+
+    double bestTime = std::numeric_limits<double>::max();
+    for (int nRepeats = 0; nRepeats < REPETITIONS_NUMBER; ++nRepeats) {
+        outChecksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const auto &move : moves) {
+            std::swap(nextSolution[move.first], nextSolution[move.second]);
+            outChecksum += TSPLocalSearchAlgorithms::swapNeighbourhoodTFValue(tspInstance, move.first, move.second,
+                                                                              currentSolution, nextSolution,
+                                                                              currentSolutionValue);
+            std::swap(nextSolution[move.first], nextSolution[move.second]);
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        bestTime = std::min(bestTime, std::chrono::duration<double>(finish - start).count());
+    }
+    return static_cast<double>(moves.size()) / bestTime;
+}
+
+void PerformanceBenchmark::benchmarkMatrixLayouts(int nVertex) const {
+    std::vector<std::pair<int, int>> moves;
+    moves.reserve(MOVES_NUMBER);
+    while (moves.size() < MOVES_NUMBER) {
+        int i = Random::getInt(0, nVertex - 1);
+        int j = Random::getInt(0, nVertex - 1);
+        if (i != j) {
+            moves.emplace_back(i, j);
+        }
+    }
+    std::vector<int> initialSolution(nVertex);
+    std::iota(initialSolution.begin(), initialSolution.end(), 0);
+    std::shuffle(initialSolution.begin(), initialSolution.end(), std::mt19937(nVertex));
+
+    // Same pseudorandom costs in [1, 1000] for every matrix, so that only one of them is kept in memory at a time
+    auto fillCosts = [nVertex](IGraph &matrix) {
+        for (int i = 0; i < nVertex; ++i) {
+            for (int j = 0; j < nVertex; ++j) {
+                if (i != j) {
+                    unsigned int hash = static_cast<unsigned int>(i) * 2654435761u
+                                        ^ static_cast<unsigned int>(j) * 40503u;
+                    hash ^= hash >> 15;
+                    matrix.addEdge(i, j, static_cast<int>(hash % 1000) + 1);
+                }
+            }
+        }
+    };
+
+    cout << std::string(10, '-') << "Swap moves/s on random tour of random instance (n = " << nVertex << ")"
+         << std::string(10, '-') << endl;
+
+    long long checksums[3];
+    double rowMajorMoves;
+    {
+        DistanceMatrix rowMajorMatrix(IGraph::GraphType::Directed, nVertex);
+        fillCosts(rowMajorMatrix);
+        rowMajorMoves = measureSwapMoves(rowMajorMatrix, moves, initialSolution, checksums[0]);
+    }
+    double tiledMoves;
+    {
+        TiledMatrix tiledMatrix(IGraph::GraphType::Directed, nVertex, TiledMatrix::Tiles);
+        fillCosts(tiledMatrix);
+        tiledMoves = measureSwapMoves(tiledMatrix, moves, initialSolution, checksums[1]);
+    }
+    double mortonMoves;
+    {
+        TiledMatrix mortonMatrix(IGraph::GraphType::Directed, nVertex, TiledMatrix::MortonTiles);
+        fillCosts(mortonMatrix);
+        mortonMoves = measureSwapMoves(mortonMatrix, moves, initialSolution, checksums[2]);
+    }
+
+    printResult("DistanceMatrix (row-major)", rowMajorMoves, rowMajorMoves);
+    printResult("TiledMatrix (tiles)", tiledMoves, rowMajorMoves);
+    printResult("TiledMatrix (Z-ordered tiles)", mortonMoves, rowMajorMoves);
+    if (checksums[0] != checksums[1] || checksums[0] != checksums[2]) {
+        cout << "Warning: variants computed different target function values" << endl;
+    }
+}
+
+void PerformanceBenchmark::benchmarkMappedMatrix(int nVertex) const {
+    std::vector<std::pair<int, int>> moves;
+    moves.reserve(MOVES_NUMBER);
+    while (moves.size() < MOVES_NUMBER) {
+        int i = Random::getInt(0, nVertex - 1);
+        int j = Random::getInt(0, nVertex - 1);
+        if (i != j) {
+            moves.emplace_back(i, j);
+        }
+    }
+    std::vector<int> initialSolution(nVertex);
+    std::iota(initialSolution.begin(), initialSolution.end(), 0);
+    std::shuffle(initialSolution.begin(), initialSolution.end(), std::mt19937(nVertex));
+
+    // Costs in [1, 1000] as in benchmarkMatrixLayouts(), stored in 2 bytes by the binary file
+    const std::string binaryPath =
+            (std::filesystem::temp_directory_path() / ("pea_p1_mapped_" + std::to_string(nVertex) + ".bin")).string();
+    DistanceMatrix memoryMatrix(IGraph::GraphType::Directed, nVertex);
+    {
+        std::vector<int> costMatrix(static_cast<std::size_t>(nVertex) * nVertex);
+        for (int i = 0; i < nVertex; ++i) {
+            for (int j = 0; j < nVertex; ++j) {
+                unsigned int hash = static_cast<unsigned int>(i) * 2654435761u ^ static_cast<unsigned int>(j) * 40503u;
+                hash ^= hash >> 15;
+                costMatrix[static_cast<std::size_t>(i) * nVertex + j] =
+                        (i == j) ? -1 : static_cast<int>(hash % 1000) + 1;
+            }
+        }
+        memoryMatrix.assignCosts(costMatrix.data());
+        if (!BinaryInstance::write(binaryPath, "random" + std::to_string(nVertex), nVertex, costMatrix.data(),
+                                   {0, 0})) {
+            cout << "Binary file " << binaryPath << " could not be written" << endl;
+            return;
+        }
+    }
+    MappedMatrix mappedMatrix(IGraph::GraphType::Directed, binaryPath);
+
+    cout << std::string(10, '-') << "In-memory against mapped matrix (n = " << nVertex << ")"
+         << std::string(10, '-') << endl;
+
+    long long checksums[3];
+    const double memoryMoves = measureSwapMoves(memoryMatrix, moves, initialSolution, checksums[0]);
+    mappedMatrix.setAccessPattern(MappedFile::AccessPattern::Random);
+    const double mappedMoves = GraphDispatcher::dispatch(&mappedMatrix, [&](const auto &graph) {
+        return measureSwapMoves(graph, moves, initialSolution, checksums[1]);
+    });
+    printResult("DistanceMatrix", memoryMoves, memoryMoves);
+    printResult("MappedMatrix (random)", mappedMoves, memoryMoves);
+    if (checksums[0] != checksums[1]) {
+        cout << "Warning: variants computed different target function values" << endl;
+    }
+
+    // Whole tours are built, so that rows are read in the order of the algorithm
+    std::vector<int> solution;
+    const double memoryNearestTime = measureTime([&]() {
+        solution.clear();
+        checksums[0] = TSPGreedyAlgorithms::nearestNeighbour(&memoryMatrix, solution);
+    });
+    mappedMatrix.setAccessPattern(MappedFile::AccessPattern::Sequential);
+    const double sequentialNearestTime = measureTime([&]() {
+        solution.clear();
+        checksums[1] = TSPGreedyAlgorithms::nearestNeighbour(&mappedMatrix, solution);
+    });
+    mappedMatrix.setAccessPattern(MappedFile::AccessPattern::Random);
+    const double randomNearestTime = measureTime([&]() {
+        solution.clear();
+        checksums[2] = TSPGreedyAlgorithms::nearestNeighbour(&mappedMatrix, solution);
+    });
+
+    // Annealing is randomized - times are comparable, tours are not
+    LocalSearchParameters parameters;
+    parameters.setSimulatedAnnealingDefaultParameters();
+    parameters.iterationsNumber = 200;
+    long long annealingChecksum = 0;
+    const double memoryAnnealingTime = measureTime([&]() {
+        solution.clear();
+        annealingChecksum += TSPLocalSearchAlgorithms::simulatedAnnealing(&memoryMatrix, parameters, solution);
+    });
+    const double mappedAnnealingTime = measureTime([&]() {
+        solution.clear();
+        annealingChecksum += TSPLocalSearchAlgorithms::simulatedAnnealing(&mappedMatrix, parameters, solution);
+    });
+
+    cout << std::left << std::setw(40) << "nearestNeighbour (ms)" << std::right << std::fixed << std::setprecision(2)
+         << "memory " << std::setw(10) << memoryNearestTime << "  mapped sequential " << std::setw(10)
+         << sequentialNearestTime << "  mapped random " << std::setw(10) << randomNearestTime << endl;
+    cout << std::left << std::setw(40) << "simulatedAnnealing (ms)" << std::right << std::fixed
+         << std::setprecision(2) << "memory " << std::setw(10) << memoryAnnealingTime << "  mapped random "
+         << std::setw(10) << mappedAnnealingTime << endl;
+    cout << "(checksum " << annealingChecksum << ")" << endl;
+    if (checksums[0] != checksums[1] || checksums[0] != checksums[2]) {
+        cout << "Warning: variants computed different target function values" << endl;
+    }
+    std::filesystem::remove(binaryPath);
+}
+
+void PerformanceBenchmark::benchmarkMinPlusKernels() const {
+    using Kernel = TSPExactAlgorithms::DPMinPlusKernel;
+    const Kernel detectedKernel = TSPExactAlgorithms::dpMinPlusKernel;
+    const std::vector<std::pair<Kernel, std::string>> kernels = {{Kernel::Scalar, "scalar"},
+                                                                 {Kernel::AVX2,   "AVX2"},
+                                                                 {Kernel::AVX512, "AVX-512"}};
+
+    cout << std::string(10, '-') << "Held-Karp min-plus kernels, single thread (ms)" << std::string(10, '-') << endl;
+    cout << std::left << std::setw(24) << "instance" << std::right << std::setw(12) << "recursive";
+    for (const auto &kernel : kernels) {
+        if (kernel.first <= detectedKernel) {
+            cout << std::setw(12) << kernel.second;
+        }
+    }
+    cout << endl;
+
+    for (const char *instancePath : {"SMALL/data14.txt", "SMALL/data16.txt", "SMALL/data18.txt",
+                                     "MIE/tsp_13.txt", "MIE/tsp_15.txt", "MIE/tsp_17.txt"}) {
+        IGraph *tspInstance = nullptr;
+        TSPUtils::loadTSPInstance(&tspInstance, instancePath);
+        std::vector<int> solution;
+        int recursiveValue = 0;
+        const double recursiveTime = measureTime([&]() {
+            solution.clear();
+            recursiveValue = TSPExactAlgorithms::dynamicProgrammingHeldKarp(tspInstance, solution);
+        });
+        cout << std::left << std::setw(24) << instancePath << std::right << std::fixed << std::setprecision(2)
+             << std::setw(12) << recursiveTime;
+
+        bool areValuesEqual = true;
+        for (const auto &kernel : kernels) {
+            if (kernel.first > detectedKernel) {
+                continue;
+            }
+            TSPExactAlgorithms::dpMinPlusKernel = kernel.first;
+            int kernelValue = 0;
+            const double kernelTime = GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+                return measureTime([&]() {
+                    solution.clear();
+                    kernelValue = TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel(graph, solution, 1);
+                });
+            });
+            cout << std::setw(12) << kernelTime;
+            areValuesEqual = areValuesEqual && kernelValue == recursiveValue;
+        }
+        cout << endl;
+        if (!areValuesEqual) {
+            cout << "Warning: variants computed different target function values" << endl;
+        }
+        delete tspInstance;
+    }
+    TSPExactAlgorithms::dpMinPlusKernel = detectedKernel;
+}
+
+void PerformanceBenchmark::printResult(const std::string &variantName, double movesPerSecond, double baseline) {
+    cout << std::left << std::setw(40) << variantName << std::right << std::setw(14) << std::fixed
+         << std::setprecision(0) << movesPerSecond << " moves/s  (x" << std::setprecision(2)
+         << movesPerSecond / baseline << ')' << endl;
+}
+
+void PerformanceBenchmark::benchmarkTable(int nElements, int nRows) const {
+    cout << std::string(10, '-') << "Table<T> against std::vector (ms)" << std::string(10, '-') << endl;
+    // Results are accumulated, so that the compiler cannot drop measured code
+    long long checksum = 0;
+
+    double tableTime = measureTime([&]() {
+        Table<int> table;
+        for (int i = 0; i < nElements; ++i) {
+            table.insertAtEnd(i);
+        }
+        checksum += table.getSize();
+    });
+    double vectorTime = measureTime([&]() {
+        std::vector<int> vector;
+        for (int i = 0; i < nElements; ++i) {
+            vector.push_back(i);
+        }
+        checksum += static_cast<long long>(vector.size());
+    });
+    printTimes("append " + std::to_string(nElements) + " ints", tableTime, vectorTime);
+
+    // Same pattern as ListGraph::addVertex() - every new vertex adds a row and a column
+    const int nVertex = nRows / 4;
+    tableTime = measureTime([&]() {
+        Table<Table<int>> matrix;
+        for (int v = 0; v < nVertex; ++v) {
+            matrix.insertAtEnd(Table<int>());
+            for (int i = 0; i < v; ++i) {
+                matrix[v].insertAtEnd(std::numeric_limits<int>::max());
+            }
+            for (int i = 0; i <= v; ++i) {
+                matrix[i].insertAtEnd(std::numeric_limits<int>::max());
+            }
+        }
+        checksum += matrix.getSize();
+    });
+    vectorTime = measureTime([&]() {
+        std::vector<std::vector<int>> matrix;
+        for (int v = 0; v < nVertex; ++v) {
+            matrix.emplace_back();
+            for (int i = 0; i < v; ++i) {
+                matrix[v].push_back(std::numeric_limits<int>::max());
+            }
+            for (int i = 0; i <= v; ++i) {
+                matrix[i].push_back(std::numeric_limits<int>::max());
+            }
+        }
+        checksum += static_cast<long long>(matrix.size());
+    });
+    printTimes("grow " + std::to_string(nVertex) + "x" + std::to_string(nVertex) + " by vertex", tableTime,
+               vectorTime);
+
+    Table<Table<int>> tableMatrix;
+    tableMatrix.resize(nRows);
+    std::vector<std::vector<int>> vectorMatrix(nRows);
+    for (int i = 0; i < nRows; ++i) {
+        tableMatrix[i].resize(nRows, i);
+        vectorMatrix[i].resize(nRows, i);
+    }
+    tableTime = measureTime([&]() {
+        Table<Table<int>> matrixCopy(tableMatrix);
+        checksum += matrixCopy[nRows - 1][nRows - 1];
+    });
+    vectorTime = measureTime([&]() {
+        std::vector<std::vector<int>> matrixCopy(vectorMatrix);
+        checksum += matrixCopy[nRows - 1][nRows - 1];
+    });
+    printTimes("copy " + std::to_string(nRows) + "x" + std::to_string(nRows), tableTime, vectorTime);
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
+void PerformanceBenchmark::benchmarkDoublyLinkedList(int nLists, int listLength) const {
+    cout << std::string(10, '-') << "DoublyLinkedList node allocators (ms)" << std::string(10, '-') << endl;
+    long long checksum = 0;
+    const double pooledTime = measureListOperations<DoublyLinkedList<int>>(nLists, listLength, checksum);
+    const double heapTime = measureListOperations<DoublyLinkedList<int, HeapNodeAllocator<Node<int>>>>(
+            nLists, listLength, checksum);
+    cout << std::left << std::setw(32) << std::to_string(nLists) + " lists of " + std::to_string(listLength)
+         << std::right << std::fixed << std::setprecision(2) << "pooled " << std::setw(10) << pooledTime
+         << "  heap " << std::setw(10) << heapTime << endl;
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
+template<class TList>
+double PerformanceBenchmark::measureListOperations(int nLists, int listLength, long long &outChecksum) const {
+    return measureTime([&]() {
+        Table<TList> lists;
+        lists.resize(nLists);
+        for (int i = 0; i < nLists; ++i) {
+            for (int j = 0; j < listLength; ++j) {
+                lists[i].insertAtEnd(j);
+            }
+        }
+        for (int i = 0; i < nLists; ++i) {
+            TList listCopy(lists[i]);
+            for (auto it = listCopy.getIterator(); it != listCopy.getEndIt(); ++it) {
+                outChecksum += it.getData();
+            }
+        }
+    });
+}
+
+void PerformanceBenchmark::benchmarkNeighbourIteration(const std::string &instancePath) const {
+    IGraph *listInstance = nullptr;
+    TSPUtils::loadTSPInstance(&listInstance, instancePath, TSPUtils::TSPType::Asymmetric,
+                              IGraph::GraphStructure::AdjacencyList);
+    const auto &graph = *dynamic_cast<const ListGraph *>(listInstance);
+    const int nVertex = graph.getVertexCount();
+    cout << std::string(10, '-') << "Neighbour iteration on \"" + instancePath + "\" (ms)" << std::string(10, '-')
+         << endl;
+    long long checksum = 0;
+
+    const double successorsListTime = measureTime([&]() {
+        for (int vertex = 0; vertex < nVertex; ++vertex) {
+            DoublyLinkedList<int> successors = graph.getVertexSuccessors(vertex);
+            for (auto it = successors.getIterator(); it != successors.getEndIt(); ++it) {
+                checksum += it.getData();
+            }
+        }
+    });
+    const double successorsViewTime = measureTime([&]() {
+        for (int vertex = 0; vertex < nVertex; ++vertex) {
+            for (int successor: graph.getSuccessorsView(vertex)) {
+                checksum += successor;
+            }
+        }
+    });
+    const double predecessorsListTime = measureTime([&]() {
+        for (int vertex = 0; vertex < nVertex; ++vertex) {
+            DoublyLinkedList<int> predecessors = graph.getVertexPredecessors(vertex);
+            for (auto it = predecessors.getIterator(); it != predecessors.getEndIt(); ++it) {
+                checksum += it.getData();
+            }
+        }
+    });
+    const double predecessorsViewTime = measureTime([&]() {
+        for (int vertex = 0; vertex < nVertex; ++vertex) {
+            for (int predecessor: graph.getPredecessorsView(vertex)) {
+                checksum += predecessor;
+            }
+        }
+    });
+
+    cout << std::left << std::setw(32) << "successors" << std::right << std::fixed << std::setprecision(2)
+         << "list " << std::setw(10) << successorsListTime << "  view " << std::setw(10) << successorsViewTime << endl;
+    cout << std::left << std::setw(32) << "predecessors" << std::right << std::fixed << std::setprecision(2)
+         << "list " << std::setw(10) << predecessorsListTime << "  view " << std::setw(10) << predecessorsViewTime
+         << endl;
+    cout << "(checksum " << checksum << ")" << endl;
+    delete listInstance;
+}
+
+double PerformanceBenchmark::measureTime(const std::function<void()> &function) const {
+    double bestTime = std::numeric_limits<double>::max();
+    for (int nRepeats = 0; nRepeats < REPETITIONS_NUMBER; ++nRepeats) {
+        auto start = std::chrono::high_resolution_clock::now();
+        function();
+        auto finish = std::chrono::high_resolution_clock::now();
+        bestTime = std::min(bestTime, std::chrono::duration<double, std::milli>(finish - start).count());
+    }
+    return bestTime;
+}
+
+void PerformanceBenchmark::printTimes(const std::string &operationName, double tableTime, double vectorTime) {
+    cout << std::left << std::setw(32) << operationName << std::right << std::fixed << std::setprecision(2)
+         << "Table " << std::setw(10) << tableTime << "  std::vector " << std::setw(10) << vectorTime << endl;
+}
@@ -0,0 +1,106 @@
+#ifndef PEA_P1_PERFORMANCEBENCHMARK_H
+#define PEA_P1_PERFORMANCEBENCHMARK_H
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <utility>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <filesystem>
+
+#include "../structures/graphs/IGraph.h"
+#include "../structures/graphs/ListGraph.h"
+#include "../structures/graphs/DistanceMatrix.h"
+#include "../structures/graphs/TiledMatrix.h"
+#include "../structures/graphs/MappedMatrix.h"
+#include "../structures/graphs/GraphDispatcher.h"
+#include "../algorithms/TSPLocalSearchAlgorithms.h"
+#include "../algorithms/TSPGreedyAlgorithms.h"
+#include "../algorithms/TSPExactAlgorithms.h"
+#include "../utilities/TSPUtils.h"
+#include "../utilities/Random.h"
+#include "../structures/Table.h"
+#include "../structures/DoublyLinkedList.h"
+
+using std::cout;
+using std::endl;
+
+// Throughput measurements of hot paths of the algorithms, printed to the standard output
+class PerformanceBenchmark {
+public:
+
+    // Start benchmarks
+    void run() const;
+
+    // Single-threaded times (ms) of dynamicProgrammingHeldKarpParallel() with every min-plus kernel supported
+    // by the CPU against the recursive dynamicProgrammingHeldKarp(), on instances from SMALL and MIE
+    void benchmarkMinPlusKernels() const;
+
+private:
+
+    // Number of neighbourhood moves evaluated in each measurement
+    static const int MOVES_NUMBER = 5'000'000;
+
+    // Number of repeated measurements, the best one is reported
+    static const int REPETITIONS_NUMBER = 5;
+
+    // Moves/s of swap neighbourhood evaluation through the IGraph interface, concrete graph types
+    // and the dispatching entry point
+    void benchmarkSwapMoves(const std::string &instancePath) const;
+
+    // Moves/s of evaluating (and reverting) swaps from moves on permutation of the instance
+    template<class TGraph>
+    [[nodiscard]] double measureSwapMoves(const TGraph &tspInstance, const std::vector<std::pair<int, int>> &moves,
+                                          long long &outChecksum) const;
+
+    // As above, moves are applied to initialSolution instead of the natural permutation
+    template<class TGraph>
+    [[nodiscard]] double measureSwapMoves(const TGraph &tspInstance, const std::vector<std::pair<int, int>> &moves,
+                                          const std::vector<int> &initialSolution, long long &outChecksum) const;
+
+    [[nodiscard]] double measureDispatchedSwapMoves(const IGraph *tspInstance,
+                                                    const std::vector<std::pair<int, int>> &moves,
+                                                    long long &outChecksum) const;
+
+    // Moves/s of swap neighbourhood evaluation (as in simulated annealing) on random complete instance
+    // of nVertex vertices, stored in row-major DistanceMatrix and in TiledMatrix with both layouts
+    // Tour is a random permutation, so consecutive cities are far apart in the matrix
+    void benchmarkMatrixLayouts(int nVertex) const;
+
+    static void printResult(const std::string &variantName, double movesPerSecond, double baseline);
+
+    // Swap moves/s, nearest neighbour and simulated annealing times (ms) on random complete instance of nVertex
+    // vertices, kept in memory as DistanceMatrix and read in place from its binary file as MappedMatrix
+    // with both access patterns (the file is written to the system's temporary directory and removed afterwards)
+    // The file stays in the page cache if it fits in RAM - only the cost of reading through the mapping is measured
+    void benchmarkMappedMatrix(int nVertex) const;
+
+    // Times (ms) of appending, building row by row and copying Table<Table<int>> against std::vector
+    void benchmarkTable(int nElements, int nRows) const;
+
+    // Times (ms) of building, copying (as getVertexSuccessors() does) and iterating nLists lists
+    // with pooled and heap allocated nodes
+    void benchmarkDoublyLinkedList(int nLists, int listLength) const;
+
+    template<class TList>
+    [[nodiscard]] double measureListOperations(int nLists, int listLength, long long &outChecksum) const;
+
+    // Times (ms) of visiting successors and predecessors of every vertex of the instance (as ListGraph)
+    // through list-returning accessors and through views
+    void benchmarkNeighbourIteration(const std::string &instancePath) const;
+
+    // Best time (ms) of REPETITIONS_NUMBER calls
+    [[nodiscard]] double measureTime(const std::function<void()> &function) const;
+
+    static void printTimes(const std::string &operationName, double tableTime, double vectorTime);
+
+};
+
+
+#endif //PEA_P1_PERFORMANCEBENCHMARK_H
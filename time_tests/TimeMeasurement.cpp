@@ -13,6 +13,21 @@ void TimeMeasurement::run() const {
                                 "dynamicProgrammingHeldKarp");
     saveTimeDataToFile("dynamic_programming", "DP (Held-Karp)", timeData);
 
+    timeData = measureAlgorithm(getDynamicProgrammingInstances(),
+                                TSPExactAlgorithms::dynamicProgrammingHeldKarpParallel,
+                                "dynamicProgrammingHeldKarpParallel");
+    saveTimeDataToFile("dynamic_programming_parallel", "DP (Held-Karp; parallel)", timeData);
+
+    timeData = measureAlgorithm(getDynamicProgrammingInstances(),
+                                TSPExactAlgorithms::dynamicProgrammingHeldKarpCompact,
+                                "dynamicProgrammingHeldKarpCompact");
+    saveTimeDataToFile("dynamic_programming_compact", "DP (Held-Karp; compact)", timeData);
+
+    timeData = measureAlgorithm(getDynamicProgrammingPrunedInstances(),
+                                TSPExactAlgorithms::dynamicProgrammingHeldKarpPruned,
+                                "dynamicProgrammingHeldKarpPruned");
+    saveTimeDataToFile("dynamic_programming_pruned", "DP (Held-Karp; pruned)", timeData);
+
     timeData = measureAlgorithm(getBranchAndBoundInstances(), TSPExactAlgorithms::branchAndBound0Heuristics,
                                 "branchAndBound0Heuristics");
     saveTimeDataToFile("branch_and_bound_0h", "B&B (Little)", timeData);
@@ -28,6 +43,23 @@ void TimeMeasurement::run() const {
     timeData = measureAlgorithm(getBranchAndBoundInstances(), TSPExactAlgorithms::branchAndBound2Heuristics,
                                 "branchAndBound2Heuristics");
     saveTimeDataToFile("branch_and_bound_nn_g", "B&B (Little; NN; G)", timeData);
+
+    // Search strategies on the same instances - best-first, depth-first and best-first diving under memory pressure
+    timeData = measureAlgorithm(getBranchAndBoundInstances(), TSPExactAlgorithms::branchAndBound,
+                                "branchAndBound");
+    saveTimeDataToFile("branch_and_bound", "B&B (Little; best-first)", timeData);
+
+    timeData = measureAlgorithm(getBranchAndBoundInstances(), TSPExactAlgorithms::branchAndBoundDepthFirst,
+                                "branchAndBoundDepthFirst");
+    saveTimeDataToFile("branch_and_bound_dfs", "B&B (Little; depth-first)", timeData);
+
+    timeData = measureAlgorithm(getBranchAndBoundInstances(), TSPExactAlgorithms::branchAndBoundHybrid,
+                                "branchAndBoundHybrid");
+    saveTimeDataToFile("branch_and_bound_hybrid", "B&B (Little; hybrid)", timeData);
+
+    timeData = measureAlgorithm(getBranchAndBoundInstances(), TSPExactAlgorithms::branchAndBoundParallel,
+                                "branchAndBoundParallel");
+    saveTimeDataToFile("branch_and_bound_parallel", "B&B (Little; NN; G; parallel)", timeData);
 }
 
 std::vector<MeasurementPoint>
@@ -54,16 +86,29 @@ TimeMeasurement::measureAlgorithm(const std::map<std::string, std::vector<std::s
             delete tspInstance;
             TSPUtils::loadTSPInstance(&tspInstance, pair.first + "/" + pair.second[i]);
             mp.nVertex = tspInstance->getVertexCount();
+            mp.peakMemory = 0;
+            mp.isPeakMemoryKnown = true;
             for (int nRepeats = 0; nRepeats < REPETITIONS_NUMBER; ++nRepeats) {
                 algorithmSolution.clear();
+                // Peak is lowered to the memory in use before each run, so only the algorithm raises it
+                if (!MemoryUsage::resetPeak()) {
+                    mp.isPeakMemoryKnown = false;
+                }
+                const std::size_t memoryBefore = MemoryUsage::getCurrent();
                 mp.time += countTime([&]() -> void {
                     tspAlgorithm(tspInstance, algorithmSolution);
                 });
+                const std::size_t memoryPeak = MemoryUsage::getPeak();
+                mp.peakMemory = std::max(mp.peakMemory, (memoryPeak > memoryBefore) ? memoryPeak - memoryBefore : 0);
                 cout << '.';
             }
             mp.time /= REPETITIONS_NUMBER;
             measurementPoints.emplace_back(mp);
-            cout << endl;
+            if (mp.isPeakMemoryKnown) {
+                cout << " peak memory: " << mp.peakMemory << " KiB" << endl;
+            } else {
+                cout << " peak memory: n/a (cannot reset peak)" << endl;
+            }
         }
         cout << "Measurement of group \"" << pair.first << "\" completed!" << endl;
     }
@@ -112,6 +157,15 @@ TimeMeasurement::saveTimeDataToFile(const std::string &fileName, const std::stri
         file << sep << mp.time;
     }
     file << endl;
+    file << "Peak memory [KiB]";
+    for (const auto &mp : measurementPoints) {
+        if (mp.isPeakMemoryKnown) {
+            file << sep << mp.peakMemory;
+        } else {
+            file << sep << "n/a";
+        }
+    }
+    file << endl;
 
     file.close();
     cout << "FILE WRITTEN SUCCESSFULLY" << endl;
@@ -273,6 +327,45 @@ std::map<std::string, std::vector<std::string>> TimeMeasurement::getDynamicProgr
     return fileGroups;
 }
 
+std::map<std::string, std::vector<std::string>> TimeMeasurement::getDynamicProgrammingPrunedInstances() const {
+    std::map<std::string, std::vector<std::string>> fileGroups;
+    std::vector<std::string> filePaths;
+
+    // SMALL
+    filePaths.emplace_back("data10.txt"); //+
+    filePaths.emplace_back("data11.txt"); //+
+    filePaths.emplace_back("data12.txt"); //+
+    filePaths.emplace_back("data13.txt"); //+
+    filePaths.emplace_back("data14.txt"); //+
+    filePaths.emplace_back("data15.txt"); //+
+    filePaths.emplace_back("data16.txt"); //+
+    filePaths.emplace_back("data18.txt"); //+
+    fileGroups.insert({"SMALL", filePaths});
+    filePaths.clear();
+
+    // ATSP
+    filePaths.emplace_back("data17.txt"); //+
+    filePaths.emplace_back("data34.txt"); //+
+    filePaths.emplace_back("data36.txt"); //+
+    filePaths.emplace_back("data39.txt"); //+
+    filePaths.emplace_back("data45.txt"); //+
+//    filePaths.emplace_back("data43.txt"); // > 2^24 states
+//    filePaths.emplace_back("data48.txt"); // > 2^24 states
+//    filePaths.emplace_back("data53.txt"); // > 2^24 states
+    fileGroups.insert({"ATSP", filePaths});
+    filePaths.clear();
+
+    // TSP
+    filePaths.emplace_back("data21.txt"); //+
+    filePaths.emplace_back("data24.txt"); //+
+//    filePaths.emplace_back("data26.txt");
+//    filePaths.emplace_back("data29.txt");
+    fileGroups.insert({"TSP", filePaths});
+    filePaths.clear();
+
+    return fileGroups;
+}
+
 std::map<std::string, std::vector<std::string>> TimeMeasurement::getBranchAndBoundInstances() const {
     std::map<std::string, std::vector<std::string>> fileGroups;
     std::vector<std::string> filePaths;
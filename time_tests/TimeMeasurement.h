@@ -12,6 +12,7 @@
 #include "../structures/graphs/IGraph.h"
 #include "../algorithms/TSPExactAlgorithms.h"
 #include "../utilities/TSPUtils.h"
+#include "../utilities/MemoryUsage.h"
 
 using std::cout;
 using std::endl;
@@ -19,10 +20,15 @@ using std::endl;
 struct MeasurementPoint {
     int nVertex;
     double time;
+    // Highest resident memory (in KiB) used by a run of the algorithm, on top of memory used before it
+    std::size_t peakMemory;
+    // False if the peak could not be reset before a run, so peakMemory would include earlier runs
+    bool isPeakMemoryKnown;
 
-    MeasurementPoint() : nVertex(-1), time(0) {}
+    MeasurementPoint() : nVertex(-1), time(0), peakMemory(0), isPeakMemoryKnown(true) {}
 
-    MeasurementPoint(int nVertex, double time) : nVertex(nVertex), time(time) {}
+    MeasurementPoint(int nVertex, double time, std::size_t peakMemory = 0, bool isPeakMemoryKnown = true)
+            : nVertex(nVertex), time(time), peakMemory(peakMemory), isPeakMemoryKnown(isPeakMemoryKnown) {}
 };
 
 class TimeMeasurement {
@@ -49,6 +55,7 @@ private:
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getBruteForceSwapInstances() const;
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getBruteForceTreeInstances() const;
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getDynamicProgrammingInstances() const;
+    [[nodiscard]] std::map<std::string, std::vector<std::string>> getDynamicProgrammingPrunedInstances() const;
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getBranchAndBoundInstances() const;
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getBranchAndBound0HInstances() const;
     [[nodiscard]] std::map<std::string, std::vector<std::string>> getBranchAndBoundNNInstances() const;
@@ -0,0 +1,201 @@
+#include "BinaryInstance.h"
+
+constexpr char BinaryInstance::MAGIC[8];
+
+BinaryInstance::SourceStamp BinaryInstance::getSourceStamp(const std::string &path) {
+    std::error_code errorCode;
+    const auto size = std::filesystem::file_size(path, errorCode);
+    if (errorCode) {
+        throw std::invalid_argument("File with path " + path + " does not exist.");
+    }
+    const auto modificationTime = std::filesystem::last_write_time(path, errorCode);
+    if (errorCode) {
+        throw std::invalid_argument("getSourceStamp() error: cannot read modification time of " + path);
+    }
+    return {static_cast<std::uint64_t>(size),
+            static_cast<std::int64_t>(modificationTime.time_since_epoch().count())};
+}
+
+std::uint64_t BinaryInstance::calculateChecksum(const unsigned char *bytes, std::size_t count) {
+    // Four independent lanes of 8-byte words, so that multiplications do not wait for each other
+    std::uint64_t lanes[4] = {0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull,
+                              0x27D4EB2F165667C5ull};
+    const std::uint64_t multiplier = 0xFF51AFD7ED558CCDull;
+    std::size_t position = 0;
+    for (; position + 32 <= count; position += 32) {
+        for (int lane = 0; lane < 4; ++lane) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + position + 8 * lane, sizeof(word));
+            lanes[lane] = (lanes[lane] ^ word) * multiplier;
+            lanes[lane] ^= lanes[lane] >> 32;
+        }
+    }
+    std::uint64_t checksum = count;
+    for (std::uint64_t lane : lanes) {
+        checksum = (checksum ^ lane) * multiplier;
+    }
+    for (; position < count; ++position) {
+        checksum = (checksum ^ bytes[position]) * multiplier;
+    }
+    return checksum ^ (checksum >> 29);
+}
+
+bool BinaryInstance::isSymmetricMatrix(const int *costMatrix, int nVertex) {
+    // Upper triangle is compared in square blocks, so that the transposed (column) accesses stay in cache
+    const int blockSize = 64;
+    const auto n = static_cast<std::size_t>(nVertex);
+    for (int blockRow = 0; blockRow < nVertex; blockRow += blockSize) {
+        const int rowEnd = std::min(blockRow + blockSize, nVertex);
+        for (int blockColumn = blockRow; blockColumn < nVertex; blockColumn += blockSize) {
+            const int columnEnd = std::min(blockColumn + blockSize, nVertex);
+            for (int i = blockRow; i < rowEnd; ++i) {
+                for (int j = std::max(blockColumn, i + 1); j < columnEnd; ++j) {
+                    if (costMatrix[i * n + j] != costMatrix[j * n + i]) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool BinaryInstance::write(const std::string &path, const std::string &instanceName, int nVertex,
+                           const int *costMatrix, const SourceStamp &sourceStamp) {
+    const std::size_t matrixSize = static_cast<std::size_t>(nVertex) * nVertex;
+    long long minCost = std::numeric_limits<int>::max(), maxCost = std::numeric_limits<int>::min();
+    for (std::size_t idx = 0; idx < matrixSize; ++idx) {
+        minCost = std::min<long long>(minCost, costMatrix[idx]);
+        maxCost = std::max<long long>(maxCost, costMatrix[idx]);
+    }
+    const long long costRange = (matrixSize == 0) ? 0 : maxCost - minCost;
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.vertexCount = nVertex;
+    header.costWidth = (costRange <= std::numeric_limits<std::uint8_t>::max()) ? 1
+                       : (costRange <= std::numeric_limits<std::uint16_t>::max()) ? 2 : 4;
+    header.costBias = (matrixSize == 0) ? 0 : static_cast<std::int32_t>(minCost);
+    header.sourceSize = sourceStamp.size;
+    header.sourceModificationTime = sourceStamp.modificationTime;
+    instanceName.copy(header.instanceName, sizeof(header.instanceName) - 1);
+
+    header.isSymmetric = isSymmetricMatrix(costMatrix, nVertex) ? 1 : 0;
+
+    std::vector<unsigned char> storedCosts(matrixSize * header.costWidth);
+    for (std::size_t idx = 0; idx < matrixSize; ++idx) {
+        const auto storedCost = static_cast<std::uint32_t>(costMatrix[idx] - minCost);
+        if (header.costWidth == 1) {
+            storedCosts[idx] = static_cast<std::uint8_t>(storedCost);
+        } else if (header.costWidth == 2) {
+            const auto narrowCost = static_cast<std::uint16_t>(storedCost);
+            std::memcpy(&storedCosts[2 * idx], &narrowCost, sizeof(narrowCost));
+        } else {
+            std::memcpy(&storedCosts[4 * idx], &storedCost, sizeof(storedCost));
+        }
+    }
+    header.checksum = calculateChecksum(storedCosts.data(), storedCosts.size());
+
+    // Written under a temporary name and renamed, so that concurrent runs never read a partial file.
+    // The name is unique per process, thread and call, and does not touch the shared Random engine
+    static std::atomic<unsigned long long> writeCounter(0);
+    const std::string temporaryPath =
+            path + ".tmp" + std::to_string(getpid()) + "_" +
+            std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "_" +
+            std::to_string(writeCounter.fetch_add(1, std::memory_order_relaxed));
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(storedCosts.data()),
+                   static_cast<std::streamsize>(storedCosts.size()));
+        if (!file) {
+            file.close();
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryPath, path, errorCode);
+    if (errorCode) {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool BinaryInstance::readLayout(const MappedFile &file, const SourceStamp *expectedStamp, Layout &outLayout) {
+    if (file.getSize() < sizeof(Header)) {
+        return false;
+    }
+    Header header{};
+    std::memcpy(&header, file.begin(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != FORMAT_VERSION
+        || header.vertexCount < 1 || (header.costWidth != 1 && header.costWidth != 2 && header.costWidth != 4)) {
+        return false;
+    }
+    if (expectedStamp != nullptr && (header.sourceSize != expectedStamp->size
+                                     || header.sourceModificationTime != expectedStamp->modificationTime)) {
+        return false;
+    }
+    const std::size_t matrixSize = static_cast<std::size_t>(header.vertexCount) * header.vertexCount;
+    if (file.getSize() != sizeof(Header) + matrixSize * header.costWidth) {
+        return false;
+    }
+
+    header.instanceName[sizeof(header.instanceName) - 1] = '\0';
+    outLayout.instanceName = header.instanceName;
+    outLayout.vertexCount = header.vertexCount;
+    outLayout.isSymmetric = header.isSymmetric != 0;
+    outLayout.costWidth = header.costWidth;
+    outLayout.costBias = header.costBias;
+    outLayout.costsOffset = sizeof(Header);
+    outLayout.checksum = header.checksum;
+    return true;
+}
+
+bool BinaryInstance::read(const std::string &path, const SourceStamp *expectedStamp, MappedFile::Backing backing,
+                          Contents &outContents) {
+    std::error_code errorCode;
+    if (!std::filesystem::is_regular_file(path, errorCode)) {
+        return false;
+    }
+    MappedFile file(path, backing);
+    Layout layout;
+    if (!readLayout(file, expectedStamp, layout)) {
+        return false;
+    }
+    const std::size_t matrixSize = static_cast<std::size_t>(layout.vertexCount) * layout.vertexCount;
+    const auto *storedCosts = reinterpret_cast<const unsigned char *>(file.begin()) + layout.costsOffset;
+    if (calculateChecksum(storedCosts, matrixSize * layout.costWidth) != layout.checksum) {
+        return false;
+    }
+
+    outContents.instanceName = layout.instanceName;
+    outContents.vertexCount = layout.vertexCount;
+    outContents.isSymmetric = layout.isSymmetric;
+    std::vector<int> &outCostMatrix = outContents.costMatrix;
+    outCostMatrix.resize(matrixSize);
+    const long long costBias = layout.costBias;
+    if (layout.costWidth == 1) {
+        for (std::size_t idx = 0; idx < matrixSize; ++idx) {
+            outCostMatrix[idx] = static_cast<int>(costBias + storedCosts[idx]);
+        }
+    } else if (layout.costWidth == 2) {
+        for (std::size_t idx = 0; idx < matrixSize; ++idx) {
+            std::uint16_t storedCost;
+            std::memcpy(&storedCost, storedCosts + 2 * idx, sizeof(storedCost));
+            outCostMatrix[idx] = static_cast<int>(costBias + storedCost);
+        }
+    } else {
+        for (std::size_t idx = 0; idx < matrixSize; ++idx) {
+            std::uint32_t storedCost;
+            std::memcpy(&storedCost, storedCosts + 4 * idx, sizeof(storedCost));
+            outCostMatrix[idx] = static_cast<int>(costBias + storedCost);
+        }
+    }
+    return true;
+}
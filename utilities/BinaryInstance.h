@@ -0,0 +1,110 @@
+#ifndef PEA_P1_BINARYINSTANCE_H
+#define PEA_P1_BINARYINSTANCE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "MappedFile.h"
+
+// Binary form of a dense instance: 128-byte header followed by the raw cost matrix
+// Costs are stored minus the smallest one (costBias), in the narrowest of 1, 2 or 4 bytes able to hold their range
+// Format uses the native byte order - files are meant as a machine-local cache, not for exchange
+class BinaryInstance {
+public:
+
+    // Identifies contents of the text file a binary instance was made from
+    struct SourceStamp {
+        std::uint64_t size;
+        std::int64_t modificationTime;
+    };
+
+    // Instance as read from a binary file
+    struct Contents {
+        std::string instanceName;
+        int vertexCount = 0;
+        // True if the cost matrix equals its transposition (the diagonal aside)
+        bool isSymmetric = false;
+        // Row-major vertexCount x vertexCount
+        std::vector<int> costMatrix;
+    };
+
+    // Header of a binary instance, describing how to read the stored costs in place
+    struct Layout {
+        std::string instanceName;
+        int vertexCount = 0;
+        bool isSymmetric = false;
+        // Bytes per stored cost - 1, 2 or 4
+        int costWidth = 4;
+        // Cost = costBias + stored value
+        std::int32_t costBias = 0;
+        // Offset (in bytes) of the row-major costs from the start of the file
+        std::size_t costsOffset = 0;
+        // Of the stored costs, see calculateChecksum()
+        std::uint64_t checksum = 0;
+    };
+
+    static const std::uint32_t FORMAT_VERSION = 1;
+
+    // Stamp of the file, throws std::invalid_argument if it does not exist
+    [[nodiscard]] static SourceStamp getSourceStamp(const std::string &path);
+
+    // Writes row-major nVertex x nVertex costMatrix, the file is replaced atomically
+    // Returns false if the file could not be written (e.g. read-only directory)
+    static bool write(const std::string &path, const std::string &instanceName, int nVertex, const int *costMatrix,
+                      const SourceStamp &sourceStamp);
+
+    // Reads instance written by write(), returns false if the file does not exist, has other format version,
+    // its checksum does not match or (if expectedStamp is not nullptr) it was made from other version of the source
+    static bool read(const std::string &path, const SourceStamp *expectedStamp, MappedFile::Backing backing,
+                     Contents &outContents);
+
+    // Reads the header of file written by write() and checks the file size, without touching the costs
+    // Returns false in the cases read() does, except that the checksum is not verified
+    static bool readLayout(const MappedFile &file, const SourceStamp *expectedStamp, Layout &outLayout);
+
+    // True if row-major nVertex x nVertex costMatrix equals its transposition (the diagonal aside)
+    [[nodiscard]] static bool isSymmetricMatrix(const int *costMatrix, int nVertex);
+
+    // 64-bit hash of count bytes (not cryptographic, detects truncated or damaged files)
+    [[nodiscard]] static std::uint64_t calculateChecksum(const unsigned char *bytes, std::size_t count);
+
+private:
+    BinaryInstance() = default;
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::int32_t vertexCount;
+        // 1 if the cost matrix equals its transposition (the diagonal aside)
+        std::uint8_t isSymmetric;
+        // Bytes per stored cost - 1, 2 or 4
+        std::uint8_t costWidth;
+        std::uint16_t reserved;
+        std::int32_t costBias;
+        std::uint64_t sourceSize;
+        std::int64_t sourceModificationTime;
+        // Of the stored costs, see calculateChecksum()
+        std::uint64_t checksum;
+        char instanceName[80];
+    };
+
+    static_assert(sizeof(Header) == 128, "Costs start at 128 bytes, aligned for every cost width");
+
+    static constexpr char MAGIC[8] = {'P', 'E', 'A', 'T', 'S', 'P', 'B', '\0'};
+};
+
+#endif //PEA_P1_BINARYINSTANCE_H
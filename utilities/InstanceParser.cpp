@@ -0,0 +1,185 @@
+#include "InstanceParser.h"
+
+const char *InstanceParser::readToken(const char *begin, const char *end, std::string &outToken) {
+    const char *tokenStart = begin;
+    while (tokenStart != end && std::isspace(static_cast<unsigned char>(*tokenStart))) {
+        ++tokenStart;
+    }
+    const char *tokenEnd = tokenStart;
+    while (tokenEnd != end && !std::isspace(static_cast<unsigned char>(*tokenEnd))) {
+        ++tokenEnd;
+    }
+    outToken.assign(tokenStart, tokenEnd);
+    return tokenEnd;
+}
+
+const char *InstanceParser::findNumberStart(const char *position, const char *end) {
+#ifdef PEA_P1_SSE2_SCANNER
+    while (end - position >= 16) {
+        const unsigned int mask = numberCharactersMask(position);
+        if (mask != 0) {
+            return position + __builtin_ctz(mask);
+        }
+        position += 16;
+    }
+#endif
+    while (position != end && !isNumberCharacter(*position)) {
+        ++position;
+    }
+    return position;
+}
+
+const char *InstanceParser::parseInteger(const char *position, const char *end, int &outValue) {
+    const bool isNegative = (*position == '-');
+    if (isNegative) {
+        ++position;
+    }
+#ifdef PEA_P1_SSE2_SCANNER
+    // Integers of up to 8 digits (all costs in practice) are converted without a loop over digits
+    if (end - position >= 16) {
+        const auto digitsLength = static_cast<unsigned int>(__builtin_ctz(~digitsMask(position)));
+        if (digitsLength >= 1 && digitsLength <= 8) {
+            const int value = parseDigits(position, digitsLength);
+            outValue = isNegative ? -value : value;
+            return position + digitsLength;
+        }
+    }
+#endif
+    const char *digitsStart = position;
+    // Limit is checked once per digit, so that the value cannot overflow long long
+    const long long limit = static_cast<long long>(std::numeric_limits<int>::max()) + (isNegative ? 1 : 0);
+    long long value = 0;
+    while (position != end && isDigit(*position)) {
+        value = value * 10 + (*position - '0');
+        if (value > limit) {
+            throw std::invalid_argument("parseIntegers() error: integer out of range of int");
+        }
+        ++position;
+    }
+    if (position == digitsStart) {
+        throw std::invalid_argument("parseIntegers() error: '-' is not followed by digits");
+    }
+    outValue = static_cast<int>(isNegative ? -value : value);
+    return position;
+}
+
+const char *InstanceParser::parseIntegers(const char *begin, const char *end, int *out, std::size_t count) {
+    std::size_t k = 0;
+    const char *position = begin;
+#ifdef PEA_P1_SSE2_SCANNER
+    // Starts of integers are found for whole 16-byte blocks, so that parsing of one integer does not wait
+    // for the end of the previous one; every integer starting in a block has 16 more bytes readable
+    const char *numberEnd = begin;
+    bool isPreviousNumberCharacter = false;
+    while (k < count && end - position > 32) {
+        unsigned int starts = integerStartsMask(position, isPreviousNumberCharacter);
+        while (starts != 0 && k < count) {
+            numberEnd = parseInteger(position + __builtin_ctz(starts), end, out[k]);
+            ++k;
+            starts &= starts - 1;
+        }
+        position += 16;
+    }
+    if (k == count) {
+        return numberEnd;
+    }
+    // Integer started in the last block may continue past it
+    position = std::max(position, numberEnd);
+#endif
+    for (; k < count; ++k) {
+        position = findNumberStart(position, end);
+        if (position == end) {
+            throw std::invalid_argument("parseIntegers() error: expected " + std::to_string(count) +
+                                        " integers, found " + std::to_string(k));
+        }
+        position = parseInteger(position, end, out[k]);
+    }
+    return position;
+}
+
+std::size_t InstanceParser::countIntegers(const char *begin, const char *end) {
+    std::size_t count = 0;
+    const char *position = begin;
+    bool isPreviousNumberCharacter = false;
+#ifdef PEA_P1_SSE2_SCANNER
+    while (end - position >= 16) {
+        count += __builtin_popcount(integerStartsMask(position, isPreviousNumberCharacter));
+        position += 16;
+    }
+#endif
+    for (; position != end; ++position) {
+        if (isIntegerStart(*position, isPreviousNumberCharacter)) {
+            ++count;
+        }
+        isPreviousNumberCharacter = isNumberCharacter(*position);
+    }
+    return count;
+}
+
+void InstanceParser::parseIntegersParallel(const char *begin, const char *end, int *out, std::size_t count,
+                                           unsigned int nThreads) {
+    if (nThreads == 0) {
+        nThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const auto rangeSize = static_cast<std::size_t>(end - begin);
+    const std::size_t nChunks = std::min<std::size_t>(nThreads, rangeSize / PARALLEL_THRESHOLD);
+    if (nChunks <= 1) {
+        parseIntegers(begin, end, out, count);
+        return;
+    }
+
+    // Chunk boundaries are moved forward to separators, so that no integer is split
+    std::vector<const char *> boundaries(nChunks + 1);
+    boundaries[0] = begin;
+    boundaries[nChunks] = end;
+    for (std::size_t c = 1; c < nChunks; ++c) {
+        const char *boundary = std::max(boundaries[c - 1], begin + rangeSize / nChunks * c);
+        while (boundary != end && isNumberCharacter(*boundary)) {
+            ++boundary;
+        }
+        boundaries[c] = boundary;
+    }
+
+    // Integers of every chunk are counted first, prefix sums give positions of chunks' first integers in out
+    std::vector<std::size_t> chunkCounts(nChunks);
+    std::vector<std::exception_ptr> exceptions(nChunks);
+    std::vector<std::thread> threads;
+    threads.reserve(nChunks);
+    for (std::size_t c = 0; c < nChunks; ++c) {
+        threads.emplace_back([&, c]() {
+            chunkCounts[c] = countIntegers(boundaries[c], boundaries[c + 1]);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+
+    std::vector<std::size_t> chunkOffsets(nChunks + 1, 0);
+    for (std::size_t c = 0; c < nChunks; ++c) {
+        chunkOffsets[c + 1] = chunkOffsets[c] + chunkCounts[c];
+    }
+    if (chunkOffsets[nChunks] < count) {
+        throw std::invalid_argument("parseIntegers() error: expected " + std::to_string(count) +
+                                    " integers, found " + std::to_string(chunkOffsets[nChunks]));
+    }
+
+    for (std::size_t c = 0; c < nChunks && chunkOffsets[c] < count; ++c) {
+        threads.emplace_back([&, c]() {
+            try {
+                parseIntegers(boundaries[c], boundaries[c + 1], out + chunkOffsets[c],
+                              std::min(chunkCounts[c], count - chunkOffsets[c]));
+            } catch (...) {
+                exceptions[c] = std::current_exception();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (const auto &exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef PEA_P1_INSTANCEPARSER_H
+#define PEA_P1_INSTANCEPARSER_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define PEA_P1_SSE2_SCANNER
+#endif
+
+// Parsing of instance files held in memory (see MappedFile)
+// Integer is an optional '-' followed by decimal digits, every other character separates integers
+// '-' always starts an integer, also right after digits ("12-34" is 12 and -34); '-' without digits is an error
+// Separators are skipped 16 bytes at a time with SSE2 (if available), large ranges are parsed on several threads
+class InstanceParser {
+public:
+
+    // Ranges shorter than this (in bytes) are parsed on one thread
+    static const std::size_t PARALLEL_THRESHOLD = 1 << 20;
+
+    // Reads token (up to whitespace) starting at the first non-whitespace character of [begin, end)
+    // Returns position after the token
+    static const char *readToken(const char *begin, const char *end, std::string &outToken);
+
+    // Parses first count integers of [begin, end) into out, returns position after the last one
+    // Throws std::invalid_argument if there are fewer integers or some of them does not fit in int
+    static const char *parseIntegers(const char *begin, const char *end, int *out, std::size_t count);
+
+    // As parseIntegers(), range is split into chunks (at separators) parsed on nThreads threads
+    // nThreads = 0 uses every hardware thread
+    static void parseIntegersParallel(const char *begin, const char *end, int *out, std::size_t count,
+                                      unsigned int nThreads = 0);
+
+    // Number of integers in [begin, end)
+    [[nodiscard]] static std::size_t countIntegers(const char *begin, const char *end);
+
+private:
+    InstanceParser() = default;
+
+    [[nodiscard]] static bool isDigit(char character) {
+        return character >= '0' && character <= '9';
+    }
+
+    [[nodiscard]] static bool isNumberCharacter(char character) {
+        return isDigit(character) || character == '-';
+    }
+
+    // Integer starts at every '-' (also right after digits, "12-34" is 12 and -34) and at a digit
+    // not preceded by a number character
+    [[nodiscard]] static bool isIntegerStart(char character, bool isPreviousNumberCharacter) {
+        return character == '-' || (isDigit(character) && !isPreviousNumberCharacter);
+    }
+
+    // Parses integer starting at position (number character), returns position after it
+    static const char *parseInteger(const char *position, const char *end, int &outValue);
+
+    // First number character of [position, end) or end
+    static const char *findNumberStart(const char *position, const char *end);
+
+#ifdef PEA_P1_SSE2_SCANNER
+
+    // Bit k is set if byte k of 16 bytes at position is a number character
+    [[nodiscard]] static unsigned int numberCharactersMask(const char *position) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(position));
+        const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+                                             _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1)));
+        const __m128i minuses = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('-'));
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(digits, minuses)));
+    }
+
+    // Bit k is set if an integer starts at byte k of 16 bytes at position (see isIntegerStart())
+    // isPreviousNumberCharacter tells whether the byte before position is a number character, it is updated
+    // for the next 16 bytes
+    [[nodiscard]] static unsigned int integerStartsMask(const char *position, bool &isPreviousNumberCharacter) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(position));
+        const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+                                             _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1)));
+        const __m128i minuses = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('-'));
+        const auto digitsBits = static_cast<unsigned int>(_mm_movemask_epi8(digits));
+        const auto minusesBits = static_cast<unsigned int>(_mm_movemask_epi8(minuses));
+        const unsigned int numberCharactersBits = digitsBits | minusesBits;
+        const unsigned int starts =
+                minusesBits | (digitsBits & ~((numberCharactersBits << 1) | (isPreviousNumberCharacter ? 1u : 0u)));
+        isPreviousNumberCharacter = (numberCharactersBits & 0x8000u) != 0;
+        return starts;
+    }
+
+    // Bit k is set if byte k of 16 bytes at position is a digit
+    [[nodiscard]] static unsigned int digitsMask(const char *position) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(position));
+        const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+                                             _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1)));
+        return static_cast<unsigned int>(_mm_movemask_epi8(digits));
+    }
+
+    // Value of digitsLength (1 to 8) digits at position, at least 8 bytes must be readable
+    // All digits are converted at once within 64-bit word (x86 is little-endian, first digit is the lowest byte)
+    [[nodiscard]] static int parseDigits(const char *position, unsigned int digitsLength) {
+        std::uint64_t word;
+        std::memcpy(&word, position, sizeof(word));
+        // Digits are moved to the top bytes, bytes below become leading zeros
+        word = (word - 0x3030303030303030ull) << (8 * (8 - digitsLength));
+        word = (word * 10) + (word >> 8);
+        word = (((word & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+                (((word >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+        return static_cast<int>(word);
+    }
+
+#endif
+};
+
+#endif //PEA_P1_INSTANCEPARSER_H
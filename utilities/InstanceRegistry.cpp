@@ -0,0 +1,152 @@
+#include "InstanceRegistry.h"
+
+InstanceRegistry::InstanceRegistry(std::size_t memoryBudget)
+        : memoryBudget(memoryBudget), memoryUsage(0), clock(0) {
+}
+
+std::shared_ptr<const IGraph>
+InstanceRegistry::get(const std::string &path, IGraph::GraphStructure graphStructure,
+                      TSPUtils::TSPType *outTSPType) {
+    return getAbsolutePath("../input_data/" + path, graphStructure, outTSPType);
+}
+
+std::shared_ptr<const IGraph>
+InstanceRegistry::getAbsolutePath(const std::string &path, IGraph::GraphStructure graphStructure,
+                                  TSPUtils::TSPType *outTSPType) {
+    const Key key(path, graphStructure);
+    std::shared_ptr<Entry> entry;
+    std::promise<Instance> loadPromise;
+    bool isLoadingThread = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            entry = std::make_shared<Entry>();
+            entry->instance = loadPromise.get_future().share();
+            entries.emplace(key, entry);
+            isLoadingThread = true;
+        } else {
+            entry = it->second;
+        }
+        entry->lastUse = ++clock;
+    }
+
+    if (isLoadingThread) {
+        // Loading is done without the lock, so that other instances can be requested meanwhile
+        Instance instance{};
+        try {
+            IGraph *graph = nullptr;
+            TSPUtils::loadTSPInstanceDetectTypeAbsolutePath(&graph, path, instance.tspType, graphStructure);
+            instance.graph = std::shared_ptr<const IGraph>(graph);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto it = entries.find(key);
+                if (it != entries.end() && it->second == entry) {
+                    entries.erase(it);
+                }
+            }
+            loadPromise.set_exception(std::current_exception());
+            throw;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Entry may have been dropped by clear() while loading, it is not kept then
+            auto it = entries.find(key);
+            if (it != entries.end() && it->second == entry) {
+                entry->memoryUsage = estimateMemoryUsage(*instance.graph);
+                entry->isLoaded = true;
+                memoryUsage += entry->memoryUsage;
+                evict(entry.get());
+            }
+        }
+        loadPromise.set_value(instance);
+    }
+
+    const Instance &instance = entry->instance.get();
+    if (outTSPType != nullptr) {
+        *outTSPType = instance.tspType;
+    }
+    return instance.graph;
+}
+
+void InstanceRegistry::setMemoryBudget(std::size_t memoryBudget) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->memoryBudget = memoryBudget;
+    evict(nullptr);
+}
+
+std::size_t InstanceRegistry::getMemoryBudget() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return memoryBudget;
+}
+
+std::size_t InstanceRegistry::getMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return memoryUsage;
+}
+
+int InstanceRegistry::getInstanceCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(entries.size());
+}
+
+void InstanceRegistry::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    memoryUsage = 0;
+}
+
+void InstanceRegistry::evict(const Entry *keptEntry) {
+    while (memoryBudget != 0 && memoryUsage > memoryBudget) {
+        auto leastRecentlyUsed = entries.end();
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->second->isLoaded && it->second.get() != keptEntry &&
+                (leastRecentlyUsed == entries.end() || it->second->lastUse < leastRecentlyUsed->second->lastUse)) {
+                leastRecentlyUsed = it;
+            }
+        }
+        if (leastRecentlyUsed == entries.end()) {
+            // Only the kept entry is left, it stays even if it alone exceeds the budget
+            return;
+        }
+        memoryUsage -= leastRecentlyUsed->second->memoryUsage;
+        entries.erase(leastRecentlyUsed);
+    }
+}
+
+std::size_t InstanceRegistry::estimateMemoryUsage(const IGraph &graph) {
+    const auto nVertex = static_cast<std::size_t>(graph.getVertexCount());
+    // Undirected edges are counted once, but stored in both directions by the list-based structures
+    const std::size_t nStoredEdges = static_cast<std::size_t>(graph.getEdgeCount()) *
+                                     ((graph.getGraphType() == IGraph::GraphType::Undirected) ? 2 : 1);
+    switch (graph.getGraphStructure()) {
+        case IGraph::GraphStructure::IncidenceMatrix:
+            // Edge starts, ends and parameters, then outgoing and incoming edge lists
+            return nStoredEdges * 5 * sizeof(int) + nVertex * 2 * sizeof(Table<int>);
+        case IGraph::GraphStructure::AdjacencyList:
+            // Successor and predecessor lists, then the full parameter matrix
+            return nStoredEdges * 2 * sizeof(int) + nVertex * nVertex * sizeof(int) +
+                   nVertex * 3 * sizeof(Table<int>);
+        case IGraph::GraphStructure::QuantizedFlatMatrix:
+            if (dynamic_cast<const QuantizedMatrix<std::uint8_t> *>(&graph) != nullptr) {
+                return nVertex * nVertex * sizeof(std::uint8_t);
+            }
+            return nVertex * nVertex * sizeof(std::uint16_t);
+        case IGraph::GraphStructure::PackedTriangular:
+            return nVertex * (nVertex + 1) / 2 * sizeof(int);
+        case IGraph::GraphStructure::CompressedSparseRow:
+            // Successor offsets, IDs and costs, then predecessor offsets and IDs
+            return (nVertex + 1) * 2 * sizeof(int) + nStoredEdges * 3 * sizeof(int);
+        case IGraph::GraphStructure::NodeCoordinates:
+            return nVertex * 2 * sizeof(double);
+        case IGraph::GraphStructure::MappedFlatMatrix:
+            // Pages of the file belong to the page cache, the system drops them under memory pressure
+            return 0;
+        case IGraph::GraphStructure::FlatMatrix:
+        case IGraph::GraphStructure::TiledFlatMatrix:
+        case IGraph::GraphStructure::MortonFlatMatrix:
+        default:
+            return nVertex * nVertex * sizeof(int);
+    }
+}
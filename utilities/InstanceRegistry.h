@@ -0,0 +1,88 @@
+#ifndef PEA_P1_INSTANCEREGISTRY_H
+#define PEA_P1_INSTANCEREGISTRY_H
+
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../structures/graphs/IGraph.h"
+#include "TSPUtils.h"
+
+// Loads each instance once and shares it as an immutable graph between its users (and threads)
+// Instances are kept until the estimated memory of the loaded ones exceeds the budget - the least recently used
+// are dropped then; graphs already handed out stay valid as long as someone holds them
+// All methods may be called concurrently, a graph requested by many threads at once is loaded by one of them
+class InstanceRegistry {
+public:
+
+    // memoryBudget in bytes, 0 - no limit
+    explicit InstanceRegistry(std::size_t memoryBudget = 0);
+
+    InstanceRegistry(const InstanceRegistry &) = delete;
+
+    InstanceRegistry &operator=(const InstanceRegistry &) = delete;
+
+    // Instance loaded as TSPUtils::loadTSPInstanceDetectType(), the detected type is written to *outTSPType
+    // Each (path, graphStructure) pair is a separate entry
+    // Throws what the loading throws, failed loads are not remembered
+    [[nodiscard]] std::shared_ptr<const IGraph>
+    get(const std::string &path, IGraph::GraphStructure graphStructure = IGraph::GraphStructure::AdjacencyList,
+        TSPUtils::TSPType *outTSPType = nullptr);
+
+    [[nodiscard]] std::shared_ptr<const IGraph>
+    getAbsolutePath(const std::string &path,
+                    IGraph::GraphStructure graphStructure = IGraph::GraphStructure::AdjacencyList,
+                    TSPUtils::TSPType *outTSPType = nullptr);
+
+    // Lowering the budget evicts instances right away
+    void setMemoryBudget(std::size_t memoryBudget);
+
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    // Estimated bytes taken by the kept instances
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+    // Number of kept (and currently loading) instances
+    [[nodiscard]] int getInstanceCount() const;
+
+    // Drops all kept instances
+    void clear();
+
+    // Estimated bytes taken by the graph's storage, based on its structure and size
+    [[nodiscard]] static std::size_t estimateMemoryUsage(const IGraph &graph);
+
+private:
+
+    struct Instance {
+        std::shared_ptr<const IGraph> graph;
+        TSPUtils::TSPType tspType;
+    };
+
+    struct Entry {
+        std::shared_future<Instance> instance;
+        // 0 until loaded
+        std::size_t memoryUsage = 0;
+        bool isLoaded = false;
+        unsigned long long lastUse = 0;
+    };
+
+    // <path, structure>
+    typedef std::pair<std::string, IGraph::GraphStructure> Key;
+
+    // Drops least recently used loaded entries other than keptEntry until usage fits the budget, caller holds mutex
+    void evict(const Entry *keptEntry);
+
+    mutable std::mutex mutex;
+    std::map<Key, std::shared_ptr<Entry>> entries;
+    std::size_t memoryBudget;
+    std::size_t memoryUsage;
+    unsigned long long clock;
+};
+
+
+#endif //PEA_P1_INSTANCEREGISTRY_H
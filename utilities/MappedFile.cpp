@@ -0,0 +1,139 @@
+#include "MappedFile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &path, Backing backing) : data(nullptr), size(0), mappingSize(0),
+                                                                  backing(backing) {
+    const int fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        throw std::invalid_argument("File with path " + path + " does not exist.");
+    }
+    struct stat fileStatus{};
+    if (fstat(fileDescriptor, &fileStatus) != 0) {
+        close(fileDescriptor);
+        throw std::invalid_argument("MappedFile() error: cannot read size of " + path);
+    }
+    size = static_cast<std::size_t>(fileStatus.st_size);
+    // Empty file cannot be mapped, it is represented by an empty range
+    if (size == 0) {
+        close(fileDescriptor);
+        return;
+    }
+
+    if (backing == PageCache || backing == OnDemand) {
+        void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED) {
+            close(fileDescriptor);
+            throw std::invalid_argument("MappedFile() error: cannot map " + path);
+        }
+        if (backing == PageCache) {
+            // Files are read front to back
+            madvise(mapping, size, MADV_SEQUENTIAL);
+            madvise(mapping, size, MADV_WILLNEED);
+        }
+        data = static_cast<const char *>(mapping);
+        mappingSize = size;
+    } else {
+        const std::size_t bufferSize = (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        void *mapping = mmap(nullptr, bufferSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) {
+            close(fileDescriptor);
+            throw std::invalid_argument("MappedFile() error: cannot allocate buffer for " + path);
+        }
+#ifdef MADV_HUGEPAGE
+        // Advice only - without transparent huge pages the buffer uses regular pages
+        madvise(mapping, bufferSize, MADV_HUGEPAGE);
+#endif
+        std::size_t bytesRead = 0;
+        while (bytesRead < size) {
+            const ssize_t chunkSize = read(fileDescriptor, static_cast<char *>(mapping) + bytesRead, size - bytesRead);
+            if (chunkSize <= 0) {
+                munmap(mapping, bufferSize);
+                close(fileDescriptor);
+                throw std::invalid_argument("MappedFile() error: cannot read " + path);
+            }
+            bytesRead += static_cast<std::size_t>(chunkSize);
+        }
+        mprotect(mapping, bufferSize, PROT_READ);
+        data = static_cast<const char *>(mapping);
+        mappingSize = bufferSize;
+    }
+    close(fileDescriptor);
+}
+
+MappedFile::~MappedFile() {
+    if (mappingSize != 0) {
+        munmap(const_cast<char *>(data), mappingSize);
+    } else {
+        delete[] data;
+    }
+}
+
+namespace {
+    // Calls madvise() on whole pages covering [offset, offset + length) of the mapping at data
+    void advisePages(const char *data, std::size_t mappingSize, std::size_t offset, std::size_t length, int advice) {
+        if (offset >= mappingSize) {
+            return;
+        }
+        length = std::min(length, mappingSize - offset);
+        const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const std::size_t pageStart = offset / pageSize * pageSize;
+        madvise(const_cast<char *>(data) + pageStart, offset + length - pageStart, advice);
+    }
+}
+
+void MappedFile::adviseAccess(AccessPattern accessPattern, std::size_t offset, std::size_t length) const {
+    // Huge pages buffer is anonymous memory, read-ahead hints do not apply to it
+    if (mappingSize == 0 || backing == HugePages) {
+        return;
+    }
+    const int advice = (accessPattern == Sequential) ? MADV_SEQUENTIAL
+                       : (accessPattern == Random) ? MADV_RANDOM : MADV_NORMAL;
+    advisePages(data, mappingSize, offset, length, advice);
+}
+
+void MappedFile::prefetch(std::size_t offset, std::size_t length) const {
+    if (mappingSize == 0 || backing == HugePages) {
+        return;
+    }
+    advisePages(data, mappingSize, offset, length, MADV_WILLNEED);
+}
+
+#else
+
+#include <fstream>
+
+// Both backings read the file into a buffer
+MappedFile::MappedFile(const std::string &path, Backing backing) : data(nullptr), size(0), mappingSize(0),
+                                                                  backing(backing) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        throw std::invalid_argument("File with path " + path + " does not exist.");
+    }
+    size = static_cast<std::size_t>(file.tellg());
+    char *buffer = new char[size];
+    file.seekg(0);
+    file.read(buffer, static_cast<std::streamsize>(size));
+    data = buffer;
+}
+
+MappedFile::~MappedFile() {
+    delete[] data;
+}
+
+// Whole file is in memory, there is no paging to advise
+
+void MappedFile::adviseAccess(AccessPattern accessPattern, std::size_t offset, std::size_t length) const {
+}
+
+void MappedFile::prefetch(std::size_t offset, std::size_t length) const {
+}
+
+#endif
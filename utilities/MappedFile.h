@@ -0,0 +1,78 @@
+#ifndef PEA_P1_MAPPEDFILE_H
+#define PEA_P1_MAPPEDFILE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+// Read-only view of the whole file, memory-mapped on POSIX systems (read into a buffer elsewhere)
+// Contents stay valid until the object is destroyed
+class MappedFile {
+public:
+
+    enum Backing {
+        // Pages of the file are shared with the page cache, nothing is copied
+        PageCache,
+        // File is read into private memory backed by transparent huge pages (where supported)
+        // Costs one copy, pays off if the contents are accessed randomly many times afterwards
+        HugePages,
+        // As PageCache, but without read-ahead of the whole file - pages are read on first access and can be
+        // dropped again by the system, so files larger than RAM can be mapped
+        OnDemand
+    };
+
+    // Access hints for the system's paging (see adviseAccess())
+    enum AccessPattern {
+        // Pages are read ahead aggressively and dropped soon after being passed, for scans of rows
+        Sequential,
+        // No read-ahead, only touched pages are read, for scattered lookups (e.g. local search)
+        Random,
+        // Default paging of the system
+        Normal
+    };
+
+    // Size (in bytes) of a huge page, HugePages backing rounds the buffer up to it
+    static const std::size_t HUGE_PAGE_SIZE = std::size_t(2) << 20;
+
+    // Throws std::invalid_argument if the file cannot be opened
+    explicit MappedFile(const std::string &path, Backing backing = PageCache);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile &otherFile) = delete;
+
+    MappedFile &operator=(const MappedFile &otherFile) = delete;
+
+    [[nodiscard]] const char *begin() const {
+        return data;
+    }
+
+    [[nodiscard]] const char *end() const {
+        return data + size;
+    }
+
+    [[nodiscard]] std::size_t getSize() const {
+        return size;
+    }
+
+    // Hints the expected access to bytes [offset, offset + length) (rounded out to whole pages), only mapped
+    // backings (PageCache and OnDemand on POSIX systems) are affected
+    void adviseAccess(AccessPattern accessPattern, std::size_t offset = 0,
+                      std::size_t length = static_cast<std::size_t>(-1)) const;
+
+    // Asks the system to read bytes [offset, offset + length) in the background, before they are accessed
+    void prefetch(std::size_t offset, std::size_t length) const;
+
+private:
+
+    const char *data;
+
+    std::size_t size;
+
+    // Length of the mapping, 0 if data was allocated with new[]
+    std::size_t mappingSize;
+
+    Backing backing;
+};
+
+#endif //PEA_P1_MAPPEDFILE_H
@@ -0,0 +1,56 @@
+#include "MemoryUsage.h"
+
+#ifdef __linux__
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+std::size_t MemoryUsage::getCurrent() {
+    return readStatusField("VmRSS:");
+}
+
+std::size_t MemoryUsage::getPeak() {
+    return readStatusField("VmHWM:");
+}
+
+bool MemoryUsage::resetPeak() {
+    // "5" resets the peak resident set size (see proc(5))
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    clearRefs.close();
+    return static_cast<bool>(clearRefs);
+}
+
+std::size_t MemoryUsage::readStatusField(const char *fieldName) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    const std::size_t fieldLength = std::strlen(fieldName);
+    while (std::getline(status, line)) {
+        if (line.compare(0, fieldLength, fieldName) == 0) {
+            // Field is followed by the value in kB, e.g. "VmRSS:     1234 kB"
+            return std::stoull(line.substr(fieldLength));
+        }
+    }
+    return 0;
+}
+
+#else
+
+std::size_t MemoryUsage::getCurrent() {
+    return 0;
+}
+
+std::size_t MemoryUsage::getPeak() {
+    return 0;
+}
+
+bool MemoryUsage::resetPeak() {
+    return false;
+}
+
+std::size_t MemoryUsage::readStatusField(const char *) {
+    return 0;
+}
+
+#endif
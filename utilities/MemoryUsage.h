@@ -0,0 +1,26 @@
+#ifndef PEA_P1_MEMORYUSAGE_H
+#define PEA_P1_MEMORYUSAGE_H
+
+#include <cstddef>
+
+// Resident memory of this process, read from /proc/self on Linux (all methods return 0 elsewhere)
+class MemoryUsage {
+public:
+
+    // Resident set size (in KiB)
+    [[nodiscard]] static std::size_t getCurrent();
+
+    // Highest resident set size (in KiB) since the start of the process or the last resetPeak()
+    [[nodiscard]] static std::size_t getPeak();
+
+    // Lowers the peak to the current resident set size, returns false if the system does not allow it
+    static bool resetPeak();
+
+private:
+
+    // Value (in KiB) of given field of /proc/self/status, 0 if it is not there
+    [[nodiscard]] static std::size_t readStatusField(const char *fieldName);
+};
+
+
+#endif //PEA_P1_MEMORYUSAGE_H
@@ -0,0 +1,203 @@
+#include "TSPLIBInstance.h"
+
+void TSPLIBInstance::parse(const char *begin, const char *end, TSPLIBInstance::Contents &outContents) {
+    outContents = Contents();
+    bool hasType = false, hasEdgeWeightType = false, hasEdgeWeightFormat = false, hasCosts = false;
+    EdgeWeightFormat format = FullMatrix;
+
+    const char *position = begin;
+    std::string key, value;
+    while (position != end) {
+        const char *lineEnd = static_cast<const char *>(std::memchr(position, '\n', end - position));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+        splitLine(position, lineEnd, key, value);
+        position = (lineEnd == end) ? end : lineEnd + 1;
+
+        if (key.empty()) {
+            continue;
+        } else if (key == "EOF") {
+            break;
+        } else if (key == "NAME") {
+            outContents.instanceName = value;
+        } else if (key == "TYPE") {
+            if (value != "TSP" && value != "ATSP") {
+                throw std::invalid_argument("parse() error: unsupported TYPE " + value);
+            }
+            outContents.isSymmetric = (value == "TSP");
+            hasType = true;
+        } else if (key == "DIMENSION") {
+            parseNumber(value.data(), value.data() + value.size(), outContents.vertexCount);
+            if (outContents.vertexCount < 1) {
+                throw std::invalid_argument("parse() error: invalid DIMENSION " + value);
+            }
+        } else if (key == "EDGE_WEIGHT_TYPE") {
+            outContents.isExplicit = (value == "EXPLICIT");
+            if (value == "EUC_2D") {
+                outContents.distanceFunction = CoordinateGraph::Euclidean2D;
+            } else if (value == "CEIL_2D") {
+                outContents.distanceFunction = CoordinateGraph::CeilEuclidean2D;
+            } else if (value == "GEO") {
+                outContents.distanceFunction = CoordinateGraph::Geographic;
+            } else if (value == "ATT") {
+                outContents.distanceFunction = CoordinateGraph::PseudoEuclidean;
+            } else if (value != "EXPLICIT") {
+                throw std::invalid_argument("parse() error: unsupported EDGE_WEIGHT_TYPE " + value);
+            }
+            hasEdgeWeightType = true;
+        } else if (key == "EDGE_WEIGHT_FORMAT") {
+            if (value == "FULL_MATRIX") {
+                format = FullMatrix;
+            } else if (value == "UPPER_ROW") {
+                format = UpperRow;
+            } else if (value == "LOWER_ROW") {
+                format = LowerRow;
+            } else if (value == "UPPER_DIAG_ROW") {
+                format = UpperDiagonalRow;
+            } else if (value == "LOWER_DIAG_ROW") {
+                format = LowerDiagonalRow;
+            } else if (value != "FUNCTION") {
+                throw std::invalid_argument("parse() error: unsupported EDGE_WEIGHT_FORMAT " + value);
+            }
+            hasEdgeWeightFormat = (value != "FUNCTION");
+        } else if (key == "NODE_COORD_TYPE" && value == "THREED_COORDS") {
+            throw std::invalid_argument("parse() error: unsupported NODE_COORD_TYPE " + value);
+        } else if (key == "NODE_COORD_SECTION") {
+            if (outContents.vertexCount == 0 || !hasEdgeWeightType || outContents.isExplicit) {
+                throw std::invalid_argument("parse() error: NODE_COORD_SECTION needs DIMENSION and "
+                                            "coordinate EDGE_WEIGHT_TYPE before it");
+            }
+            position = parseCoordinates(position, end, outContents);
+            hasCosts = true;
+        } else if (key == "EDGE_WEIGHT_SECTION") {
+            if (outContents.vertexCount == 0 || !outContents.isExplicit || !hasEdgeWeightFormat) {
+                throw std::invalid_argument("parse() error: EDGE_WEIGHT_SECTION needs DIMENSION, "
+                                            "EDGE_WEIGHT_TYPE EXPLICIT and EDGE_WEIGHT_FORMAT before it");
+            }
+            // Section ends at the next keyword, so that the range can be parsed on several threads
+            const char *sectionEnd = findNextKeyword(position, end);
+            std::vector<int> sectionCosts(countSectionCosts(format, outContents.vertexCount));
+            InstanceParser::parseIntegersParallel(position, sectionEnd, sectionCosts.data(), sectionCosts.size());
+            expandCosts(format, outContents.vertexCount, sectionCosts, outContents.costMatrix);
+            position = sectionEnd;
+            hasCosts = true;
+        } else if (key.size() > 8 && key.compare(key.size() - 8, 8, "_SECTION") == 0) {
+            // Other sections (DISPLAY_DATA_SECTION, FIXED_EDGES_SECTION, ...) do not affect the costs
+            position = findNextKeyword(position, end);
+        }
+    }
+
+    if (!hasType || !hasEdgeWeightType || !hasCosts) {
+        throw std::invalid_argument("parse() error: TYPE, EDGE_WEIGHT_TYPE or section with costs is missing");
+    }
+}
+
+std::size_t TSPLIBInstance::countSectionCosts(TSPLIBInstance::EdgeWeightFormat format, int nVertex) {
+    const auto n = static_cast<std::size_t>(nVertex);
+    switch (format) {
+        case FullMatrix:
+            return n * n;
+        case UpperRow:
+        case LowerRow:
+            return n * (n - 1) / 2;
+        default:
+            return n * (n + 1) / 2;
+    }
+}
+
+void TSPLIBInstance::expandCosts(TSPLIBInstance::EdgeWeightFormat format, int nVertex,
+                                 const std::vector<int> &sectionCosts, std::vector<int> &costMatrix) {
+    const auto n = static_cast<std::size_t>(nVertex);
+    if (format == FullMatrix) {
+        costMatrix = sectionCosts;
+    } else {
+        costMatrix.assign(n * n, -1);
+        // Rows of the triangle are listed in order, row i covering columns [columnBegin(i), columnEnd(i))
+        const bool isUpper = (format == UpperRow || format == UpperDiagonalRow);
+        const bool hasDiagonal = (format == UpperDiagonalRow || format == LowerDiagonalRow);
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t columnBegin = isUpper ? (hasDiagonal ? i : i + 1) : 0;
+            const std::size_t columnEnd = isUpper ? n : (hasDiagonal ? i + 1 : i);
+            for (std::size_t j = columnBegin; j < columnEnd; ++j, ++k) {
+                costMatrix[i * n + j] = sectionCosts[k];
+                costMatrix[j * n + i] = sectionCosts[k];
+            }
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        costMatrix[i * n + i] = -1;
+    }
+}
+
+const char *TSPLIBInstance::parseCoordinates(const char *position, const char *end,
+                                             TSPLIBInstance::Contents &outContents) {
+    const int nVertex = outContents.vertexCount;
+    outContents.x.assign(nVertex, 0.0);
+    outContents.y.assign(nVertex, 0.0);
+    std::vector<bool> isGiven(nVertex, false);
+    for (int k = 0; k < nVertex; ++k) {
+        int vertexNumber;
+        position = parseNumber(position, end, vertexNumber);
+        // Vertices are numbered from 1
+        if (vertexNumber < 1 || vertexNumber > nVertex || isGiven[vertexNumber - 1]) {
+            throw std::invalid_argument("parse() error: invalid or repeated vertex number " +
+                                        std::to_string(vertexNumber) + " in NODE_COORD_SECTION");
+        }
+        isGiven[vertexNumber - 1] = true;
+        position = parseNumber(position, end, outContents.x[vertexNumber - 1]);
+        position = parseNumber(position, end, outContents.y[vertexNumber - 1]);
+    }
+    return position;
+}
+
+const char *TSPLIBInstance::findNextKeyword(const char *position, const char *end) {
+    while (position != end) {
+        // Keyword may be indented
+        const char *lineStart = position;
+        while (lineStart != end && (*lineStart == ' ' || *lineStart == '\t')) {
+            ++lineStart;
+        }
+        if (lineStart != end && std::isalpha(static_cast<unsigned char>(*lineStart))) {
+            return position;
+        }
+        const char *lineEnd = static_cast<const char *>(std::memchr(lineStart, '\n', end - lineStart));
+        position = (lineEnd == nullptr) ? end : lineEnd + 1;
+    }
+    return end;
+}
+
+void TSPLIBInstance::splitLine(const char *position, const char *lineEnd, std::string &outKey,
+                               std::string &outValue) {
+    auto trim = [](const char *first, const char *last, std::string &outText) {
+        while (first != last && std::isspace(static_cast<unsigned char>(*first))) {
+            ++first;
+        }
+        while (last != first && std::isspace(static_cast<unsigned char>(*(last - 1)))) {
+            --last;
+        }
+        outText.assign(first, last);
+    };
+    const char *separator = static_cast<const char *>(std::memchr(position, ':', lineEnd - position));
+    if (separator == nullptr) {
+        trim(position, lineEnd, outKey);
+        outValue.clear();
+    } else {
+        trim(position, separator, outKey);
+        trim(separator + 1, lineEnd, outValue);
+    }
+}
+
+template<class TNumber>
+const char *TSPLIBInstance::parseNumber(const char *position, const char *end, TNumber &outValue) {
+    while (position != end && (std::isspace(static_cast<unsigned char>(*position)) || *position == '+')) {
+        ++position;
+    }
+    const std::from_chars_result result = std::from_chars(position, end, outValue);
+    if (result.ec != std::errc()) {
+        throw std::invalid_argument("parse() error: number expected at \"" +
+                                    std::string(position, std::min<std::size_t>(end - position, 16)) + "\"");
+    }
+    return result.ptr;
+}
@@ -0,0 +1,67 @@
+#ifndef PEA_P1_TSPLIBINSTANCE_H
+#define PEA_P1_TSPLIBINSTANCE_H
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "InstanceParser.h"
+#include "../structures/graphs/CoordinateGraph.h"
+
+// Parsing of TSPLIB files (TYPE TSP or ATSP) held in memory (see MappedFile)
+// Supported EDGE_WEIGHT_TYPEs: EXPLICIT (FULL_MATRIX, UPPER_ROW, LOWER_ROW, UPPER_DIAG_ROW, LOWER_DIAG_ROW),
+// EUC_2D, CEIL_2D, GEO and ATT; fields not affecting the costs (COMMENT, DISPLAY_DATA_SECTION etc.) are skipped
+class TSPLIBInstance {
+public:
+
+    struct Contents {
+        std::string instanceName;
+        int vertexCount = 0;
+        // TYPE TSP
+        bool isSymmetric = false;
+        // EXPLICIT instances have costMatrix, the others coordinates (x, y)
+        bool isExplicit = false;
+        CoordinateGraph::DistanceFunction distanceFunction = CoordinateGraph::Euclidean2D;
+        // Row-major vertexCount x vertexCount, the diagonal is -1 (as in the text instances)
+        std::vector<int> costMatrix;
+        std::vector<double> x;
+        std::vector<double> y;
+    };
+
+    // Throws std::invalid_argument on unsupported or malformed file
+    static void parse(const char *begin, const char *end, Contents &outContents);
+
+private:
+    TSPLIBInstance() = default;
+
+    enum EdgeWeightFormat {
+        FullMatrix, UpperRow, LowerRow, UpperDiagonalRow, LowerDiagonalRow
+    };
+
+    // Number of costs given by the EDGE_WEIGHT_SECTION of nVertex vertices
+    [[nodiscard]] static std::size_t countSectionCosts(EdgeWeightFormat format, int nVertex);
+
+    // Fills row-major costMatrix from costs listed in the given format
+    static void expandCosts(EdgeWeightFormat format, int nVertex, const std::vector<int> &sectionCosts,
+                            std::vector<int> &costMatrix);
+
+    // Reads "<id> <x> <y>" lines of NODE_COORD_SECTION, returns position after the last one
+    static const char *parseCoordinates(const char *position, const char *end, Contents &outContents);
+
+    // Position of the next line starting with a letter (the next keyword), or end
+    static const char *findNextKeyword(const char *position, const char *end);
+
+    // Line [position, lineEnd) is split at ':' into trimmed key and value (value is empty if there is no ':')
+    static void splitLine(const char *position, const char *lineEnd, std::string &outKey, std::string &outValue);
+
+    template<class TNumber>
+    static const char *parseNumber(const char *position, const char *end, TNumber &outValue);
+};
+
+#endif //PEA_P1_TSPLIBINSTANCE_H
@@ -1,191 +1,298 @@
 #include "TSPUtils.h"
+#include "../structures/graphs/GraphDispatcher.h"
 
+TSPUtils::InstanceCache TSPUtils::instanceCache = TSPUtils::BinaryCache;
 
-std::string TSPUtils::loadTSPInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType) {
-    std::fstream file("../input_data/" + path);
-    std::string instanceName;
-    if (!file.is_open()) {
-        throw std::invalid_argument("File with path /input_data/" + path + " does not exist.");
-    }
-
-    int nVertex, edgeParameter;
-    file >> instanceName >> nVertex;
-
-    if (tspType == TSPUtils::TSPType::Asymmetric) {
-        *pGraph = new ListGraph(IGraph::GraphType::Directed, nVertex);
-        for (int i = 0; i < nVertex; ++i) {
-            for (int j = 0; j < nVertex; ++j) {
-                file >> edgeParameter;
-                if (i == j) {
-                    continue;
-                }
-                try {
-                    (*pGraph)->addEdge(i, j, edgeParameter);
-                } catch (const std::invalid_argument &e) {
-                    std::cout << e.what() << std::endl;
-                }
-            }
-        }
-    } else {
-        *pGraph = new ListGraph(IGraph::GraphType::Undirected, nVertex);
-        for (int i = 0; i < nVertex; ++i) {
-            for (int j = 0; j < nVertex; ++j) {
-                file >> edgeParameter;
-                if (i >= j) {
-                    continue;
-                }
-                try {
-                    (*pGraph)->addEdge(i, j, edgeParameter);
-                } catch (const std::invalid_argument &e) {
-                    std::cout << e.what() << std::endl;
-                }
-            }
-        }
+
+std::string TSPUtils::loadTSPInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType,
+                                      IGraph::GraphStructure graphStructure) {
+    return loadTSPInstanceAbsolutePath(pGraph, "../input_data/" + path, tspType, graphStructure);
+}
+
+std::string TSPUtils::loadTSPInstanceAbsolutePath(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType,
+                                                  IGraph::GraphStructure graphStructure) {
+    if (graphStructure == IGraph::GraphStructure::MappedFlatMatrix) {
+        TSPType mappedTSPType;
+        return mapTSPInstance(pGraph, path, &tspType, mappedTSPType);
     }
-    file.close();
-    return instanceName;
+    BinaryInstance::Contents instance;
+    readTSPInstance(path, instance);
+    buildTSPInstance(instance, pGraph, tspType, graphStructure);
+    return instance.instanceName;
 }
 
-std::string TSPUtils::loadTSPInstanceAbsolutePath(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType) {
-    std::fstream file(path);
-    std::string instanceName;
-    if (!file.is_open()) {
-        throw std::invalid_argument("File with path /input_data/" + path + " does not exist.");
-    }
-
-    int nVertex, edgeParameter;
-    file >> instanceName >> nVertex;
-
-    if (tspType == TSPUtils::TSPType::Asymmetric) {
-        *pGraph = new ListGraph(IGraph::GraphType::Directed, nVertex);
-        for (int i = 0; i < nVertex; ++i) {
-            for (int j = 0; j < nVertex; ++j) {
-                file >> edgeParameter;
-                if (i == j) {
-                    continue;
-                }
-                try {
-                    (*pGraph)->addEdge(i, j, edgeParameter);
-                } catch (const std::invalid_argument &e) {
-                    std::cout << e.what() << std::endl;
-                }
-            }
+std::string TSPUtils::loadTSPInstanceDetectType(IGraph **pGraph, const std::string &path,
+                                                TSPUtils::TSPType &outTSPType, IGraph::GraphStructure graphStructure,
+                                                bool *outIsMetric) {
+    return loadTSPInstanceDetectTypeAbsolutePath(pGraph, "../input_data/" + path, outTSPType, graphStructure,
+                                                 outIsMetric);
+}
+
+std::string TSPUtils::loadTSPInstanceDetectTypeAbsolutePath(IGraph **pGraph, const std::string &path,
+                                                            TSPUtils::TSPType &outTSPType,
+                                                            IGraph::GraphStructure graphStructure,
+                                                            bool *outIsMetric) {
+    if (graphStructure == IGraph::GraphStructure::MappedFlatMatrix) {
+        // Check would read the whole matrix n times
+        if (outIsMetric != nullptr) {
+            throw std::invalid_argument("loadTSPInstanceDetectType() error: metric check is not available for "
+                                        "MappedFlatMatrix");
         }
+        return mapTSPInstance(pGraph, path, nullptr, outTSPType);
+    }
+    BinaryInstance::Contents instance;
+    readTSPInstance(path, instance);
+    outTSPType = instance.isSymmetric ? TSPType::Symmetric : TSPType::Asymmetric;
+    if (outIsMetric != nullptr) {
+        *outIsMetric = isMetricInstance(instance);
+    }
+    buildTSPInstance(instance, pGraph, outTSPType, graphStructure);
+    return instance.instanceName;
+}
+
+void TSPUtils::readTSPInstance(const std::string &path, BinaryInstance::Contents &outInstance) {
+    if (instanceCache == NoCache) {
+        MappedFile file(path);
+        parseTSPInstance(file.begin(), file.end(), outInstance);
     } else {
-        *pGraph = new ListGraph(IGraph::GraphType::Undirected, nVertex);
-        for (int i = 0; i < nVertex; ++i) {
-            for (int j = 0; j < nVertex; ++j) {
-                file >> edgeParameter;
-                if (i >= j) {
-                    continue;
-                }
-                try {
-                    (*pGraph)->addEdge(i, j, edgeParameter);
-                } catch (const std::invalid_argument &e) {
-                    std::cout << e.what() << std::endl;
-                }
-            }
+        // Cache is rebuilt if the text file has changed since it was written
+        const std::string cachePath = path + ".bin";
+        const BinaryInstance::SourceStamp sourceStamp = BinaryInstance::getSourceStamp(path);
+        const MappedFile::Backing backing = (instanceCache == BinaryCacheHugePages)
+                                            ? MappedFile::Backing::HugePages : MappedFile::Backing::PageCache;
+        if (!BinaryInstance::read(cachePath, &sourceStamp, backing, outInstance)) {
+            MappedFile file(path);
+            parseTSPInstance(file.begin(), file.end(), outInstance);
+            // Failure to write the cache (e.g. read-only directory) only means the text is parsed again next time
+            BinaryInstance::write(cachePath, outInstance.instanceName, outInstance.vertexCount,
+                                  outInstance.costMatrix.data(), sourceStamp);
         }
     }
-    file.close();
-    return instanceName;
 }
 
-TSPUtils::TSPType TSPUtils::getTSPType(const std::string &path) {
-    std::fstream file("../input_data/" + path);
-    if (!file.is_open()) {
-        throw std::invalid_argument("File with path /input_data/" + path + " does not exist.");
+std::string TSPUtils::mapTSPInstance(IGraph **pGraph, const std::string &path, const TSPUtils::TSPType *tspType,
+                                     TSPUtils::TSPType &outTSPType) {
+    // Mapped regardless of the cache mode, the binary file is the only form that can be read in place
+    const std::string cachePath = path + ".bin";
+    const BinaryInstance::SourceStamp sourceStamp = BinaryInstance::getSourceStamp(path);
+    BinaryInstance::Layout layout;
+    bool isCacheValid = false;
+    std::error_code errorCode;
+    if (std::filesystem::is_regular_file(cachePath, errorCode)) {
+        MappedFile cacheFile(cachePath, MappedFile::Backing::OnDemand);
+        isCacheValid = BinaryInstance::readLayout(cacheFile, &sourceStamp, layout);
+    }
+    if (!isCacheValid) {
+        BinaryInstance::Contents instance;
+        {
+            MappedFile file(path);
+            parseTSPInstance(file.begin(), file.end(), instance);
+        }
+        if (!BinaryInstance::write(cachePath, instance.instanceName, instance.vertexCount,
+                                   instance.costMatrix.data(), sourceStamp)) {
+            throw std::invalid_argument("loadTSPInstance() error: binary file " + cachePath +
+                                        " needed by MappedFlatMatrix cannot be written");
+        }
+        layout.isSymmetric = instance.isSymmetric;
     }
 
-    std::string instanceName;
-    int nVertex;
-    file >> instanceName >> nVertex;
+    outTSPType = layout.isSymmetric ? TSPType::Symmetric : TSPType::Asymmetric;
+    const TSPType graphTSPType = (tspType != nullptr) ? *tspType : outTSPType;
+    const IGraph::GraphType graphType = (graphTSPType == TSPType::Asymmetric) ? IGraph::GraphType::Directed
+                                                                             : IGraph::GraphType::Undirected;
+    auto *graph = new MappedMatrix(graphType, cachePath);
+    *pGraph = graph;
+    return graph->getInstanceName();
+}
 
-    Table<Table<int>> instance;
-    int edgeValue;
+bool TSPUtils::isMetricInstance(const BinaryInstance::Contents &instance) {
+    const int nVertex = instance.vertexCount;
+    const auto n = static_cast<std::size_t>(nVertex);
+    const int *costs = instance.costMatrix.data();
     for (int i = 0; i < nVertex; ++i) {
-        instance.insertAtEnd(Table<int>());
+        const int *rowI = costs + i * n;
         for (int j = 0; j < nVertex; ++j) {
-            file >> edgeValue;
-            instance[i].insertAtEnd(edgeValue);
+            if (j == i) {
+                continue;
+            }
+            const int *rowJ = costs + j * n;
+            const long long costIJ = rowI[j];
+            // Violations are accumulated without branches, so that the loop over k vectorizes
+            bool isViolated = false;
+            for (int k = 0; k < nVertex; ++k) {
+                isViolated |= (rowI[k] > costIJ + rowJ[k]) & (k != i) & (k != j);
+            }
+            if (isViolated) {
+                return false;
+            }
         }
     }
-    file.close();
+    return true;
+}
 
-    if (instance.getSize() != nVertex) {
-        throw std::logic_error("Error: provided data does not represent an instance of TSP");
-    }
-    for (int i = 0; i < instance.getSize(); ++i) {
-        if (instance[i].getSize() != nVertex) {
-            throw std::logic_error("Error: provided data does not represent an instance of TSP");
-        }
-    }
-//    for (int i = 0; i < instance.getSize(); ++i) {
-//        if (instance[i][i] != -1) {
-//            throw std::logic_error("Error: provided data does not represent an instance of TSP");
-//        }
-//    }
+void TSPUtils::setInstanceCache(TSPUtils::InstanceCache cacheMode) {
+    instanceCache = cacheMode;
+}
 
-    for (int i = 0; i < nVertex; ++i) {
-        for (int j = i + 1; j < nVertex; ++j) {
-            if (instance[i][j] != instance[j][i]) {
-                return TSPType::Asymmetric;
-            }
-        }
-    }
-    return TSPType::Symmetric;
+std::string TSPUtils::loadSparseTSPInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType,
+                                            IGraph::GraphStructure graphStructure) {
+    return loadSparseTSPInstanceAbsolutePath(pGraph, "../input_data/" + path, tspType, graphStructure);
 }
 
-TSPUtils::TSPType TSPUtils::getTSPTypeAbsolutePath(const std::string &path) {
-    std::fstream file(path);
-    if (!file.is_open()) {
-        throw std::invalid_argument("File with path /input_data/" + path + " does not exist.");
-    }
+std::string TSPUtils::loadSparseTSPInstanceAbsolutePath(IGraph **pGraph, const std::string &path,
+                                                        TSPUtils::TSPType tspType,
+                                                        IGraph::GraphStructure graphStructure) {
+    MappedFile file(path);
+    return readSparseTSPInstance(file.begin(), file.end(), pGraph, tspType, graphStructure);
+}
 
-    std::string instanceName;
-    int nVertex;
-    file >> instanceName >> nVertex;
+void TSPUtils::parseTSPInstance(const char *begin, const char *end, BinaryInstance::Contents &outInstance) {
+    const char *position = InstanceParser::readToken(begin, end, outInstance.instanceName);
+    position = InstanceParser::parseIntegers(position, end, &outInstance.vertexCount, 1);
+    const int nVertex = outInstance.vertexCount;
+    if (nVertex < 1) {
+        throw std::invalid_argument("parseTSPInstance() error: invalid vertex count of instance " +
+                                    outInstance.instanceName);
+    }
+    outInstance.costMatrix.resize(static_cast<std::size_t>(nVertex) * nVertex);
+    InstanceParser::parseIntegersParallel(position, end, outInstance.costMatrix.data(), outInstance.costMatrix.size());
+    outInstance.isSymmetric = BinaryInstance::isSymmetricMatrix(outInstance.costMatrix.data(), nVertex);
+}
 
-    Table<Table<int>> instance;
-    int edgeValue;
-    for (int i = 0; i < nVertex; ++i) {
-        instance.insertAtEnd(Table<int>());
-        for (int j = 0; j < nVertex; ++j) {
-            file >> edgeValue;
-            instance[i].insertAtEnd(edgeValue);
-        }
-    }
-    file.close();
+void TSPUtils::buildTSPInstance(const BinaryInstance::Contents &instance, IGraph **pGraph, TSPUtils::TSPType tspType,
+                                IGraph::GraphStructure graphStructure) {
+    const IGraph::GraphType graphType = (tspType == TSPUtils::TSPType::Asymmetric) ? IGraph::GraphType::Directed
+                                                                                  : IGraph::GraphType::Undirected;
+    // Symmetric instances use only the upper triangle of the matrix
+    *pGraph = GraphBuilder::build(graphType, instance.vertexCount, instance.costMatrix.data(), graphStructure);
+}
 
-    if (instance.getSize() != nVertex) {
-        throw std::logic_error("Error: provided data does not represent an instance of TSP");
+std::string TSPUtils::readSparseTSPInstance(const char *begin, const char *end, IGraph **pGraph,
+                                            TSPUtils::TSPType tspType, IGraph::GraphStructure graphStructure) {
+    std::string instanceName;
+    int header[2];
+    const char *position = InstanceParser::readToken(begin, end, instanceName);
+    position = InstanceParser::parseIntegers(position, end, header, 2);
+    const int nVertex = header[0], nEdges = header[1];
+    if (nVertex < 1 || nEdges < 0) {
+        throw std::invalid_argument("readSparseTSPInstance() error: invalid header of instance " + instanceName);
     }
-    for (int i = 0; i < instance.getSize(); ++i) {
-        if (instance[i].getSize() != nVertex) {
-            throw std::logic_error("Error: provided data does not represent an instance of TSP");
-        }
+
+    // (start, end, cost) triples
+    std::vector<int> edgeTriples(static_cast<std::size_t>(nEdges) * 3);
+    InstanceParser::parseIntegersParallel(position, end, edgeTriples.data(), edgeTriples.size());
+
+    Table<Edge> edges;
+    edges.reserve(nEdges);
+    for (int k = 0; k < nEdges; ++k) {
+        edges.emplaceAtEnd(edgeTriples[3 * static_cast<std::size_t>(k)],
+                           edgeTriples[3 * static_cast<std::size_t>(k) + 1],
+                           edgeTriples[3 * static_cast<std::size_t>(k) + 2]);
     }
-//    for (int i = 0; i < instance.getSize(); ++i) {
-//        if (instance[i][i] != -1) {
-//            throw std::logic_error("Error: provided data does not represent an instance of TSP");
-//        }
-//    }
 
-    for (int i = 0; i < nVertex; ++i) {
-        for (int j = i + 1; j < nVertex; ++j) {
-            if (instance[i][j] != instance[j][i]) {
-                return TSPType::Asymmetric;
+    const IGraph::GraphType graphType = (tspType == TSPUtils::TSPType::Asymmetric) ? IGraph::GraphType::Directed
+                                                                                  : IGraph::GraphType::Undirected;
+    *pGraph = GraphBuilder::build(graphType, nVertex, edges, graphStructure);
+    return instanceName;
+}
+
+std::string TSPUtils::loadTSPLIBInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType,
+                                         IGraph::GraphStructure graphStructure) {
+    return loadTSPLIBInstanceAbsolutePath(pGraph, "../input_data/" + path, tspType, graphStructure);
+}
+
+std::string TSPUtils::loadTSPLIBInstanceAbsolutePath(IGraph **pGraph, const std::string &path,
+                                                     TSPUtils::TSPType tspType,
+                                                     IGraph::GraphStructure graphStructure) {
+    TSPLIBInstance::Contents tsplibInstance;
+    {
+        MappedFile file(path);
+        TSPLIBInstance::parse(file.begin(), file.end(), tsplibInstance);
+    }
+    if (tspType == TSPType::Symmetric && !tsplibInstance.isSymmetric) {
+        throw std::invalid_argument("loadTSPLIBInstance() error: instance " + tsplibInstance.instanceName +
+                                    " is asymmetric");
+    }
+    const IGraph::GraphType graphType = (tspType == TSPUtils::TSPType::Asymmetric) ? IGraph::GraphType::Directed
+                                                                                  : IGraph::GraphType::Undirected;
+
+    BinaryInstance::Contents instance;
+    instance.instanceName = tsplibInstance.instanceName;
+    instance.vertexCount = tsplibInstance.vertexCount;
+    if (tsplibInstance.isExplicit) {
+        instance.costMatrix = std::move(tsplibInstance.costMatrix);
+        if (graphStructure == IGraph::GraphStructure::NodeCoordinates) {
+            graphStructure = IGraph::GraphStructure::FlatMatrix;
+        }
+    } else {
+        auto coordinateGraph = std::make_unique<CoordinateGraph>(graphType, tsplibInstance.distanceFunction,
+                                                                 tsplibInstance.x.data(), tsplibInstance.y.data(),
+                                                                 tsplibInstance.vertexCount);
+        if (graphStructure == IGraph::GraphStructure::NodeCoordinates) {
+            *pGraph = coordinateGraph.release();
+            return instance.instanceName;
+        }
+        // Costs are computed once, for structures storing them
+        const auto nVertex = static_cast<std::size_t>(instance.vertexCount);
+        instance.costMatrix.resize(nVertex * nVertex);
+        for (std::size_t i = 0; i < nVertex; ++i) {
+            for (std::size_t j = 0; j < nVertex; ++j) {
+                instance.costMatrix[i * nVertex + j] = (i == j) ? -1 : coordinateGraph->getCost(i, j);
             }
         }
     }
-    return TSPType::Symmetric;
+    buildTSPInstance(instance, pGraph, tspType, graphStructure);
+    return instance.instanceName;
+}
+
+TSPUtils::TSPType TSPUtils::getTSPType(const std::string &path) {
+    return getTSPTypeAbsolutePath("../input_data/" + path);
+}
+
+TSPUtils::TSPType TSPUtils::getTSPTypeAbsolutePath(const std::string &path) {
+    BinaryInstance::Contents instance;
+    readTSPInstance(path, instance);
+    return instance.isSymmetric ? TSPType::Symmetric : TSPType::Asymmetric;
 }
 
 int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const std::vector<int> &vertexPermutation) {
-    int sum = 0;
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return calculateTargetFunctionValue(graph, vertexPermutation);
+    });
+}
+
+int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, int fixedStartVertex,
+                                           const std::vector<int> &vertexPermutation) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return calculateTargetFunctionValue(graph, fixedStartVertex, vertexPermutation);
+    });
+}
+
+int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const std::list<int> &vertexPermutation) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return calculateTargetFunctionValue(graph, vertexPermutation);
+    });
+}
+
+int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, int fixedStartVertex,
+                                           const std::list<int> &vertexPermutation) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return calculateTargetFunctionValue(graph, fixedStartVertex, vertexPermutation);
+    });
+}
+
+int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const DoublyLinkedList<int> &vertexPermutation) {
+    return GraphDispatcher::dispatch(tspInstance, [&](const auto &graph) {
+        return calculateTargetFunctionValue(graph, vertexPermutation);
+    });
+}
+
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPUtils::calculateTargetFunctionValue(const TGraph &tspInstance, const std::vector<int> &vertexPermutation) {
+    std::int64_t sum = 0;
     int permutationSize = vertexPermutation.size();
     if (permutationSize == 0 || permutationSize == 1) {
-        return sum;
+        return 0;
     }
 
     auto it = vertexPermutation.begin();
@@ -195,37 +302,39 @@ int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const std:
     int v2 = -1;
     for (; it != vertexPermutation.end(); ++it) {
         v2 = *it;
-        sum += tspInstance->getEdgeParameter(v1, v2);
+        sum += tspInstance.getEdgeParameter(v1, v2);
         v1 = v2;
     }
-    sum += tspInstance->getEdgeParameter(v2, vStart);
-    return sum;
+    sum += tspInstance.getEdgeParameter(v2, vStart);
+    return narrowTourCost(sum);
 }
 
-int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, int fixedStartVertex,
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPUtils::calculateTargetFunctionValue(const TGraph &tspInstance, int fixedStartVertex,
                                            const std::vector<int> &vertexPermutation) {
-    int sum = 0;
+    std::int64_t sum = 0;
     int permutationSize = vertexPermutation.size();
     if (permutationSize == 0) {
-        return sum;
+        return 0;
     }
 
     int v1 = fixedStartVertex;
     int v2 = -1;
     for (int i = 0; i != permutationSize; ++i) {
         v2 = vertexPermutation[i];
-        sum += tspInstance->getEdgeParameter(v1, v2);
+        sum += tspInstance.getEdgeParameter(v1, v2);
         v1 = v2;
     }
-    sum += tspInstance->getEdgeParameter(v2, fixedStartVertex);
-    return sum;
+    sum += tspInstance.getEdgeParameter(v2, fixedStartVertex);
+    return narrowTourCost(sum);
 }
 
-int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const std::list<int> &vertexPermutation) {
-    int sum = 0;
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPUtils::calculateTargetFunctionValue(const TGraph &tspInstance, const std::list<int> &vertexPermutation) {
+    std::int64_t sum = 0;
     int permutationSize = vertexPermutation.size();
     if (permutationSize == 0 || permutationSize == 1) {
-        return sum;
+        return 0;
     }
 
     auto it = vertexPermutation.begin();
@@ -235,37 +344,39 @@ int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const std:
     int v2 = -1;
     for (; it != vertexPermutation.end(); ++it) {
         v2 = *it;
-        sum += tspInstance->getEdgeParameter(v1, v2);
+        sum += tspInstance.getEdgeParameter(v1, v2);
         v1 = v2;
     }
-    sum += tspInstance->getEdgeParameter(v2, vStart);
-    return sum;
+    sum += tspInstance.getEdgeParameter(v2, vStart);
+    return narrowTourCost(sum);
 }
 
-int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, int fixedStartVertex,
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPUtils::calculateTargetFunctionValue(const TGraph &tspInstance, int fixedStartVertex,
                                            const std::list<int> &vertexPermutation) {
-    int sum = 0;
+    std::int64_t sum = 0;
     int permutationSize = vertexPermutation.size();
     if (permutationSize == 0) {
-        return sum;
+        return 0;
     }
 
     int v1 = fixedStartVertex;
     int v2 = -1;
     for (const auto &nextVertex : vertexPermutation) {
         v2 = nextVertex;
-        sum += tspInstance->getEdgeParameter(v1, v2);
+        sum += tspInstance.getEdgeParameter(v1, v2);
         v1 = v2;
     }
-    sum += tspInstance->getEdgeParameter(v2, fixedStartVertex);
-    return sum;
+    sum += tspInstance.getEdgeParameter(v2, fixedStartVertex);
+    return narrowTourCost(sum);
 }
 
-int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const DoublyLinkedList<int> &vertexPermutation) {
-    int sum = 0;
+template<class TGraph, EnableIfGraph<TGraph>>
+int TSPUtils::calculateTargetFunctionValue(const TGraph &tspInstance, const DoublyLinkedList<int> &vertexPermutation) {
+    std::int64_t sum = 0;
     int permutationSize = vertexPermutation.getSize();
     if (permutationSize == 0 || permutationSize == 1) {
-        return sum;
+        return 0;
     }
 
     auto it = vertexPermutation.getIterator();
@@ -275,11 +386,22 @@ int TSPUtils::calculateTargetFunctionValue(const IGraph *tspInstance, const Doub
     int v2 = -1;
     for (; it != vertexPermutation.getEndIt(); ++it) {
         v2 = it.getData();
-        sum += tspInstance->getEdgeParameter(v1, v2);
+        sum += tspInstance.getEdgeParameter(v1, v2);
         v1 = v2;
     }
-    sum += tspInstance->getEdgeParameter(v2, vStart);
-    return sum;
+    sum += tspInstance.getEdgeParameter(v2, vStart);
+    return narrowTourCost(sum);
+}
+
+int TSPUtils::narrowTourCost(std::int64_t tourCost) {
+    // Tours using missing edges (INT_MAX) or exceeding int range are reported as INT_MAX
+    if (tourCost > std::numeric_limits<int>::max()) {
+        return std::numeric_limits<int>::max();
+    }
+    if (tourCost < std::numeric_limits<int>::min()) {
+        return std::numeric_limits<int>::min();
+    }
+    return static_cast<int>(tourCost);
 }
 
 std::map<std::string, int> TSPUtils::loadTSPSolutionValues(const std::string &file) {
@@ -366,3 +488,13 @@ bool TSPUtils::areSolutionsEqual(const std::vector<int> &solution1, const std::v
     }
     return true;
 }
+
+// Explicit instantiations for graph types handled by GraphDispatcher
+#define INSTANTIATE_TARGET_FUNCTION_VALUE(TGraph)                                                               \
+    template int TSPUtils::calculateTargetFunctionValue<TGraph>(const TGraph &, const std::vector<int> &);      \
+    template int TSPUtils::calculateTargetFunctionValue<TGraph>(const TGraph &, int, const std::vector<int> &); \
+    template int TSPUtils::calculateTargetFunctionValue<TGraph>(const TGraph &, const std::list<int> &);        \
+    template int TSPUtils::calculateTargetFunctionValue<TGraph>(const TGraph &, int, const std::list<int> &);   \
+    template int TSPUtils::calculateTargetFunctionValue<TGraph>(const TGraph &, const DoublyLinkedList<int> &);
+
+PEA_P1_FOR_EACH_DISPATCHED_GRAPH(INSTANTIATE_TARGET_FUNCTION_VALUE)
@@ -9,11 +9,27 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <cstdint>
+#include <limits>
+#include <memory>
 
 #include "../structures/DoublyLinkedList.h"
 #include "../structures/Table.h"
 #include "../structures/graphs/IGraph.h"
 #include "../structures/graphs/ListGraph.h"
+#include "../structures/graphs/MatrixGraph.h"
+#include "../structures/graphs/DistanceMatrix.h"
+#include "../structures/graphs/QuantizedMatrix.h"
+#include "../structures/graphs/TriangularMatrix.h"
+#include "../structures/graphs/SparseGraph.h"
+#include "../structures/graphs/TiledMatrix.h"
+#include "../structures/graphs/CoordinateGraph.h"
+#include "../structures/graphs/MappedMatrix.h"
+#include "../structures/graphs/GraphBuilder.h"
+#include "MappedFile.h"
+#include "InstanceParser.h"
+#include "BinaryInstance.h"
+#include "TSPLIBInstance.h"
 #include "../algorithms/TSPExactAlgorithms.h"
 
 
@@ -24,21 +40,86 @@ public:
         Symmetric, Asymmetric
     };
 
+    enum InstanceCache {
+        // Text file is parsed on every load
+        NoCache,
+        // Parsed instance is stored in binary form beside the text file (as <file>.bin) and read from there
+        // as long as the text file is not modified
+        BinaryCache,
+        // As BinaryCache, binary file is read into memory backed by huge pages
+        BinaryCacheHugePages
+    };
+
+    // Applies to loadTSPInstance() and loadTSPInstanceAbsolutePath(), BinaryCache by default
+    static void setInstanceCache(InstanceCache cacheMode);
+
+    // graphStructure selects the graph representation created in *pGraph
+    // QuantizedFlatMatrix picks uint8, uint16 or int32 (DistanceMatrix) costs, based on the largest edge parameter
+    // PackedTriangular requires tspType Symmetric
+    // TiledFlatMatrix and MortonFlatMatrix create TiledMatrix with the matching layout, for instances in the thousands
+    // MappedFlatMatrix maps the binary cache of the instance (written first if missing or stale, which needs
+    // the matrix in memory once) as MappedMatrix with Random access pattern, for instances larger than RAM
+    static std::string
+    loadTSPInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType = Asymmetric,
+                    IGraph::GraphStructure graphStructure = IGraph::GraphStructure::AdjacencyList);
+
+    static std::string loadTSPInstanceAbsolutePath(IGraph **pGraph, const std::string &path, TSPType tspType,
+                                                   IGraph::GraphStructure graphStructure =
+                                                           IGraph::GraphStructure::AdjacencyList);
+
+    // Loads instance as loadTSPInstance(), with the type detected in the same pass (symmetric instances get
+    // Undirected graphs); the detected type is written to outTSPType
+    // If outIsMetric is not nullptr, *outIsMetric tells if costs satisfy the triangle inequality (O(n^3) check),
+    // not available for MappedFlatMatrix
+    static std::string
+    loadTSPInstanceDetectType(IGraph **pGraph, const std::string &path, TSPUtils::TSPType &outTSPType,
+                              IGraph::GraphStructure graphStructure = IGraph::GraphStructure::AdjacencyList,
+                              bool *outIsMetric = nullptr);
+
+    static std::string
+    loadTSPInstanceDetectTypeAbsolutePath(IGraph **pGraph, const std::string &path, TSPType &outTSPType,
+                                          IGraph::GraphStructure graphStructure =
+                                                  IGraph::GraphStructure::AdjacencyList,
+                                          bool *outIsMetric = nullptr);
+
+    // Loads instance given as edge list: name, vertex count and edge count, then one "start end cost" line per edge
+    // Edges of symmetric instances are listed once, missing edges are reported as std::numeric_limits<int>::max()
+    // Default CompressedSparseRow keeps memory in O(V + E), other structures allocate as usual
+    // Invalid edge (vertex's index out of range, loop or multiple edge) throws std::invalid_argument
     static std::string
-    loadTSPInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType = Asymmetric);
+    loadSparseTSPInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType = Asymmetric,
+                          IGraph::GraphStructure graphStructure = IGraph::GraphStructure::CompressedSparseRow);
 
-    static std::string loadTSPInstanceAbsolutePath(IGraph **pGraph, const std::string &path, TSPType tspType);
+    static std::string
+    loadSparseTSPInstanceAbsolutePath(IGraph **pGraph, const std::string &path, TSPType tspType,
+                                      IGraph::GraphStructure graphStructure =
+                                              IGraph::GraphStructure::CompressedSparseRow);
+
+    // Loads instance in TSPLIB format (see TSPLIBInstance for supported files)
+    // Coordinate instances (EUC_2D, CEIL_2D, GEO, ATT) are kept as CoordinateGraph by default (NodeCoordinates),
+    // using O(n) memory; other structures get the computed n x n costs
+    // EXPLICIT instances have no coordinates - NodeCoordinates creates FlatMatrix for them
+    // Throws std::invalid_argument if tspType is Symmetric for ATSP file
+    static std::string
+    loadTSPLIBInstance(IGraph **pGraph, const std::string &path, TSPUtils::TSPType tspType = Asymmetric,
+                       IGraph::GraphStructure graphStructure = IGraph::GraphStructure::NodeCoordinates);
+
+    static std::string
+    loadTSPLIBInstanceAbsolutePath(IGraph **pGraph, const std::string &path, TSPType tspType,
+                                   IGraph::GraphStructure graphStructure = IGraph::GraphStructure::NodeCoordinates);
 
     // Returns map with entries {<instance file name>, <solution value>}
     static std::map<std::string, int> loadTSPSolutionValues(const std::string &file);
 
     static std::map<std::string, int> loadTSPSolutionValuesAbsolutePath(const std::string &file);
 
+    // Parses the instance (or reads its binary cache) - prefer loadTSPInstanceDetectType() if the graph is needed too
     static TSPType getTSPType(const std::string &path);
 
     static TSPType getTSPTypeAbsolutePath(const std::string &path);
 
 
+    // Tour costs are summed in 64 bits, values not fitting in int are saturated (missing edge makes tour cost INT_MAX)
     static int calculateTargetFunctionValue(const IGraph *tspInstance, const DoublyLinkedList<int> &vertexPermutation);
 
     static int calculateTargetFunctionValue(const IGraph *tspInstance, const std::vector<int> &vertexPermutation);
@@ -51,6 +132,25 @@ public:
     static int calculateTargetFunctionValue(const IGraph *tspInstance, int fixedStartVertex,
                                             const std::list<int> &vertexPermutation);
 
+    // Variants taking the concrete graph type, so that edge lookups are not virtual calls
+    // Instantiated for IGraph and every graph type handled by GraphDispatcher
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int calculateTargetFunctionValue(const TGraph &tspInstance, const DoublyLinkedList<int> &vertexPermutation);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int calculateTargetFunctionValue(const TGraph &tspInstance, const std::vector<int> &vertexPermutation);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int calculateTargetFunctionValue(const TGraph &tspInstance, const std::list<int> &vertexPermutation);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int calculateTargetFunctionValue(const TGraph &tspInstance, int fixedStartVertex,
+                                            const std::vector<int> &vertexPermutation);
+
+    template<class TGraph, EnableIfGraph<TGraph> = 0>
+    static int calculateTargetFunctionValue(const TGraph &tspInstance, int fixedStartVertex,
+                                            const std::list<int> &vertexPermutation);
+
     bool static isSolutionValid(IGraph *tspInstance, const std::vector<int> &solutionPermutation,
                          int solutionPathCost);
 
@@ -58,6 +158,34 @@ public:
 
 private:
 
+    // Reads instance from text file at path, or from its binary cache (see InstanceCache)
+    static void readTSPInstance(const std::string &path, BinaryInstance::Contents &outInstance);
+
+    // True if c(i, k) <= c(i, j) + c(j, k) for all distinct vertices i, j, k
+    static bool isMetricInstance(const BinaryInstance::Contents &instance);
+
+    // Parses instance (name, vertex count and cost matrix) from text file contents, detecting its symmetry
+    static void parseTSPInstance(const char *begin, const char *end, BinaryInstance::Contents &outInstance);
+
+    // Maps binary cache of text instance at path as MappedMatrix in *pGraph, writing the cache first if it is
+    // missing or stale; tspType nullptr detects the type; the detected type is written to outTSPType
+    static std::string mapTSPInstance(IGraph **pGraph, const std::string &path, const TSPType *tspType,
+                                      TSPType &outTSPType);
+
+    // Builds graph of given structure in *pGraph from parsed instance, with the whole matrix at once
+    // (see GraphBuilder)
+    static void buildTSPInstance(const BinaryInstance::Contents &instance, IGraph **pGraph, TSPType tspType,
+                                 IGraph::GraphStructure graphStructure);
+
+    static InstanceCache instanceCache;
+
+    // Reads instance in edge list format (see loadSparseTSPInstance()) from file contents and builds graph
+    // of given structure in *pGraph
+    static std::string readSparseTSPInstance(const char *begin, const char *end, IGraph **pGraph, TSPType tspType,
+                                             IGraph::GraphStructure graphStructure);
+
+    // Narrows tour cost summed in 64 bits to int, saturating at int limits
+    static int narrowTourCost(std::int64_t tourCost);
 
 };
 